@@ -0,0 +1,120 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <atomic>
+#include <cstring>
+#include <boost/thread/thread.hpp>
+#include <boost/chrono.hpp>
+#include <event2/util.h>
+#include "IRpcServer.h"
+#include "Global.h"
+#ifdef WIN32
+#include <winsock2.h>
+#else
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#endif
+
+//ʹõķַ
+#define BENCH_IP "127.0.0.1"
+//ÿֲԵĳʱ䣨룩
+#define BENCH_SECONDS 3
+//IOWorker
+#define IOWORKER_NUM 4
+//ӵĿͻ߳
+#define CLIENT_THREAD_NUM 16
+
+//Ƿͻ߳
+std::atomic<bool> g_bStopped;
+//ɹӹܵ
+std::atomic<unsigned long> g_connCount;
+
+/************************************************************************
+  ܣͻ߳ӡPINGȴPONGϿӣ
+	յPONG˵acceptӹ
+  
+	port룬Ķ˿ں
+ֵ
+************************************************************************/
+void clientMain(int port)
+{
+	sockaddr_in serverAddr;
+	memset(&serverAddr, 0, sizeof(serverAddr));
+	serverAddr.sin_family = AF_INET;
+	evutil_inet_pton(AF_INET, BENCH_IP, &(serverAddr.sin_addr));
+	serverAddr.sin_port = htons(port);
+
+	unsigned char ping[HEAD_SIZE] = {0};
+	ping[0] = DATA_TYPE_HEARTBEAT_PING;
+
+	while (!g_bStopped.load())
+	{
+		evutil_socket_t fd = socket(AF_INET, SOCK_STREAM, 0);
+		if (fd < 0)
+			continue;
+		if (0 == connect(fd, (sockaddr *)(&serverAddr), sizeof(serverAddr))
+			&& HEAD_SIZE == send(fd, (const char *)ping, HEAD_SIZE, 0))
+		{
+			unsigned char pong[HEAD_SIZE];
+			if (HEAD_SIZE == recv(fd, (char *)pong, HEAD_SIZE, MSG_WAITALL) && DATA_TYPE_HEARTBEAT_PONG == pong[0])
+				++g_connCount;
+		}
+		evutil_closesocket(fd);
+	}
+}
+
+//RpcServerstart()ֱRpcServer
+void serverMain(IRpcServer *pIServer)
+{
+	pIServer->start();
+}
+
+/************************************************************************
+  ܣһacceptģʽµӽӹ
+  
+	port룬Ķ˿ں
+	bReusePort룬ǷʹSO_REUSEPORTģʽ
+ֵÿӹܵ
+************************************************************************/
+double benchAccept(int port, bool bReusePort)
+{
+	IRpcServer *pIServer = IRpcServer::createRpcServer(BENCH_IP, port, IOWORKER_NUM, 1024, 1024, 1, 1024, 1024, bReusePort);
+	boost::thread serverThd(serverMain, pIServer);
+	//ȴʼ
+	boost::this_thread::sleep_for(boost::chrono::milliseconds(500));
+
+	g_bStopped.store(false);
+	g_connCount.store(0);
+	std::vector<boost::thread *> vecThd;
+	for (unsigned int i = 0; i < CLIENT_THREAD_NUM; ++i)
+		vecThd.push_back(new boost::thread(clientMain, port));
+
+	boost::this_thread::sleep_for(boost::chrono::seconds(BENCH_SECONDS));
+	g_bStopped.store(true);
+	for (auto it = vecThd.begin(); it != vecThd.end(); ++it)
+	{
+		(*it)->join();
+		delete *it;
+	}
+	double rate = (double)g_connCount.load() / BENCH_SECONDS;
+
+	//ȽRpcServerȴstart()أRpcServerʵ
+	pIServer->end();
+	serverThd.join();
+	IRpcServer::releaseRpcServer(pIServer);
+	return rate;
+}
+
+int main()
+{
+	//ÿνӹӡظPONGʱ׼ӡ־Խӡ׼
+	double acceptThreadRate = benchAccept(18888, false);
+	double reusePortRate = benchAccept(18889, true);
+
+	std::cerr << "mode                 accepted(conns/s)" << std::endl;
+	std::cerr << "accept thread" << std::setw(25) << std::fixed << std::setprecision(0) << acceptThreadRate << std::endl;
+	std::cerr << "SO_REUSEPORT" << std::setw(26) << reusePortRate << std::endl;
+
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,184 @@
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <event2/event.h>
+#include <event2/buffer.h>
+#include <google/protobuf/arena.h>
+#include "Test.pb.h"
+#include "ProtocolCodec.h"
+
+//ÿַʽ
+#define REQUEST_COUNT 200000
+//ʼǰԤ
+#define WARMUP_COUNT 1000
+//ArenaʼڴСҵWorkerARENA_INITIAL_BLOCK_SIZEһ
+#define ARENA_BLOCK_SIZE (64 * 1024)
+
+//operator newĵô
+std::atomic<unsigned long> g_newCount(0);
+//libeventmallocreallocô
+std::atomic<unsigned long> g_eventAllocCount(0);
+
+void *operator new(size_t size)
+{
+	++g_newCount;
+	void *p = malloc(size ? size : 1);
+	if (NULL == p)
+		throw std::bad_alloc();
+	return p;
+}
+
+void operator delete(void *p) noexcept
+{
+	free(p);
+}
+
+void operator delete(void *p, size_t) noexcept
+{
+	free(p);
+}
+
+void *eventMalloc(size_t size)
+{
+	++g_eventAllocCount;
+	return malloc(size);
+}
+
+void *eventRealloc(void *p, size_t size)
+{
+	++g_eventAllocCount;
+	return realloc(p, size);
+}
+
+void eventFree(void *p)
+{
+	free(p);
+}
+
+//ʵ
+class NumServiceImpl : public testNamespace::NumService
+{
+public:
+	virtual void add(::google::protobuf::RpcController* controller,
+		const ::testNamespace::NumRequest* request,
+		::testNamespace::NumResponse* response,
+		::google::protobuf::Closure* done)
+	{
+		response->set_output(request->input1() + request->input2());
+	}
+
+	virtual void minus(::google::protobuf::RpcController* controller,
+		const ::testNamespace::NumRequest* request,
+		::testNamespace::NumResponse* response,
+		::google::protobuf::Closure* done)
+	{
+		response->set_output(request->input1() - request->input2());
+	}
+};
+
+/************************************************************************
+  ܣҵWorker̴һ󣺽롢MessageáӦ
+  
+	pService룬ָ
+	pInBuf룬Эbody
+	pOutBufӦЭ
+	pArena룬Arenaָ룬ΪNULLʱMessageڶϷ
+ֵ
+	trueɹ
+	falseʧ
+************************************************************************/
+bool handleRequest(google::protobuf::Service *pService, evbuffer *pInBuf, evbuffer *pOutBuf, google::protobuf::Arena *pArena)
+{
+	RequestView view;
+	if (!ProtocolCodec::decodeRequestView(pInBuf, view))
+		return false;
+	const google::protobuf::MethodDescriptor *pMethodDescriptor = pService->GetDescriptor()->method(view.methodIndex);
+	google::protobuf::Message *pReq = pService->GetRequestPrototype(pMethodDescriptor).New(pArena);
+	google::protobuf::Message *pResp = pService->GetResponsePrototype(pMethodDescriptor).New(pArena);
+	bool bOk = ProtocolCodec::parseFromEvbuffer(pInBuf, view.contentOffset, view.contentSize, pReq);
+	if (bOk)
+	{
+		RpcController controller;
+		pService->CallMethod(pMethodDescriptor, &controller, pReq, pResp, NULL);
+		bOk = ProtocolCodec::encodeResponse(pOutBuf, view.callId, *pResp);
+	}
+	if (NULL == pArena)
+	{
+		delete pReq;
+		delete pResp;
+	}
+	return bOk;
+}
+
+/************************************************************************
+  ܣһMessage䷽ʽÿ
+  
+	strBody룬лЭbody
+	bArena룬ǷʹArena
+	newPerReqÿoperator new
+	eventAllocPerReqÿlibeventڴ
+ֵ
+************************************************************************/
+void bench(const std::string &strBody, bool bArena, double &newPerReq, double &eventAllocPerReq)
+{
+	NumServiceImpl numService;
+	evbuffer *pInBuf = evbuffer_new();
+	evbuffer_add_reference(pInBuf, strBody.data(), strBody.size(), NULL, NULL);
+	evbuffer *pOutBuf = evbuffer_new();
+
+	std::vector<char> vecArenaBlock(ARENA_BLOCK_SIZE);
+	google::protobuf::ArenaOptions arenaOptions;
+	arenaOptions.initial_block = &vecArenaBlock[0];
+	arenaOptions.initial_block_size = vecArenaBlock.size();
+	google::protobuf::Arena arena(arenaOptions);
+
+	unsigned long newBegin = 0, eventAllocBegin = 0;
+	for (unsigned int i = 0; i < WARMUP_COUNT + REQUEST_COUNT; ++i)
+	{
+		if (WARMUP_COUNT == i)
+		{
+			newBegin = g_newCount.load();
+			eventAllocBegin = g_eventAllocCount.load();
+		}
+		if (bArena)
+			arena.Reset();
+		if (!handleRequest(&numService, pInBuf, pOutBuf, bArena ? &arena : NULL))
+			std::cerr << "handle request failed" << std::endl;
+		evbuffer_drain(pOutBuf, evbuffer_get_length(pOutBuf));
+	}
+	newPerReq = (double)(g_newCount.load() - newBegin) / REQUEST_COUNT;
+	eventAllocPerReq = (double)(g_eventAllocCount.load() - eventAllocBegin) / REQUEST_COUNT;
+
+	evbuffer_free(pOutBuf);
+	evbuffer_free(pInBuf);
+}
+
+int main()
+{
+	//libeventκڴ֮ǰ
+	event_set_mem_functions(eventMalloc, eventRealloc, eventFree);
+
+	testNamespace::NumRequest req;
+	req.set_input1(3);
+	req.set_input2(4);
+	ProtocolBodyRequest bodyReq;
+	bodyReq.set_servicename("NumService");
+	bodyReq.set_methodindex(0);
+	bodyReq.set_callid(1);
+	bodyReq.set_content(req.SerializeAsString());
+	std::string strBody = bodyReq.SerializeAsString();
+
+	double heapNew, heapEventAlloc, arenaNew, arenaEventAlloc;
+	bench(strBody, false, heapNew, heapEventAlloc);
+	bench(strBody, true, arenaNew, arenaEventAlloc);
+
+	std::cout << "mode     new/req    libevent alloc/req" << std::endl;
+	std::cout << "heap" << std::setw(11) << std::fixed << std::setprecision(3) << heapNew << std::setw(22) << heapEventAlloc << std::endl;
+	std::cout << "arena" << std::setw(10) << arenaNew << std::setw(22) << arenaEventAlloc << std::endl;
+
+	return 0;
+}
@@ -0,0 +1,134 @@
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <sstream>
+#include <algorithm>
+#include <climits>
+#include <boost/chrono.hpp>
+#include <event2/buffer.h>
+#include "ProtocolBody.pb.h"
+#include "ProtocolCodec.h"
+#include "Compressor.h"
+
+//ÿָشС
+#define TOTAL_BYTES (256 * 1024 * 1024)
+//ÿָشСٱ
+#define MIN_ROUNDS 20
+
+/************************************************************************
+  ܣѹķֵģظṹļ¼ɵĴӦ
+  
+	size룬ֵĴ³
+ֵֵ
+************************************************************************/
+ProtocolBodyResponse makeResponse(size_t size)
+{
+	std::ostringstream oss;
+	for (unsigned int i = 0; oss.tellp() < (std::streamoff)size; ++i)
+	{
+		oss << "{\"id\":" << i << ",\"name\":\"user" << i % 1000 << "\",\"status\":\""
+			<< (0 == i % 3 ? "active" : "inactive") << "\",\"score\":" << (i * 7919) % 100000 << "},";
+	}
+	ProtocolBodyResponse resp;
+	resp.set_callid(1);
+	resp.set_content(oss.str().substr(0, size));
+	return resp;
+}
+
+/************************************************************************
+  ܣһѹ㷨ڷ˱롢ͻ˽һӦĺʱ
+  
+	resp룬ֵ
+	compressType룬ѹ㷨
+	rounds룬
+	wireBytesϵֽЭhead
+	encodeUsÿα루ѹƽʱλΪ΢
+	decodeUsÿν루ѹƽʱλΪ΢
+ֵ
+	trueɹ
+	falseʧ
+************************************************************************/
+bool bench(const ProtocolBodyResponse &resp, unsigned char compressType, unsigned int rounds,
+	size_t &wireBytes, double &encodeUs, double &decodeUs)
+{
+	boost::chrono::duration<double, boost::micro> encodeTime(0);
+	boost::chrono::duration<double, boost::micro> decodeTime(0);
+	evbuffer *pInflateBuf = evbuffer_new();
+	bool bOk = true;
+	for (unsigned int i = 0; i < rounds && bOk; ++i)
+	{
+		evbuffer *pBuf = evbuffer_new();
+		boost::chrono::steady_clock::time_point begin = boost::chrono::steady_clock::now();
+		bOk = ProtocolCodec::encodeResponse(pBuf, 1, resp);
+		if (bOk && COMPRESS_NONE != compressType)
+			bOk = ProtocolCodec::compressBody(pBuf, compressType);
+		boost::chrono::steady_clock::time_point mid = boost::chrono::steady_clock::now();
+		encodeTime += mid - begin;
+		wireBytes = evbuffer_get_length(pBuf);
+
+		//ͻIOWorkerͬѹbodyѹõevbufferԻδѹbodyֱԻ
+		unsigned char arrHead[HEAD_SIZE];
+		evbuffer_remove(pBuf, arrHead, HEAD_SIZE);
+		size_t bodySize = evbuffer_get_length(pBuf);
+		unsigned char *pArr = NULL;
+		if (COMPRESS_NONE == compressType)
+			pArr = evbuffer_pullup(pBuf, -1);
+		else if (Compressor::decompress(arrHead[0] >> COMPRESS_TYPE_SHIFT, pBuf, 0, bodySize, pInflateBuf, INT_MAX))
+		{
+			bodySize = evbuffer_get_length(pInflateBuf);
+			pArr = evbuffer_pullup(pInflateBuf, -1);
+		}
+		ProtocolBodyResponse bodyResp;
+		bOk = bOk && NULL != pArr && bodyResp.ParseFromArray(pArr, (int)bodySize);
+		evbuffer_drain(pInflateBuf, evbuffer_get_length(pInflateBuf));
+		decodeTime += boost::chrono::steady_clock::now() - mid;
+		evbuffer_free(pBuf);
+	}
+	evbuffer_free(pInflateBuf);
+	encodeUs = encodeTime.count() / rounds;
+	decodeUs = decodeTime.count() / rounds;
+	return bOk;
+}
+
+int main()
+{
+	size_t arrPayloadSize[] = {100 * 1024, 512 * 1024, 2 * 1024 * 1024};
+	const char *arrName[] = {"none", "lz4", "zstd"};
+
+	//гαֵ֧ѹ㷨ѹΪ
+	unsigned char arrType[MAX_COMPRESS_TYPE_NUM + 1] = {COMPRESS_NONE};
+	unsigned int typeNum = 1;
+	for (unsigned char type = COMPRESS_LZ4; type <= COMPRESS_ZSTD; ++type)
+	{
+		if (Compressor::isSupported(type))
+			arrType[typeNum++] = type;
+	}
+
+	std::cout << "payload(B)  codec    wire(B)    ratio    encode(us/op)    decode(us/op)" << std::endl;
+	for (unsigned int i = 0; i < sizeof(arrPayloadSize) / sizeof(arrPayloadSize[0]); ++i)
+	{
+		ProtocolBodyResponse resp = makeResponse(arrPayloadSize[i]);
+		unsigned int rounds = std::max((unsigned int)MIN_ROUNDS, (unsigned int)(TOTAL_BYTES / arrPayloadSize[i] / 4));
+		size_t rawBytes = 0;
+		for (unsigned int j = 0; j < typeNum; ++j)
+		{
+			size_t wireBytes = 0;
+			double encodeUs = 0, decodeUs = 0;
+			if (!bench(resp, arrType[j], rounds, wireBytes, encodeUs, decodeUs))
+			{
+				std::cerr << arrName[arrType[j]] << " failed" << std::endl;
+				continue;
+			}
+			if (COMPRESS_NONE == arrType[j])
+				rawBytes = wireBytes;
+			std::cout << std::setw(10) << arrPayloadSize[i]
+				<< std::setw(7) << arrName[arrType[j]]
+				<< std::setw(11) << wireBytes
+				<< std::setw(9) << std::fixed << std::setprecision(2) << (double)rawBytes / wireBytes
+				<< std::setw(17) << encodeUs
+				<< std::setw(17) << decodeUs << std::endl;
+		}
+	}
+
+	return 0;
+}
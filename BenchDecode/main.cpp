@@ -0,0 +1,106 @@
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <algorithm>
+#include <boost/chrono.hpp>
+#include <event2/buffer.h>
+#include "ProtocolBody.pb.h"
+#include "ProtocolCodec.h"
+
+//ģ׽ֶʱevbufferڴĴС
+#define CHUNK_SIZE 4096
+//ÿָشС
+#define TOTAL_BYTES (256 * 1024 * 1024)
+//ÿָشСٽ
+#define MIN_ROUNDS 200
+
+/************************************************************************
+  ܣCHUNK_SIZEЭbody÷ʽֿevbufferģ׽ֶķɢڴ
+  
+	strBody룬лЭbody
+ֵevbufferָ
+************************************************************************/
+evbuffer *makeBuffer(const std::string &strBody)
+{
+	evbuffer *pBuf = evbuffer_new();
+	for (size_t pos = 0; pos < strBody.size(); pos += CHUNK_SIZE)
+	{
+		size_t len = std::min((size_t)CHUNK_SIZE, strBody.size() - pos);
+		evbuffer_add_reference(pBuf, strBody.data() + pos, len, NULL, NULL);
+	}
+	return pBuf;
+}
+
+//ԭеĽ뷽ʽpullupԻЭbodycontentٴcontent
+bool decodeByCopy(evbuffer *pBuf, ProtocolBodyResponse &inner)
+{
+	size_t len = evbuffer_get_length(pBuf);
+	ProtocolBodyRequest bodyReq;
+	if (!bodyReq.ParseFromArray(evbuffer_pullup(pBuf, len), len))
+		return false;
+	return inner.ParseFromString(bodyReq.content());
+}
+
+//㿽Ľ뷽ʽЭbodyͼֱevbufferڴϽ
+bool decodeByView(evbuffer *pBuf, ProtocolBodyResponse &inner)
+{
+	RequestView view;
+	if (!ProtocolCodec::decodeRequestView(pBuf, view))
+		return false;
+	return ProtocolCodec::parseFromEvbuffer(pBuf, view.contentOffset, view.contentSize, &inner);
+}
+
+/************************************************************************
+  ܣһֽ뷽ʽĺʱ
+  
+	strBody룬лЭbody
+	rounds룬
+	decode룬뺯
+ֵÿνƽʱλΪ΢
+************************************************************************/
+double bench(const std::string &strBody, unsigned int rounds, bool (*decode)(evbuffer *, ProtocolBodyResponse &))
+{
+	boost::chrono::steady_clock::time_point begin = boost::chrono::steady_clock::now();
+	for (unsigned int i = 0; i < rounds; ++i)
+	{
+		//ÿζ¹ֿevbufferΪpullupıevbufferڴ沼
+		evbuffer *pBuf = makeBuffer(strBody);
+		ProtocolBodyResponse inner;
+		if (!decode(pBuf, inner))
+			std::cerr << "decode failed" << std::endl;
+		evbuffer_free(pBuf);
+	}
+	boost::chrono::duration<double, boost::micro> us = boost::chrono::steady_clock::now() - begin;
+	return us.count() / rounds;
+}
+
+int main()
+{
+	size_t arrPayloadSize[] = {1024, 64 * 1024, 1024 * 1024};
+
+	std::cout << "payload(B)    copy(us/op)    view(us/op)    copy(MB/s)    view(MB/s)" << std::endl;
+	for (unsigned int i = 0; i < sizeof(arrPayloadSize) / sizeof(arrPayloadSize[0]); ++i)
+	{
+		//һЯpayloadMessageģ
+		ProtocolBodyResponse inner;
+		inner.set_callid(1);
+		inner.set_content(std::string(arrPayloadSize[i], 'x'));
+		ProtocolBodyRequest bodyReq;
+		bodyReq.set_servicename("TestService");
+		bodyReq.set_methodindex(0);
+		bodyReq.set_callid(1);
+		bodyReq.set_content(inner.SerializeAsString());
+		std::string strBody = bodyReq.SerializeAsString();
+
+		unsigned int rounds = std::max((unsigned int)MIN_ROUNDS, (unsigned int)(TOTAL_BYTES / strBody.size()));
+		double copyUs = bench(strBody, rounds, decodeByCopy);
+		double viewUs = bench(strBody, rounds, decodeByView);
+		std::cout << std::setw(10) << arrPayloadSize[i]
+			<< std::setw(15) << std::fixed << std::setprecision(2) << copyUs
+			<< std::setw(15) << viewUs
+			<< std::setw(14) << std::setprecision(0) << strBody.size() / copyUs
+			<< std::setw(14) << strBody.size() / viewUs << std::endl;
+	}
+
+	return 0;
+}
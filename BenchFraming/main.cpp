@@ -0,0 +1,121 @@
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <algorithm>
+#include <boost/chrono.hpp>
+#include <event2/buffer.h>
+#include "ProtocolCodec.h"
+
+//ģ׽ֶʱevbufferڴĴСhead᲻ʱԽڴ
+#define CHUNK_SIZE 4096
+//ÿֽЭ
+#define FRAME_COUNT 200000
+//
+#define ROUNDS 20
+
+/************************************************************************
+  ܣCHUNK_SIZEЭ÷ʽֿevbufferģ׽ֶķɢڴ
+  
+	strData룬ĶЭ
+ֵevbufferָ
+************************************************************************/
+evbuffer *makeBuffer(const std::string &strData)
+{
+	evbuffer *pBuf = evbuffer_new();
+	for (size_t pos = 0; pos < strData.size(); pos += CHUNK_SIZE)
+	{
+		size_t len = std::min((size_t)CHUNK_SIZE, strData.size() - pos);
+		evbuffer_add_reference(pBuf, strData.data() + pos, len, NULL, NULL);
+	}
+	return pBuf;
+}
+
+/************************************************************************
+  ܣĶЭݣbodyȡСе֮ѭ
+  
+	version룬Эheadİ汾
+ֵЭ
+************************************************************************/
+std::string makeFrames(unsigned char version)
+{
+	static const bodySize_t arrBodySize[] = {0, 4, 60, 200, 1500};
+	std::string strData;
+	for (unsigned int i = 0; i < FRAME_COUNT; ++i)
+	{
+		bodySize_t bodySize = arrBodySize[i % (sizeof(arrBodySize) / sizeof(arrBodySize[0]))];
+		unsigned char arrHead[HEAD_MAX_SIZE];
+		size_t headSize = ProtocolCodec::encodeHead(arrHead, version, DATA_TYPE_REQUEST, COMPRESS_NONE, bodySize);
+		strData.append((const char *)arrHead, headSize);
+		strData.append(bodySize, 'x');
+	}
+	return strData;
+}
+
+//ԭеĽʽpullupԻheadδָתȡbody
+size_t parseByPullup(evbuffer *pBuf)
+{
+	size_t count = 0;
+	while (evbuffer_get_length(pBuf) >= HEAD_SIZE)
+	{
+		unsigned char *pArr = evbuffer_pullup(pBuf, HEAD_SIZE);
+		bodySize_t bodySize = *((bodySize_t *)(pArr + 1));
+		evbuffer_drain(pBuf, HEAD_SIZE + bodySize);
+		++count;
+	}
+	return count;
+}
+
+//ڵĽʽheadջϣ1ְֽ汾
+size_t parseByPeek(evbuffer *pBuf)
+{
+	size_t count = 0;
+	FrameHead head;
+	while (HEAD_DECODE_OK == ProtocolCodec::peekHead(pBuf, head))
+	{
+		evbuffer_drain(pBuf, head.headSize + head.extSize + head.bodySize);
+		++count;
+	}
+	return count;
+}
+
+/************************************************************************
+  ܣһֽʽĺʱֻƽƹevbuffer
+  
+	strData룬ĶЭ
+	parse룬ؽЭ
+ֵÿЭݵƽʱλΪ
+************************************************************************/
+double bench(const std::string &strData, size_t (*parse)(evbuffer *))
+{
+	boost::chrono::duration<double, boost::nano> total(0);
+	for (unsigned int i = 0; i < ROUNDS; ++i)
+	{
+		evbuffer *pBuf = makeBuffer(strData);
+		boost::chrono::steady_clock::time_point begin = boost::chrono::steady_clock::now();
+		size_t count = parse(pBuf);
+		total += boost::chrono::steady_clock::now() - begin;
+		if (FRAME_COUNT != count)
+			std::cerr << "parse failed: " << count << std::endl;
+		evbuffer_free(pBuf);
+	}
+	return total.count() / ((double)ROUNDS * FRAME_COUNT);
+}
+
+int main()
+{
+	std::string strV1 = makeFrames(PROTOCOL_V1);
+	std::string strV2 = makeFrames(PROTOCOL_V2);
+
+	std::cout << "method           head(B/frame)    parse(ns/frame)" << std::endl;
+	std::cout << std::fixed << std::setprecision(2);
+	std::cout << "v1 pullup" << std::setw(20) << (double)HEAD_SIZE
+		<< std::setw(19) << bench(strV1, parseByPullup) << std::endl;
+	std::cout << "v1 peekHead" << std::setw(18) << (double)HEAD_SIZE
+		<< std::setw(19) << bench(strV1, parseByPeek) << std::endl;
+	//v2 headƽȣܳȼȥbodyܳ
+	double v2HeadSize = HEAD_SIZE - (double)(strV1.size() - strV2.size()) / FRAME_COUNT;
+	std::cout << "v2 peekHead" << std::setw(18) << v2HeadSize
+		<< std::setw(19) << bench(strV2, parseByPeek) << std::endl;
+
+	return 0;
+}
@@ -0,0 +1,132 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <list>
+#include <boost/thread/thread.hpp>
+#include <boost/chrono.hpp>
+#include "SyncQueue.h"
+#include "RingQueue.h"
+
+//ÿֲԴݵϢ
+#define MSG_COUNT 2000000
+//󳤶
+#define QUEUE_MAX_SIZE 1024
+//ȡֵ
+#define BATCH_SIZE 64
+
+//SyncQueue
+void syncQueueProducer(SyncQueue<int *> *pQueue, unsigned int count)
+{
+	int *p = NULL;
+	for (unsigned int i = 0; i < count; ++i)
+	{
+		//óCPU
+		while (!pQueue->put(p))
+			boost::this_thread::yield();
+	}
+}
+
+//RingQueue
+void ringQueueProducer(RingQueue<int *> *pQueue, unsigned int count)
+{
+	int *p = NULL;
+	for (unsigned int i = 0; i < count; ++i)
+	{
+		//óCPU
+		while (!pQueue->put(p))
+			boost::this_thread::yield();
+	}
+}
+
+/************************************************************************
+  ܣSyncQueueڵǰ߳
+  
+	producerNum룬߳
+ֵÿ봫ݵϢ
+************************************************************************/
+double benchSyncQueue(unsigned int producerNum)
+{
+	SyncQueue<int *> queue((unsigned int)QUEUE_MAX_SIZE);
+	unsigned int countPerProducer = MSG_COUNT / producerNum;
+	unsigned int total = countPerProducer * producerNum;
+
+	boost::chrono::steady_clock::time_point begin = boost::chrono::steady_clock::now();
+	std::vector<boost::thread *> vecThd;
+	for (unsigned int i = 0; i < producerNum; ++i)
+		vecThd.push_back(new boost::thread(syncQueueProducer, &queue, countPerProducer));
+
+	unsigned int received = 0;
+	std::list<int *> lst;
+	while (received < total)
+	{
+		if (queue.takeAll(lst))
+		{
+			received += lst.size();
+			lst.clear();
+		}
+		else
+			boost::this_thread::yield();
+	}
+	boost::chrono::duration<double> sec = boost::chrono::steady_clock::now() - begin;
+
+	for (auto it = vecThd.begin(); it != vecThd.end(); ++it)
+	{
+		(*it)->join();
+		delete *it;
+	}
+	return total / sec.count();
+}
+
+/************************************************************************
+  ܣRingQueueڵǰ߳
+  
+	producerNum룬߳
+ֵÿ봫ݵϢ
+************************************************************************/
+double benchRingQueue(unsigned int producerNum)
+{
+	RingQueue<int *> queue(QUEUE_MAX_SIZE);
+	unsigned int countPerProducer = MSG_COUNT / producerNum;
+	unsigned int total = countPerProducer * producerNum;
+
+	boost::chrono::steady_clock::time_point begin = boost::chrono::steady_clock::now();
+	std::vector<boost::thread *> vecThd;
+	for (unsigned int i = 0; i < producerNum; ++i)
+		vecThd.push_back(new boost::thread(ringQueueProducer, &queue, countPerProducer));
+
+	unsigned int received = 0;
+	int *arr[BATCH_SIZE];
+	while (received < total)
+	{
+		unsigned int count = queue.takeBatch(arr, BATCH_SIZE);
+		if (count > 0)
+			received += count;
+		else
+			boost::this_thread::yield();
+	}
+	boost::chrono::duration<double> sec = boost::chrono::steady_clock::now() - begin;
+
+	for (auto it = vecThd.begin(); it != vecThd.end(); ++it)
+	{
+		(*it)->join();
+		delete *it;
+	}
+	return total / sec.count();
+}
+
+int main()
+{
+	unsigned int arrProducerNum[] = {1, 2, 4, 8};
+
+	std::cout << "producers    SyncQueue(msgs/s)    RingQueue(msgs/s)" << std::endl;
+	for (unsigned int i = 0; i < sizeof(arrProducerNum) / sizeof(arrProducerNum[0]); ++i)
+	{
+		double syncRate = benchSyncQueue(arrProducerNum[i]);
+		double ringRate = benchRingQueue(arrProducerNum[i]);
+		std::cout << std::setw(9) << arrProducerNum[i]
+			<< std::setw(21) << std::fixed << std::setprecision(0) << syncRate
+			<< std::setw(21) << ringRate << std::endl;
+	}
+
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,160 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <list>
+#include <atomic>
+#include <boost/thread/thread.hpp>
+#include <boost/chrono.hpp>
+#include <event2/event.h>
+#include "SyncQueue.h"
+#include "MpscQueue.h"
+#include "Notifier.h"
+
+//ÿֲύĵ
+#define MSG_COUNT 1000000
+//󳤶ȣ㹻󣬲в
+#define QUEUE_MAX_SIZE 100000000
+
+//ģͻ˵ãʽͨpNext
+struct BenchCall
+{
+	BenchCall *pNext;
+	unsigned int value;
+};
+
+//ģͻIOWorker¼ѭ֪ͨѺȡе
+//QueueΪSyncQueue<BenchCall *>MpscQueue<BenchCall, &BenchCall::pNext>
+template<typename Queue>
+struct BenchWorker
+{
+	Queue queue;
+	Notifier notifier;
+	event_base *pEvBase;
+	unsigned int total;
+	unsigned int received;
+	//ѵĴ¼ѭ֪ͨĴ
+	unsigned int wakeups;
+	//ǷѾͬʱʼ
+	std::atomic<bool> bGo;
+
+	BenchWorker(unsigned int totalCount)
+	{
+		queue.setMaxSize(QUEUE_MAX_SIZE);
+		pEvBase = NULL;
+		total = totalCount;
+		received = 0;
+		wakeups = 0;
+		bGo.store(false);
+	}
+};
+
+//SyncQueueȡе
+unsigned int drain(SyncQueue<BenchCall *> &queue)
+{
+	std::list<BenchCall *> lst;
+	queue.takeAll(lst);
+	return lst.size();
+}
+
+//MpscQueueȡе
+unsigned int drain(MpscQueue<BenchCall, &BenchCall::pNext> &queue)
+{
+	unsigned int count = 0;
+	for (BenchCall *pCall = queue.takeAll(); NULL != pCall; pCall = pCall->pNext)
+		++count;
+	return count;
+}
+
+template<typename Queue>
+void notifiedCallback(evutil_socket_t fd, short events, void *pArg)
+{
+	BenchWorker<Queue> *pWorker = (BenchWorker<Queue> *)pArg;
+	//IOWorker֪ͬͨȡе
+	pWorker->notifier.consume();
+	++pWorker->wakeups;
+	pWorker->received += drain(pWorker->queue);
+	if (pWorker->received >= pWorker->total)
+		event_base_loopbreak(pWorker->pEvBase);
+}
+
+//SyncQueueύʽĶǰRpcChannel::CallMethod()ͬк֪ͨ
+void put(SyncQueue<BenchCall *> &queue, BenchCall *pCall)
+{
+	queue.put(pCall);
+}
+
+//MpscQueueύʽк֪ͨ
+void put(MpscQueue<BenchCall, &BenchCall::pNext> &queue, BenchCall *pCall)
+{
+	queue.put(pCall);
+}
+
+template<typename Queue>
+void producer(BenchWorker<Queue> *pWorker, BenchCall *pCalls, unsigned int count)
+{
+	while (!pWorker->bGo.load())
+		boost::this_thread::yield();
+	for (unsigned int i = 0; i < count; ++i)
+	{
+		put(pWorker->queue, &pCalls[i]);
+		pWorker->notifier.notify();
+	}
+}
+
+/************************************************************************
+  ܣԵύ¼ѭڵǰ߳
+  
+	producerNum룬ύõû߳
+	wakeups߱ѵĴ
+ֵÿύĵ
+************************************************************************/
+template<typename Queue>
+double benchSubmit(unsigned int producerNum, unsigned int &wakeups)
+{
+	unsigned int countPerProducer = MSG_COUNT / producerNum;
+	BenchWorker<Queue> worker(countPerProducer * producerNum);
+	std::vector<BenchCall> vecCall(countPerProducer * producerNum);
+
+	worker.pEvBase = event_base_new();
+	event *pEv = event_new(worker.pEvBase, worker.notifier.getFd(), EV_READ | EV_PERSIST, notifiedCallback<Queue>, &worker);
+	event_add(pEv, NULL);
+
+	std::vector<boost::thread *> vecThd;
+	for (unsigned int i = 0; i < producerNum; ++i)
+		vecThd.push_back(new boost::thread(producer<Queue>, &worker, &vecCall[i * countPerProducer], countPerProducer));
+
+	boost::chrono::steady_clock::time_point begin = boost::chrono::steady_clock::now();
+	worker.bGo.store(true);
+	event_base_dispatch(worker.pEvBase);
+	boost::chrono::duration<double> sec = boost::chrono::steady_clock::now() - begin;
+
+	for (auto it = vecThd.begin(); it != vecThd.end(); ++it)
+	{
+		(*it)->join();
+		delete *it;
+	}
+	event_free(pEv);
+	event_base_free(worker.pEvBase);
+	wakeups = worker.wakeups;
+	return worker.total / sec.count();
+}
+
+int main()
+{
+	unsigned int arrProducerNum[] = {1, 2, 4, 8, 16, 32, 64};
+
+	std::cout << "threads    SyncQueue(calls/s)  wakeups    MpscQueue(calls/s)  wakeups" << std::endl;
+	for (unsigned int i = 0; i < sizeof(arrProducerNum) / sizeof(arrProducerNum[0]); ++i)
+	{
+		unsigned int syncWakeups, mpscWakeups;
+		double syncRate = benchSubmit<SyncQueue<BenchCall *> >(arrProducerNum[i], syncWakeups);
+		double mpscRate = benchSubmit<MpscQueue<BenchCall, &BenchCall::pNext> >(arrProducerNum[i], mpscWakeups);
+		std::cout << std::setw(7) << arrProducerNum[i]
+			<< std::setw(22) << std::fixed << std::setprecision(0) << syncRate
+			<< std::setw(9) << syncWakeups
+			<< std::setw(22) << mpscRate
+			<< std::setw(9) << mpscWakeups << std::endl;
+	}
+
+	return 0;
+}
@@ -0,0 +1,119 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <algorithm>
+#include <atomic>
+#include <boost/thread/thread.hpp>
+#include <boost/chrono.hpp>
+#include "Test.pb.h"
+#include "IRpcClient.h"
+#include "IRpcChannel.h"
+#include "RpcController.h"
+
+//ʹõķַTestRpcServer
+#define BENCH_IP "127.0.0.1"
+#define BENCH_PORT 8888
+//ÿ̵߳ͬô
+#define CALLS_PER_THREAD 5000
+//RpcChannel
+#define BENCH_MAX_CONN_NUM 4
+
+//ʧܵĵ
+std::atomic<unsigned long> g_badCount;
+
+/************************************************************************
+  ܣ߳ڹRpcChannelϷͬã¼ÿεõĺʱ
+  
+	pChannel룬е̹߳RpcChannel
+	id룬̱߳
+	pVecLatencyÿεõĺʱλΪ΢
+ֵ
+************************************************************************/
+void callerMain(IRpcChannel *pChannel, int id, std::vector<double> *pVecLatency)
+{
+	testNamespace::NumService::Stub numServiceStub((google::protobuf::RpcChannel *)pChannel);
+	for (int i = 0; i < CALLS_PER_THREAD; ++i)
+	{
+		testNamespace::NumRequest req;
+		req.set_input1(i);
+		req.set_input2(id);
+		testNamespace::NumResponse resp;
+		RpcController controller;
+
+		boost::chrono::steady_clock::time_point begin = boost::chrono::steady_clock::now();
+		numServiceStub.add(&controller, &req, &resp, NULL);
+		boost::chrono::duration<double, boost::micro> us = boost::chrono::steady_clock::now() - begin;
+		pVecLatency->push_back(us.count());
+
+		//̹߳RpcChannelʱѴ̻߳ᵼ¶δõĳ
+		if (controller.Failed() || resp.output() != i + id)
+			++g_badCount;
+	}
+}
+
+/************************************************************************
+  ܣԶ̹߳һRpcChannelʱͬӳ
+  
+	pIClient룬RpcClientָ
+	threadNum룬߳
+	maxConnNum룬RpcChannel
+ֵ
+************************************************************************/
+void benchSyncCall(IRpcClient *pIClient, unsigned int threadNum, unsigned int maxConnNum)
+{
+	IRpcChannel *pChannel = IRpcChannel::createRpcChannel(pIClient, BENCH_IP, BENCH_PORT, maxConnNum);
+	g_badCount.store(0);
+
+	std::vector<std::vector<double> > vecLatency(threadNum);
+	boost::chrono::steady_clock::time_point begin = boost::chrono::steady_clock::now();
+	std::vector<boost::thread *> vecThd;
+	for (unsigned int i = 0; i < threadNum; ++i)
+		vecThd.push_back(new boost::thread(callerMain, pChannel, (int)i, &vecLatency[i]));
+	for (auto it = vecThd.begin(); it != vecThd.end(); ++it)
+	{
+		(*it)->join();
+		delete *it;
+	}
+	boost::chrono::duration<double> sec = boost::chrono::steady_clock::now() - begin;
+
+	std::vector<double> vecAll;
+	for (auto it = vecLatency.begin(); it != vecLatency.end(); ++it)
+		vecAll.insert(vecAll.end(), it->begin(), it->end());
+	std::sort(vecAll.begin(), vecAll.end());
+	double sum = 0;
+	for (auto it = vecAll.begin(); it != vecAll.end(); ++it)
+		sum += *it;
+
+	std::cerr << std::setw(7) << threadNum << std::setw(9) << maxConnNum
+		<< std::setw(12) << std::fixed << std::setprecision(1) << sum / vecAll.size()
+		<< std::setw(12) << vecAll[vecAll.size() / 2]
+		<< std::setw(12) << vecAll[vecAll.size() * 99 / 100]
+		<< std::setw(14) << std::setprecision(0) << vecAll.size() / sec.count()
+		<< std::setw(8) << g_badCount.load() << std::endl;
+
+	IRpcChannel::releaseRpcChannel(pChannel);
+}
+
+int main()
+{
+	timeval heartbeatInterval;
+	heartbeatInterval.tv_sec = 5;
+	heartbeatInterval.tv_usec = 0;
+	//IOWorkerһ£ӵRpcChannel԰ӷֲÿIOWorker
+	IRpcClient *pIClient = IRpcClient::createRpcClient(BENCH_MAX_CONN_NUM, 10240, heartbeatInterval);
+	pIClient->start();
+
+	//ͻڷPINGʱ׼ӡ־Խӡ׼
+	unsigned int arrThreadNum[] = {1, 2, 4, 8};
+	std::cerr << "threads  maxconn     avg(us)     p50(us)     p99(us)     calls/s     bad" << std::endl;
+	for (unsigned int i = 0; i < sizeof(arrThreadNum) / sizeof(arrThreadNum[0]); ++i)
+	{
+		benchSyncCall(pIClient, arrThreadNum[i], 1);
+		if (arrThreadNum[i] > 1)
+			benchSyncCall(pIClient, arrThreadNum[i], BENCH_MAX_CONN_NUM);
+	}
+
+	pIClient->end();
+	IRpcClient::releaseRpcClient(pIClient);
+	return 0;
+}
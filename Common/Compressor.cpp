@@ -0,0 +1,469 @@
+#include "Compressor.h"
+#include "EvbufferStream.h"
+#include <cstring>
+#include <algorithm>
+#ifdef RPC_WITH_LZ4
+#include <lz4frame.h>
+#endif
+#ifdef RPC_WITH_ZSTD
+#include <zstd.h>
+#endif
+
+//evbufferĩβԤڴ飬ѹֱдУдύԤһ
+class OutputBlock
+{
+public:
+	OutputBlock(evbuffer *pBuf)
+	{
+		m_pBuf = pBuf;
+		m_bReserved = false;
+		m_used = 0;
+		m_total = 0;
+	}
+
+	~OutputBlock()
+	{
+		commit();
+	}
+
+	//ύǰ飬Ԥsizeֽڵڴ
+	bool reserve(size_t size)
+	{
+		if (!commit())
+			return false;
+		if (1 != evbuffer_reserve_space(m_pBuf, (ev_ssize_t)size, &m_iov, 1))
+			return false;
+		m_bReserved = true;
+		m_used = 0;
+		return true;
+	}
+
+	//дλ
+	char *data()
+	{
+		return (char *)m_iov.iov_base + m_used;
+	}
+
+	//ǰʣĿд
+	size_t avail()
+	{
+		return m_bReserved ? m_iov.iov_len - m_used : 0;
+	}
+
+	//дnֽ
+	void produce(size_t n)
+	{
+		m_used += n;
+		m_total += n;
+	}
+
+	//дܳ
+	size_t total()
+	{
+		return m_total;
+	}
+
+	//ύǰдĲ
+	bool commit()
+	{
+		if (!m_bReserved)
+			return true;
+		m_bReserved = false;
+		if (0 == m_used)
+			return true;
+		m_iov.iov_len = m_used;
+		return 0 == evbuffer_commit_space(m_pBuf, &m_iov, 1);
+	}
+
+private:
+	OutputBlock(const OutputBlock &);
+	OutputBlock &operator=(const OutputBlock &);
+
+	evbuffer *m_pBuf;
+	evbuffer_iovec m_iov;
+	bool m_bReserved;
+	//ǰдĳ
+	size_t m_used;
+	//дܳ
+	size_t m_total;
+};
+
+#ifdef RPC_WITH_LZ4
+//ÿ̵߳LZ4ģ߳̽ʱͷ
+struct Lz4Context
+{
+	LZ4F_cctx *pCCtx;
+	LZ4F_dctx *pDCtx;
+
+	Lz4Context()
+	{
+		pCCtx = NULL;
+		pDCtx = NULL;
+		if (LZ4F_isError(LZ4F_createCompressionContext(&pCCtx, LZ4F_VERSION)))
+			pCCtx = NULL;
+		if (LZ4F_isError(LZ4F_createDecompressionContext(&pDCtx, LZ4F_VERSION)))
+			pDCtx = NULL;
+	}
+
+	~Lz4Context()
+	{
+		if (NULL != pCCtx)
+			LZ4F_freeCompressionContext(pCCtx);
+		if (NULL != pDCtx)
+			LZ4F_freeDecompressionContext(pDCtx);
+	}
+};
+
+static Lz4Context &getLz4Context()
+{
+	static thread_local Lz4Context context;
+	return context;
+}
+
+static bool lz4Compress(evbuffer *pSrc, size_t offset, size_t len, evbuffer *pDst)
+{
+	LZ4F_cctx *pCtx = getLz4Context().pCCtx;
+	if (NULL == pCtx)
+		return false;
+
+	//֡ͷдԭʼȣѹ˾ݴһԤڴ
+	LZ4F_preferences_t prefs;
+	memset(&prefs, 0, sizeof(prefs));
+	prefs.frameInfo.blockSizeID = LZ4F_max64KB;
+	prefs.frameInfo.contentSize = len;
+
+	OutputBlock out(pDst);
+	if (!out.reserve(std::max((size_t)COMPRESS_BLOCK_SIZE, (size_t)LZ4F_HEADER_SIZE_MAX)))
+		return false;
+	size_t ret = LZ4F_compressBegin(pCtx, out.data(), out.avail(), &prefs);
+	if (LZ4F_isError(ret))
+		return false;
+	out.produce(ret);
+
+	//밴evbufferڴ룬ÿβһԤ飬Ա֤޿Ԥ
+	EvbufferInputStream in(pSrc, offset, len);
+	const void *pData;
+	int size;
+	size_t inLen = 0;
+	while (in.Next(&pData, &size))
+	{
+		inLen += size;
+		const char *p = (const char *)pData;
+		size_t remain = size;
+		while (remain > 0)
+		{
+			size_t n = std::min(remain, (size_t)COMPRESS_BLOCK_SIZE);
+			size_t bound = LZ4F_compressBound(n, &prefs);
+			if (out.avail() < bound && !out.reserve(std::max(bound, (size_t)COMPRESS_BLOCK_SIZE)))
+				return false;
+			ret = LZ4F_compressUpdate(pCtx, out.data(), out.avail(), p, n, NULL);
+			if (LZ4F_isError(ret))
+				return false;
+			out.produce(ret);
+			p += n;
+			remain -= n;
+		}
+	}
+	if (inLen != len)
+		return false;
+
+	//дݺ֡β
+	size_t bound = LZ4F_compressBound(0, &prefs);
+	if (out.avail() < bound && !out.reserve(bound))
+		return false;
+	ret = LZ4F_compressEnd(pCtx, out.data(), out.avail(), NULL);
+	if (LZ4F_isError(ret))
+		return false;
+	out.produce(ret);
+	return out.commit();
+}
+
+static bool lz4Decompress(evbuffer *pSrc, size_t offset, size_t len, evbuffer *pDst, size_t maxLen)
+{
+	LZ4F_dctx *pCtx = getLz4Context().pDCtx;
+	if (NULL == pCtx)
+		return false;
+	//һνѹ쳣;ʧܣ
+	LZ4F_resetDecompressionContext(pCtx);
+
+	OutputBlock out(pDst);
+	EvbufferInputStream in(pSrc, offset, len);
+	const void *pData;
+	int size;
+	size_t inLen = 0;
+	size_t reserveSize = COMPRESS_BLOCK_SIZE;
+	bool bFirst = true;
+	bool bDone = false;
+	while (!bDone && in.Next(&pData, &size))
+	{
+		inLen += size;
+		const char *p = (const char *)pData;
+		size_t remain = size;
+		//һ֡ͷʱȡԭʼȣһԤͰԭʼԤڴ
+		if (bFirst && remain >= LZ4F_HEADER_SIZE_MAX)
+		{
+			LZ4F_frameInfo_t info;
+			size_t consumed = remain;
+			if (LZ4F_isError(LZ4F_getFrameInfo(pCtx, &info, p, &consumed)))
+				return false;
+			//ԭʼȳʱעʧܣֻѹͷһֹͣµĿͷֹ߶λ
+			if (info.contentSize > maxLen)
+				maxLen = std::min(maxLen, (size_t)COMPRESS_BLOCK_SIZE);
+			else if (info.contentSize > 0)
+				reserveSize = info.contentSize;
+			p += consumed;
+			remain -= consumed;
+		}
+		bFirst = false;
+
+		while (true)
+		{
+			if (0 == out.avail())
+			{
+				if (!out.reserve(reserveSize))
+					return false;
+				reserveSize = COMPRESS_BLOCK_SIZE;
+			}
+			size_t avail = out.avail();
+			size_t dstSize = avail;
+			size_t srcSize = remain;
+			size_t ret = LZ4F_decompress(pCtx, out.data(), &dstSize, p, &srcSize, NULL);
+			if (LZ4F_isError(ret))
+				return false;
+			out.produce(dstSize);
+			if (out.total() > maxLen)
+				return false;
+			p += srcSize;
+			remain -= srcSize;
+			//0ʾ֡ѽѹ
+			if (0 == ret)
+			{
+				bDone = true;
+				break;
+			}
+			//ûдҪһ
+			if (0 == remain && dstSize < avail)
+				break;
+		}
+		//֡治ж
+		if (bDone && remain > 0)
+			return false;
+	}
+	return bDone && inLen == len && out.commit();
+}
+#endif
+
+#ifdef RPC_WITH_ZSTD
+//ÿ̵߳zstdģ߳̽ʱͷ
+struct ZstdContext
+{
+	ZSTD_CCtx *pCCtx;
+	ZSTD_DCtx *pDCtx;
+
+	ZstdContext()
+	{
+		pCCtx = ZSTD_createCCtx();
+		pDCtx = ZSTD_createDCtx();
+		//ѹûỰֻһ
+		if (NULL != pCCtx)
+			ZSTD_CCtx_setParameter(pCCtx, ZSTD_c_compressionLevel, ZSTD_COMPRESS_LEVEL);
+	}
+
+	~ZstdContext()
+	{
+		if (NULL != pCCtx)
+			ZSTD_freeCCtx(pCCtx);
+		if (NULL != pDCtx)
+			ZSTD_freeDCtx(pDCtx);
+	}
+};
+
+static ZstdContext &getZstdContext()
+{
+	static thread_local ZstdContext context;
+	return context;
+}
+
+static bool zstdCompress(evbuffer *pSrc, size_t offset, size_t len, evbuffer *pDst)
+{
+	ZSTD_CCtx *pCtx = getZstdContext().pCCtx;
+	if (NULL == pCtx)
+		return false;
+	//һѹ;ʧܣûỰԤȸ֪ԭʼȣд֡ͷѹ˾ݴһԤڴ
+	ZSTD_CCtx_reset(pCtx, ZSTD_reset_session_only);
+	if (ZSTD_isError(ZSTD_CCtx_setPledgedSrcSize(pCtx, len)))
+		return false;
+
+	OutputBlock out(pDst);
+	EvbufferInputStream in(pSrc, offset, len);
+	const void *pData;
+	int size;
+	size_t inLen = 0;
+	while (in.Next(&pData, &size))
+	{
+		inLen += size;
+		ZSTD_inBuffer input = {pData, (size_t)size, 0};
+		while (input.pos < input.size)
+		{
+			if (0 == out.avail() && !out.reserve(COMPRESS_BLOCK_SIZE))
+				return false;
+			ZSTD_outBuffer output = {out.data(), out.avail(), 0};
+			if (ZSTD_isError(ZSTD_compressStream2(pCtx, &output, &input, ZSTD_e_continue)))
+				return false;
+			out.produce(output.pos);
+		}
+	}
+	if (inLen != len)
+		return false;
+
+	//дݺ֡β0ʾȫд
+	ZSTD_inBuffer input = {NULL, 0, 0};
+	size_t ret;
+	do
+	{
+		if (0 == out.avail() && !out.reserve(COMPRESS_BLOCK_SIZE))
+			return false;
+		ZSTD_outBuffer output = {out.data(), out.avail(), 0};
+		ret = ZSTD_compressStream2(pCtx, &output, &input, ZSTD_e_end);
+		if (ZSTD_isError(ret))
+			return false;
+		out.produce(output.pos);
+	} while (0 != ret);
+	return out.commit();
+}
+
+static bool zstdDecompress(evbuffer *pSrc, size_t offset, size_t len, evbuffer *pDst, size_t maxLen)
+{
+	ZSTD_DCtx *pCtx = getZstdContext().pDCtx;
+	if (NULL == pCtx)
+		return false;
+	ZSTD_DCtx_reset(pCtx, ZSTD_reset_session_only);
+
+	OutputBlock out(pDst);
+	EvbufferInputStream in(pSrc, offset, len);
+	const void *pData;
+	int size;
+	size_t inLen = 0;
+	size_t reserveSize = COMPRESS_BLOCK_SIZE;
+	bool bFirst = true;
+	bool bDone = false;
+	while (!bDone && in.Next(&pData, &size))
+	{
+		inLen += size;
+		//һ֡ͷʱȡԭʼȣһԤͰԭʼԤڴ
+		if (bFirst)
+		{
+			unsigned long long contentSize = ZSTD_getFrameContentSize(pData, size);
+			if (ZSTD_CONTENTSIZE_UNKNOWN != contentSize && ZSTD_CONTENTSIZE_ERROR != contentSize)
+			{
+				//ԭʼȳʱעʧܣֻѹͷһֹͣµĿͷֹ߶λ
+				if (contentSize > maxLen)
+					maxLen = std::min(maxLen, (size_t)COMPRESS_BLOCK_SIZE);
+				else if (contentSize > 0)
+					reserveSize = (size_t)contentSize;
+			}
+			bFirst = false;
+		}
+
+		ZSTD_inBuffer input = {pData, (size_t)size, 0};
+		while (true)
+		{
+			if (0 == out.avail())
+			{
+				if (!out.reserve(reserveSize))
+					return false;
+				reserveSize = COMPRESS_BLOCK_SIZE;
+			}
+			ZSTD_outBuffer output = {out.data(), out.avail(), 0};
+			size_t ret = ZSTD_decompressStream(pCtx, &output, &input);
+			if (ZSTD_isError(ret))
+				return false;
+			out.produce(output.pos);
+			if (out.total() > maxLen)
+				return false;
+			//0ʾ֡ѽѹɲȫд
+			if (0 == ret)
+			{
+				bDone = true;
+				break;
+			}
+			//ûдҪһ
+			if (input.pos == input.size && output.pos < output.size)
+				break;
+		}
+		//֡治ж
+		if (bDone && input.pos < input.size)
+			return false;
+	}
+	return bDone && inLen == len && out.commit();
+}
+#endif
+
+unsigned int Compressor::getSupportedTypes(unsigned char *pArr)
+{
+	unsigned int num = 0;
+#ifdef RPC_WITH_ZSTD
+	pArr[num++] = COMPRESS_ZSTD;
+#endif
+#ifdef RPC_WITH_LZ4
+	pArr[num++] = COMPRESS_LZ4;
+#endif
+	return num;
+}
+
+bool Compressor::isSupported(unsigned char compressType)
+{
+	unsigned char arrType[MAX_COMPRESS_TYPE_NUM];
+	unsigned int num = getSupportedTypes(arrType);
+	return std::find(arrType, arrType + num, compressType) != arrType + num;
+}
+
+unsigned char Compressor::selectType(const unsigned char *pArr, unsigned int num)
+{
+	for (unsigned int i = 0; i < num; ++i)
+	{
+		if (COMPRESS_NONE != pArr[i] && isSupported(pArr[i]))
+			return pArr[i];
+	}
+	return COMPRESS_NONE;
+}
+
+bool Compressor::compress(unsigned char compressType, evbuffer *pSrc, size_t offset, size_t len, evbuffer *pDst)
+{
+	if (NULL == pSrc || NULL == pDst || pSrc == pDst)
+		return false;
+
+	switch (compressType)
+	{
+#ifdef RPC_WITH_LZ4
+	case COMPRESS_LZ4:
+		return lz4Compress(pSrc, offset, len, pDst);
+#endif
+#ifdef RPC_WITH_ZSTD
+	case COMPRESS_ZSTD:
+		return zstdCompress(pSrc, offset, len, pDst);
+#endif
+	default:
+		return false;
+	}
+}
+
+bool Compressor::decompress(unsigned char compressType, evbuffer *pSrc, size_t offset, size_t len, evbuffer *pDst, size_t maxLen)
+{
+	if (NULL == pSrc || NULL == pDst || pSrc == pDst)
+		return false;
+
+	switch (compressType)
+	{
+#ifdef RPC_WITH_LZ4
+	case COMPRESS_LZ4:
+		return lz4Decompress(pSrc, offset, len, pDst, maxLen);
+#endif
+#ifdef RPC_WITH_ZSTD
+	case COMPRESS_ZSTD:
+		return zstdDecompress(pSrc, offset, len, pDst, maxLen);
+#endif
+	default:
+		return false;
+	}
+}
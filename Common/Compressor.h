@@ -0,0 +1,94 @@
+#ifndef _COMPRESSOR_H_
+#define _COMPRESSOR_H_
+
+#include <event2/buffer.h>
+#include "Global.h"
+
+#ifdef WIN32
+#ifdef RPCSERVER_EXPORTS
+#define COMPRESSOR_DLL_EXPORTS __declspec(dllexport)
+#else
+#ifdef RPCCLIENT_EXPORTS
+#define COMPRESSOR_DLL_EXPORTS __declspec(dllexport)
+#else
+#define COMPRESSOR_DLL_EXPORTS __declspec(dllimport)
+#endif
+#endif
+#else
+#define COMPRESSOR_DLL_EXPORTS
+#endif
+
+//ѹѹʱÿevbufferĩβԤڴС
+#define COMPRESS_BLOCK_SIZE (64 * 1024)
+//zstdѹ𣬵ͼѹٶȽӽLZ4ѹԸ
+#define ZSTD_COMPRESS_LEVEL 1
+//һֵ֧ѹ㷨
+#define MAX_COMPRESS_TYPE_NUM 8
+
+//evbufferϵʽѹѹ
+//1밴evbufferڴѹ⣬ֱдevbufferĩβԤڴУмַ
+//2ѹÿ߳һظʹã
+//3ֵ֧㷨ڱʱRPC_WITH_LZ4liblz4RPC_WITH_ZSTDlibzstd
+class COMPRESSOR_DLL_EXPORTS Compressor
+{
+public:
+	/************************************************************************
+	  ܣȡֵ֧ѹ㷨˳УzstdѹʸߣLZ4֮ǰ
+	  
+		pArrѹ㷨飬ΪMAX_COMPRESS_TYPE_NUM
+	ֵֵ֧ѹ㷨Ϊ0ʾ֧ѹ
+	************************************************************************/
+	static unsigned int getSupportedTypes(unsigned char *pArr);
+
+	/************************************************************************
+	  ܣǷ֧ѹ㷨
+	  
+		compressType룬ѹ㷨
+	ֵ
+		true֧
+		false֧
+	************************************************************************/
+	static bool isSupported(unsigned char compressType);
+
+	/************************************************************************
+	  ܣӶԶֵ֧ѹ㷨ѡҲֵ֧ĵһ
+	  
+		pArr룬Զֵ֧ѹ㷨ţԶ˵˳
+		num룬
+	ֵѡѹ㷨ţΪCOMPRESS_NONEʾû˫ֵ֧㷨
+	************************************************************************/
+	static unsigned char selectType(const unsigned char *pArr, unsigned int num);
+
+	/************************************************************************
+	  ܣѹevbufferָݣ׷ӵһevbufferĩβ
+	  
+		compressType룬ѹ㷨
+		pSrc룬ѹڵevbuffer޸
+		offset룬pSrcеʼλ
+		len룬ݳ
+		pDstѹevbufferpSrcͬѹʧʱܲݣӦ
+	ֵ
+		trueѹɹ
+		falseѹʧָܻ֧㷨
+	************************************************************************/
+	static bool compress(unsigned char compressType, evbuffer *pSrc, size_t offset, size_t len, evbuffer *pDst);
+
+	/************************************************************************
+	  ܣѹevbufferָݣ׷ӵһevbufferĩβ
+		ѹдԭʼʱһԤڴ棬ѹֱʹöpullup
+	  
+		compressType룬ѹ㷨
+		pSrc룬ѹڵevbuffer޸
+		offset룬pSrcеʼλ
+		len룬ݳ
+		pDstŽѹevbufferpSrcͬѹʧʱܲѹĿͷֻ֣ڶλݣ֮Ӧ
+		maxLen룬ѹ󳤶ȣʱѹʧܣֹ쳣ݺľڴ棻
+			֡ͷеԭʼѳʱѹĳȳmaxLenCOMPRESS_BLOCK_SIZEнС߾ʧ
+	ֵ
+		trueѹɹ
+		falseѹʧܡݲָ֧㷨
+	************************************************************************/
+	static bool decompress(unsigned char compressType, evbuffer *pSrc, size_t offset, size_t len, evbuffer *pDst, size_t maxLen);
+};
+
+#endif
@@ -0,0 +1,168 @@
+#include "EvbufferStream.h"
+#include <climits>
+
+EvbufferInputStream::EvbufferInputStream(evbuffer *pBuf, size_t offset, size_t len)
+{
+	m_pIov = m_arrIov;
+	m_iovNum = 0;
+	m_index = 0;
+	m_backUpSize = 0;
+	m_byteCount = 0;
+
+	if (NULL == pBuf)
+		return;
+	size_t total = evbuffer_get_length(pBuf);
+	if (offset >= total)
+		return;
+	if (len > total - offset)
+		len = total - offset;
+	if (0 == len)
+		return;
+
+	//λʼλ
+	evbuffer_ptr ptr;
+	if (evbuffer_ptr_set(pBuf, &ptr, offset, EVBUFFER_PTR_SET) < 0)
+		return;
+	//evbuffer_peek()ڴ鳤ʱڶϷ»ȡ
+	int n = evbuffer_peek(pBuf, len, &ptr, m_arrIov, EVBUFFER_STREAM_INLINE_IOV);
+	if (n <= 0)
+		return;
+	if (n > EVBUFFER_STREAM_INLINE_IOV)
+	{
+		m_vecIov.resize(n);
+		n = evbuffer_peek(pBuf, len, &ptr, &m_vecIov[0], n);
+		m_pIov = &m_vecIov[0];
+	}
+	m_iovNum = n;
+
+	//һڴܳ䣬ü
+	size_t left = len;
+	for (size_t i = 0; i < m_iovNum; ++i)
+	{
+		if (m_pIov[i].iov_len >= left)
+		{
+			m_pIov[i].iov_len = left;
+			m_iovNum = i + 1;
+			break;
+		}
+		left -= m_pIov[i].iov_len;
+	}
+}
+
+bool EvbufferInputStream::Next(const void **data, int *size)
+{
+	//ȷһα˻ص
+	if (m_backUpSize > 0)
+	{
+		const evbuffer_iovec &iov = m_pIov[m_index - 1];
+		*data = (const char *)iov.iov_base + iov.iov_len - m_backUpSize;
+		*size = m_backUpSize;
+		m_byteCount += m_backUpSize;
+		m_backUpSize = 0;
+		return true;
+	}
+
+	//յڴ
+	while (m_index < m_iovNum && 0 == m_pIov[m_index].iov_len)
+		++m_index;
+	if (m_index >= m_iovNum)
+		return false;
+
+	const evbuffer_iovec &iov = m_pIov[m_index++];
+	*data = iov.iov_base;
+	*size = (int)iov.iov_len;
+	m_byteCount += iov.iov_len;
+	return true;
+}
+
+void EvbufferInputStream::BackUp(int count)
+{
+	if (count <= 0 || 0 == m_index)
+		return;
+	m_backUpSize = count;
+	m_byteCount -= count;
+}
+
+bool EvbufferInputStream::Skip(int count)
+{
+	const void *data;
+	int size;
+	while (count > 0)
+	{
+		if (!Next(&data, &size))
+			return false;
+		if (size > count)
+		{
+			BackUp(size - count);
+			return true;
+		}
+		count -= size;
+	}
+	return true;
+}
+
+google::protobuf::int64 EvbufferInputStream::ByteCount() const
+{
+	return m_byteCount;
+}
+
+EvbufferOutputStream::EvbufferOutputStream(evbuffer *pBuf, size_t sizeHint)
+{
+	m_pBuf = pBuf;
+	m_iov.iov_base = NULL;
+	m_iov.iov_len = 0;
+	m_bReserved = false;
+	m_reserveSize = (sizeHint > 0) ? sizeHint : EVBUFFER_STREAM_BLOCK_SIZE;
+	m_byteCount = 0;
+}
+
+EvbufferOutputStream::~EvbufferOutputStream()
+{
+	commit();
+}
+
+bool EvbufferOutputStream::Next(void **data, int *size)
+{
+	if (NULL == m_pBuf)
+		return false;
+	//ύһ飬Ԥµһ
+	if (!commit())
+		return false;
+
+	//ֻԤ1ڴ飬Ա֤صڴ
+	if (1 != evbuffer_reserve_space(m_pBuf, (ev_ssize_t)m_reserveSize, &m_iov, 1))
+		return false;
+	m_bReserved = true;
+	//Ԥʵʳȿܴĳȣʹ
+	if (m_iov.iov_len > INT_MAX)
+		m_iov.iov_len = INT_MAX;
+	*data = m_iov.iov_base;
+	*size = (int)m_iov.iov_len;
+	m_byteCount += m_iov.iov_len;
+	//ԤƵܳ󣬺̶СԤ
+	m_reserveSize = EVBUFFER_STREAM_BLOCK_SIZE;
+	return true;
+}
+
+void EvbufferOutputStream::BackUp(int count)
+{
+	if (!m_bReserved || count <= 0)
+		return;
+	if ((size_t)count > m_iov.iov_len)
+		count = (int)m_iov.iov_len;
+	m_iov.iov_len -= count;
+	m_byteCount -= count;
+}
+
+google::protobuf::int64 EvbufferOutputStream::ByteCount() const
+{
+	return m_byteCount;
+}
+
+bool EvbufferOutputStream::commit()
+{
+	if (!m_bReserved)
+		return true;
+	m_bReserved = false;
+	return 0 == evbuffer_commit_space(m_pBuf, &m_iov, 1);
+}
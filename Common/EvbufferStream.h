@@ -0,0 +1,172 @@
+#ifndef _EVBUFFERSTREAM_H_
+#define _EVBUFFERSTREAM_H_
+
+#include <vector>
+#include <event2/buffer.h>
+#include <google/protobuf/io/zero_copy_stream.h>
+
+#ifdef WIN32
+#ifdef RPCSERVER_EXPORTS
+#define EVBUFFERSTREAM_DLL_EXPORTS __declspec(dllexport)
+#else
+#ifdef RPCCLIENT_EXPORTS
+#define EVBUFFERSTREAM_DLL_EXPORTS __declspec(dllexport)
+#else
+#define EVBUFFERSTREAM_DLL_EXPORTS __declspec(dllimport)
+#endif
+#endif
+#else
+#define EVBUFFERSTREAM_DLL_EXPORTS
+#endif
+
+//ֱӴŵڴʱڶϷ
+#define EVBUFFER_STREAM_INLINE_IOV 8
+//δָԤСʱÿԤڴС
+#define EVBUFFER_STREAM_BLOCK_SIZE 4096
+
+//evbufferϵ㿽protobufֱevbufferڴϷл
+//1ʱͨevbuffer_peek()ȡָڵڴ飨iovecſevbuffer
+//2ڣ޸evbufferݣ
+//3ͬһevbufferϿͬʱڶԶȡ
+class EVBUFFERSTREAM_DLL_EXPORTS EvbufferInputStream : public google::protobuf::io::ZeroCopyInputStream
+{
+public:
+	/************************************************************************
+	  ܣ췽
+	  
+		pBuf룬evbufferָ
+		offset룬evbufferеʼλãĬϴͷʼ
+		len룬ĳȣĬϵevbufferĩβ
+	ֵ
+	************************************************************************/
+	EvbufferInputStream(evbuffer *pBuf, size_t offset = 0, size_t len = (size_t)-1);
+
+	/************************************************************************
+	  ܣȡһɶݣZeroCopyInputStream
+	  
+		dataݿָ
+		sizeݿ鳤
+	ֵ
+		trueȡɹ
+		falseѵĩβ
+	************************************************************************/
+	bool Next(const void **data, int *size);
+
+	/************************************************************************
+	  ܣ˻һNext()ȡݿĩβcountֽڣZeroCopyInputStream
+	  
+		count룬˻صֽ
+	ֵ
+	************************************************************************/
+	void BackUp(int count);
+
+	/************************************************************************
+	  ܣcountֽڣZeroCopyInputStream
+	  
+		count룬ֽ
+	ֵ
+		trueɹ
+		falseѵĩβ
+	************************************************************************/
+	bool Skip(int count);
+
+	/************************************************************************
+	  ܣȡѶȡֽZeroCopyInputStream
+	  
+	ֵѶȡֽ
+	************************************************************************/
+	google::protobuf::int64 ByteCount() const;
+
+private:
+	EvbufferInputStream(const EvbufferInputStream &);
+	EvbufferInputStream &operator=(const EvbufferInputStream &);
+
+	//ڵڴ飬ѲüڣEVBUFFER_STREAM_INLINE_IOVʱm_arrIovУm_vecIov
+	evbuffer_iovec *m_pIov;
+	evbuffer_iovec m_arrIov[EVBUFFER_STREAM_INLINE_IOV];
+	std::vector<evbuffer_iovec> m_vecIov;
+	//ڴ
+	size_t m_iovNum;
+	//һNext()صڴ±
+	size_t m_index;
+	//һNext()صڴб˻صֽ
+	int m_backUpSize;
+	//Ѷȡֽ
+	google::protobuf::int64 m_byteCount;
+};
+
+//evbufferϵ㿽protobufֱлevbufferڴ
+//1ͨevbuffer_reserve_space()evbufferĩβԤڴ飬лɺͨevbuffer_commit_space()ύ
+//2ԤڴһNext()commit()ʱύڴ֮ǰܶevbuffer
+//3ٽ֮ϵCodedOutputStreamύ
+class EVBUFFERSTREAM_DLL_EXPORTS EvbufferOutputStream : public google::protobuf::io::ZeroCopyOutputStream
+{
+public:
+	/************************************************************************
+	  ܣ췽
+	  
+		pBuf룬evbufferָ
+		sizeHint룬ԤдܳȣһNext()Ԥһôڴ棬ĬΪ0ʾEVBUFFER_STREAM_BLOCK_SIZEԤ
+	ֵ
+	************************************************************************/
+	EvbufferOutputStream(evbuffer *pBuf, size_t sizeHint = 0);
+
+	/************************************************************************
+	  ܣύδύڴ
+	  
+	ֵ
+	************************************************************************/
+	~EvbufferOutputStream();
+
+	/************************************************************************
+	  ܣȡһдڴ棬ZeroCopyOutputStream
+	  
+		dataڴָ
+		sizeڴ鳤
+	ֵ
+		trueȡɹ
+		falseԤڴʧ
+	************************************************************************/
+	bool Next(void **data, int *size);
+
+	/************************************************************************
+	  ܣ˻һNext()ȡڴĩβδдcountֽڣZeroCopyOutputStream
+	  
+		count룬˻صֽ
+	ֵ
+	************************************************************************/
+	void BackUp(int count);
+
+	/************************************************************************
+	  ܣȡдֽZeroCopyOutputStream
+	  
+	ֵдֽ
+	************************************************************************/
+	google::protobuf::int64 ByteCount() const;
+
+	/************************************************************************
+	  ܣύԤڴ飬˺evbufferвܿд
+	  
+	ֵ
+		trueύɹ
+		falseύʧ
+	************************************************************************/
+	bool commit();
+
+private:
+	EvbufferOutputStream(const EvbufferOutputStream &);
+	EvbufferOutputStream &operator=(const EvbufferOutputStream &);
+
+	//evbufferָ
+	evbuffer *m_pBuf;
+	//Ԥδύڴ
+	evbuffer_iovec m_iov;
+	//Ƿδύڴ
+	bool m_bReserved;
+	//һԤĴС
+	size_t m_reserveSize;
+	//дֽ
+	google::protobuf::int64 m_byteCount;
+};
+
+#endif
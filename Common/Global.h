@@ -7,21 +7,79 @@
 #define SAFE_DELETE(p) { if (NULL != (p)) { delete (p); (p) = NULL; } }
 
 /************************************************************************
-RpcͨЭṹhead + body
-1headΪ5ֽ
-	11ֽڣͣDATA_TYPEĶ
-	22-5ֽڣbodyĳ
-2body
+RpcͨЭṹhead + bodyhead汾շÿЭݵĵ1ֽ
+1head
+	v1Ϊ5ֽ
+	11ֽڣ4λΪͣDATA_TYPEĶ壻4λΪbodyѹ㷨COMPRESS_TYPEĶ
+	22-5ֽڣbodyĳȣֽbodyѹʱΪѹĳ
+	v2Ϊ4-8ֽڣ֮ɴչ
+	11ֽڣħHEAD_V2_MAGICv1 headĵ1ֽڲ֮ͬ
+	22ֽڣ4λΪ汾ţ4λΪ־λHEAD_FLAG_XXXĶ壬ʶı־λ
+	33ֽڣv1 headĵ1ֽͬ
+	4֮Ϊbodyĳȣvarint루ÿֽڵ7λСǰλΪ1ʾ滹У1-5ֽ
+	5HEAD_FLAG_EXTENSIONʱ֮ΪvarintչȺչչɸ
+		varintǩ + varint + ɣշʶıǩbodyȲչ
+2bodyеΪ4ֽСֽ
 	1ΪPINGPONGbodyΪ0ֽ
 	2ΪӦbodyݼProtocolBody.proto
+	3ΪضȣCREDITͻ˷ʱbodyΪ0ֽڣʱbodyΪ4ֽڵĶ
+	4ΪѹЭ̣COMPRESSbodyΪͻֵ֧ѹ㷨ţÿ1ֽڣ˳
+	5Ϊʽ֡STREAMbodyݼProtocolBody.protoеProtocolBodyStream
+	6ΪȣSTREAM_CREDITbodyΪ4ֽڵĵid + 4ֽڵĶͻ˷ʱΪ0ʾȡ
+	7ΪƬFRAGMENTͻ˷ʱbodyΪ0ֽڣʱbodyΪ4ֽڵķƬid + 1ֽڵĽ + Ƭ
+	8Ϊ汾Э̣VERSIONbodyΪ1ֽڵİ汾ţͻ˷ʱΪֵ֧߰汾ظʱΪѡİ汾
+3أͻӽһCREDITظCREDITӵ;󴰿ڣ˺
+	1ͻÿһ1ȣʱͣͣ
+	2ÿӦ黹1ȣʧܡظӦɷCREDIT黹
+	3δյCREDITĿͻ˲ܶƣԼݲ֧صķ
+4ѹͻӽһCOMPRESSѡԼҲֵ֧ĵһ㷨
+	˺ϲСѹֵӦbodyԸ㷨ѹheadбͿͻ˷͵ʽ֡ѹ
+5ʽãstreamWindowʱԶSTREAM֡ظΪһBEGINMESSAGEһENDERROR
+	1streamWindowΪͻ˳ʼϢȣÿһMESSAGE1ʱʵֵд뱻
+	2ͻÿһϢSTREAM_CREDIT黹ȣĿͻ˷Ϊռõڴ棻
+	3ENDERROR൱ڸõõӦ黹1ӶȣBEGINMESSAGE黹
+		ENDвΪյķʱͻ˰һϢ
+	4֧ʽõķͨӦظͻ˰ΨһϢ
+6ƬͻӽһFRAGMENTʾƬ˺ѳƬСӦгɶFRAGMENTͣ
+	1ͬһƬidĸƬƴӣõͬһõһЭݣhead + bodyΪ1ķƬһ
+	2ſʱŷһƬӦķƬͣСЭݲŶӣ
+		˴ӦУͬһõӳֻƬķʱ䣻
+	3ͻÿյһƬ÷Ƭid黺еЭһһһƬ
+		Эbodyͻ˵Ӧʱõʧܽ÷Ƭid֮ķƬＴ
+	4δFRAGMENTĿͻ˲յƬԼݲַ֧ƬĿͻˡ
+7汾Э̣ӽ˫v1 headͣͻ˷һVERSIONѡ˫ֵ֧߰汾ظVERSION
+	˺ѡİ汾ͣͻյظҲѡİ汾͡δVERSIONĿͻ˺ͲظVERSIONķһֱʹv1
+8ͻʽãclientStreamWindowʱͻ֮ԶSTREAM֡ϢΪMESSAGEһENDͨӦظ
+	1ܵúSTREAM_CREDIT費clientStreamWindowĳʼȣͻÿһMESSAGE1ʱд뱻
+	2ʵÿȡһϢSTREAM_CREDIT黹ȣ˶ȡķʵ˿ͻΪռõڴ棻
+	3ͻԶΪ0STREAM_CREDITȡã漴ʵֵĶȡ
+	4ֿ֧ͻʽõķղϢͨôظͻ˵дýʧܡ
 ************************************************************************/
 
-//Эhead
+//v1Эhead
 #define HEAD_SIZE 5
+//v2Эheadħv1 head1ֽڵĸ4λѹ㷨ţﵽ0xA
+#define HEAD_V2_MAGIC 0xA5
+//v2Эheadbody֮ǰֽħ汾źͱ־λͺѹ㷨
+#define HEAD_V2_FIXED_SIZE 3
+//Эhead󳤶ȣչ
+#define HEAD_MAX_SIZE (HEAD_V2_FIXED_SIZE + 5)
+//v2Эhead2ֽа汾ŵʼλ
+#define HEAD_VERSION_SHIFT 4
+//v2Эhead2ֽб־λռλ
+#define HEAD_FLAG_MASK 0x0F
+//v2Эhead־λչ
+#define HEAD_FLAG_EXTENSION 0x01
+//չ󳤶ȣʱΪЭЧ
+#define HEAD_EXTENSION_MAX_SIZE 4096
 //Эbody
 typedef uint32_t bodySize_t;
 //Id
 typedef uint32_t callId_t;
+//ӦʽӦ֡ЭbodyУidֶε󳤶ȣ1ֽڵtag + 5ֽڵvarint
+#define CALL_ID_MAX_PREFIX_SIZE (1 + 5)
+//ÿϿɰ󶨵ķޣŴ1ʼ
+#define MAX_SERVICE_ID 1024
 
 //Э鲿λ
 enum PROTOCOL_PART
@@ -42,7 +100,68 @@ enum DATA_TYPE
 	//PINGɿͻ˷͸
 	DATA_TYPE_HEARTBEAT_PING = 2, 
 	//PONGɷظͻ
-	DATA_TYPE_HEARTBEAT_PONG = 3
+	DATA_TYPE_HEARTBEAT_PONG = 3, 
+	//ضȣͻ˷ͱʾ֧أͱʾ黹
+	DATA_TYPE_CREDIT = 4, 
+	//ѹЭ̣ɿͻ˷͸
+	DATA_TYPE_COMPRESS = 5, 
+	//ʽ֡ͱʾʽõӦ֡ͻ˷ͱʾͻʽõϢ֡
+	DATA_TYPE_STREAM = 6, 
+	//ȣɽʽ֡һ͸Էȣͻ˷ͶΪ0ʱʾȡ
+	DATA_TYPE_STREAM_CREDIT = 7, 
+	//Ƭͻ˷ͱʾƬͱʾӦһƬ
+	DATA_TYPE_FRAGMENT = 8, 
+	//汾Э̣ͻ˷ֵ֧߰汾ظѡİ汾
+	DATA_TYPE_VERSION = 9
+};
+
+//Э汾
+enum PROTOCOL_VERSION
+{
+	//5ֽheadֽĶbody
+	PROTOCOL_V1 = 1, 
+	//ħ汾š־λչheadvarintbody
+	PROTOCOL_V2 = 2
+};
+
+//ֵ֧Э汾
+#define PROTOCOL_MAX_VERSION PROTOCOL_V2
+
+//Эhead1ֽռλ
+#define DATA_TYPE_MASK 0x0F
+//Эhead1ֽѹ㷨ʼλ
+#define COMPRESS_TYPE_SHIFT 4
+
+//ѹ㷨
+enum COMPRESS_TYPE
+{
+	//ѹ
+	COMPRESS_NONE = 0, 
+	//LZ4֡ʽʱRPC_WITH_LZ4֧
+	COMPRESS_LZ4 = 1, 
+	//zstdʱRPC_WITH_ZSTD֧
+	COMPRESS_ZSTD = 2
+};
+
+//ض
+typedef uint32_t credit_t;
+
+//Ƭidͣÿɷη
+typedef uint32_t fragmentId_t;
+//ƬbodyзƬ֮ǰĳȣƬid + 1ֽڵĽ
+#define FRAGMENT_HEAD_SIZE (sizeof(fragmentId_t) + 1)
+
+//ʽ֡
+enum STREAM_FRAME
+{
+	//ʼѽܷʽ
+	STREAM_BEGIN = 1, 
+	//еһϢ
+	STREAM_MESSAGE = 2, 
+	//ͻʽʾϢд
+	STREAM_END = 3, 
+	//ʧܽϢ
+	STREAM_ERROR = 4
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,123 @@
+#ifndef _MPSCQUEUE_H_
+#define _MPSCQUEUE_H_
+
+#include <atomic>
+#include <cstddef>
+#include <climits>
+
+//г
+#ifndef CACHE_LINE_SIZE
+#define CACHE_LINE_SIZE 64
+#endif
+
+//ߵߵʽ
+//1ԪͨnextָԱģpNextӲڴ棻
+//2CASԪѹͷһexchangeȡٷתΪȽȳ˳
+//   һȡȫԪأABA⣻
+//3߳̿ͬʱput()ֻһ̵߳takeAll()
+//4гֻǽƵޣڷֹʱԪ޶ѻ
+template<typename T, T *T::*pNext>
+class MpscQueue
+{
+public:
+	/************************************************************************
+	  ܣ캯
+	  
+		maxSize룬е󳤶ȣΪ0ʾ
+	ֵ
+	************************************************************************/
+	MpscQueue(unsigned int maxSize = 0)
+	{
+		m_pHead.store(NULL, std::memory_order_relaxed);
+		m_size.store(0, std::memory_order_relaxed);
+		setMaxSize(maxSize);
+	}
+
+	/************************************************************************
+	  ܣöе󳤶
+	  
+		maxSize룬е󳤶ȣΪ0ʾ
+	ֵ
+	************************************************************************/
+	void setMaxSize(unsigned int maxSize)
+	{
+		m_maxSize = (0 == maxSize) ? UINT_MAX : maxSize;
+	}
+
+	/************************************************************************
+	  ܣзһԪأ̵߳
+	  
+		pValue룬Ԫָ룬ӺֱtakeAll()ȡǰ޸nextָԱ
+	ֵ
+		trueųɹ
+		false
+	************************************************************************/
+	bool put(T *pValue)
+	{
+		if (m_size.fetch_add(1, std::memory_order_relaxed) >= m_maxSize)
+		{
+			m_size.fetch_sub(1, std::memory_order_relaxed);
+			return false;
+		}
+
+		T *pHead = m_pHead.load(std::memory_order_relaxed);
+		do
+		{
+			pValue->*pNext = pHead;
+		} while (!m_pHead.compare_exchange_weak(pHead, pValue, std::memory_order_release, std::memory_order_relaxed));
+		return true;
+	}
+
+	/************************************************************************
+	  ܣȡ߶еԪأ̵ֻ߳
+	  
+	ֵ˳ĵһԪָ룬ͨnextָԱΪNULLʾΪ
+	************************************************************************/
+	T *takeAll()
+	{
+		T *pValue = m_pHead.exchange(NULL, std::memory_order_acquire);
+		//ͷӵԪأתΪȽȳ˳
+		T *pFirst = NULL;
+		unsigned int count = 0;
+		while (NULL != pValue)
+		{
+			T *pTmp = pValue->*pNext;
+			pValue->*pNext = pFirst;
+			pFirst = pValue;
+			pValue = pTmp;
+			++count;
+		}
+		if (count > 0)
+			m_size.fetch_sub(count, std::memory_order_relaxed);
+		return pFirst;
+	}
+
+	/************************************************************************
+	  ܣǷΪգֻǵʱ̵Ľֵ
+	  
+	ֵ
+		trueΪ
+		falseвΪ
+	************************************************************************/
+	bool empty()
+	{
+		return NULL == m_pHead.load(std::memory_order_relaxed);
+	}
+
+private:
+	MpscQueue(const MpscQueue &);
+	MpscQueue &operator=(const MpscQueue &);
+
+	//䣬ǰα
+	char m_pad0[CACHE_LINE_SIZE];
+	//ͷӵԪأ֮ڴ˾ռ
+	std::atomic<T *> m_pHead;
+	char m_pad1[CACHE_LINE_SIZE - sizeof(std::atomic<T *>)];
+	//еԪظ
+	std::atomic<unsigned int> m_size;
+	//е󳤶
+	unsigned int m_maxSize;
+	char m_pad2[CACHE_LINE_SIZE - sizeof(std::atomic<unsigned int>) - sizeof(unsigned int)];
+};
+
+#endif
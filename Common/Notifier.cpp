@@ -0,0 +1,97 @@
+#include "Notifier.h"
+#ifdef WIN32
+#include <winsock2.h>
+#else
+#include <unistd.h>
+#include <sys/socket.h>
+#endif
+#ifdef __linux__
+#include <sys/eventfd.h>
+#endif
+
+Notifier::Notifier()
+{
+	m_bValid = false;
+	m_bPending.store(false);
+
+#ifdef __linux__
+	//eventfdֻһдϽ
+	int fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+	if (fd < 0)
+		return;
+	m_read_fd = fd;
+	m_write_fd = fd;
+#else
+	evutil_socket_t fds[2];
+#ifdef WIN32
+	if (evutil_socketpair(AF_INET, SOCK_STREAM, 0, fds) < 0)
+		return;
+#else
+	if (evutil_socketpair(AF_UNIX, SOCK_STREAM, 0, fds) < 0)
+		return;
+#endif
+	//socketpair2óɷ
+	evutil_make_socket_nonblocking(fds[0]);
+	evutil_make_socket_nonblocking(fds[1]);
+	m_read_fd = fds[0];
+	m_write_fd = fds[1];
+#endif
+	m_bValid = true;
+}
+
+Notifier::~Notifier()
+{
+	if (!m_bValid)
+		return;
+	evutil_closesocket(m_read_fd);
+	if (m_write_fd != m_read_fd)
+		evutil_closesocket(m_write_fd);
+}
+
+bool Notifier::isValid()
+{
+	return m_bValid;
+}
+
+evutil_socket_t Notifier::getFd()
+{
+	return m_read_fd;
+}
+
+void Notifier::notify()
+{
+	if (!m_bValid)
+		return;
+	//л;֪ͨconsume()֮һῴ֪֮ͨǰ
+	if (m_bPending.exchange(true, std::memory_order_acq_rel))
+		return;
+
+#ifdef __linux__
+	uint64_t value = 1;
+	ssize_t ret = write(m_write_fd, &value, sizeof(value));
+	(void)ret;
+#else
+	char buf[1] = { 0 };
+	send(m_write_fd, buf, 1, 0);
+#endif
+}
+
+void Notifier::consume()
+{
+	if (!m_bValid)
+		return;
+
+#ifdef __linux__
+	//ȡeventfdὫ
+	uint64_t value;
+	ssize_t ret = read(m_read_fd, &value, sizeof(value));
+	(void)ret;
+#else
+	//socketpairл۵ֽ
+	char buf[64];
+	while (recv(m_read_fd, buf, sizeof(buf), 0) > 0) {}
+#endif
+	//;ǣ˺notify()ٴд
+	//ʹö--дԱ֤֪ͨnotify()֮ǰ
+	m_bPending.exchange(false, std::memory_order_acq_rel);
+}
\ No newline at end of file
@@ -0,0 +1,86 @@
+#ifndef _NOTIFIER_H_
+#define _NOTIFIER_H_
+
+#include <atomic>
+#include <event2/util.h>
+
+#ifdef WIN32
+#ifdef RPCSERVER_EXPORTS
+#define NOTIFIER_DLL_EXPORTS __declspec(dllexport)
+#else
+#ifdef RPCCLIENT_EXPORTS
+#define NOTIFIER_DLL_EXPORTS __declspec(dllexport)
+#else
+#define NOTIFIER_DLL_EXPORTS __declspec(dllimport)
+#endif
+#endif
+#else
+#define NOTIFIER_DLL_EXPORTS
+#endif
+
+//֪߳ͨڻ¼ѭ߳
+//1Linuxϻeventfdʵ֣ƽ̨socketpairʵ֣
+//2֪ͨǺϲģһconsume()֮notify()ٴΣֻдһΣ
+//   ˱֪ͨÿαѺ󣬱ȵconsume()ٴдݡ
+class NOTIFIER_DLL_EXPORTS Notifier
+{
+public:
+	/************************************************************************
+	  ܣ췽
+	  
+	ֵ
+	************************************************************************/
+	Notifier();
+
+	/************************************************************************
+	  ܣ
+	  
+	ֵ
+	************************************************************************/
+	~Notifier();
+
+	/************************************************************************
+	  ܣ֪ͨǷ񴴽ɹ
+	  
+	ֵ
+		trueɹ
+		falseʧ
+	************************************************************************/
+	bool isValid();
+
+	/************************************************************************
+	  ܣȡ֪ͨɶ¼
+	  
+	ֵ
+	************************************************************************/
+	evutil_socket_t getFd();
+
+	/************************************************************************
+	  ܣ̵֪ͨ߳ãδconsume()֪ͨϵͳ
+	  
+	ֵ
+	************************************************************************/
+	void notify();
+
+	/************************************************************************
+	  ܣֻ֪ͨڱ̵֪ͨ߳ãú֪ͨ봦д
+	  
+	ֵ
+	************************************************************************/
+	void consume();
+
+private:
+	Notifier(const Notifier &);
+	Notifier &operator=(const Notifier &);
+
+	//֪ͨ߼eventfdʵʱm_write_fdͬ
+	evutil_socket_t m_read_fd;
+	//֪ͨд
+	evutil_socket_t m_write_fd;
+	//Ƿ񴴽ɹ
+	bool m_bValid;
+	//Ƿδconsume()֪֪ͨͨ߿˯л;
+	std::atomic<bool> m_bPending;
+};
+
+#endif
\ No newline at end of file
@@ -1,737 +1,1273 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: ProtocolBody.proto
 
-#define INTERNAL_SUPPRESS_PROTOBUF_FIELD_DEPRECATION
 #include "ProtocolBody.pb.h"
 
 #include <algorithm>
 
-#include <google/protobuf/stubs/common.h>
-#include <google/protobuf/stubs/once.h>
 #include <google/protobuf/io/coded_stream.h>
-#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
 #include <google/protobuf/descriptor.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/reflection_ops.h>
 #include <google/protobuf/wire_format.h>
 // @@protoc_insertion_point(includes)
-
-namespace {
-
-const ::google::protobuf::Descriptor* ProtocolBodyRequest_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  ProtocolBodyRequest_reflection_ = NULL;
-const ::google::protobuf::Descriptor* ProtocolBodyResponse_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  ProtocolBodyResponse_reflection_ = NULL;
-
-}  // namespace
-
-
-void protobuf_AssignDesc_ProtocolBody_2eproto() {
-  protobuf_AddDesc_ProtocolBody_2eproto();
-  const ::google::protobuf::FileDescriptor* file =
-    ::google::protobuf::DescriptorPool::generated_pool()->FindFileByName(
-      "ProtocolBody.proto");
-  GOOGLE_CHECK(file != NULL);
-  ProtocolBodyRequest_descriptor_ = file->message_type(0);
-  static const int ProtocolBodyRequest_offsets_[4] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ProtocolBodyRequest, servicename_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ProtocolBodyRequest, methodindex_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ProtocolBodyRequest, callid_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ProtocolBodyRequest, content_),
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+PROTOBUF_CONSTEXPR ProtocolBodyRequest::ProtocolBodyRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.servicename_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.content_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.methodindex_)*/0u
+  , /*decltype(_impl_.callid_)*/0u
+  , /*decltype(_impl_.serviceid_)*/0u
+  , /*decltype(_impl_.streamwindow_)*/0u
+  , /*decltype(_impl_.clientstreamwindow_)*/0u} {}
+struct ProtocolBodyRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ProtocolBodyRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ProtocolBodyRequestDefaultTypeInternal() {}
+  union {
+    ProtocolBodyRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ProtocolBodyRequestDefaultTypeInternal _ProtocolBodyRequest_default_instance_;
+PROTOBUF_CONSTEXPR ProtocolBodyResponse::ProtocolBodyResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.content_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.error_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.callid_)*/0u} {}
+struct ProtocolBodyResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ProtocolBodyResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ProtocolBodyResponseDefaultTypeInternal() {}
+  union {
+    ProtocolBodyResponse _instance;
   };
-  ProtocolBodyRequest_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      ProtocolBodyRequest_descriptor_,
-      ProtocolBodyRequest::default_instance_,
-      ProtocolBodyRequest_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ProtocolBodyRequest, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ProtocolBodyRequest, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(ProtocolBodyRequest));
-  ProtocolBodyResponse_descriptor_ = file->message_type(1);
-  static const int ProtocolBodyResponse_offsets_[2] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ProtocolBodyResponse, callid_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ProtocolBodyResponse, content_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ProtocolBodyResponseDefaultTypeInternal _ProtocolBodyResponse_default_instance_;
+PROTOBUF_CONSTEXPR ProtocolBodyStream::ProtocolBodyStream(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.content_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.error_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.callid_)*/0u
+  , /*decltype(_impl_.frame_)*/0u} {}
+struct ProtocolBodyStreamDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ProtocolBodyStreamDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ProtocolBodyStreamDefaultTypeInternal() {}
+  union {
+    ProtocolBodyStream _instance;
   };
-  ProtocolBodyResponse_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      ProtocolBodyResponse_descriptor_,
-      ProtocolBodyResponse::default_instance_,
-      ProtocolBodyResponse_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ProtocolBodyResponse, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ProtocolBodyResponse, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(ProtocolBodyResponse));
-}
-
-namespace {
-
-GOOGLE_PROTOBUF_DECLARE_ONCE(protobuf_AssignDescriptors_once_);
-inline void protobuf_AssignDescriptorsOnce() {
-  ::google::protobuf::GoogleOnceInit(&protobuf_AssignDescriptors_once_,
-                 &protobuf_AssignDesc_ProtocolBody_2eproto);
-}
-
-void protobuf_RegisterTypes(const ::std::string&) {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    ProtocolBodyRequest_descriptor_, &ProtocolBodyRequest::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    ProtocolBodyResponse_descriptor_, &ProtocolBodyResponse::default_instance());
-}
-
-}  // namespace
-
-void protobuf_ShutdownFile_ProtocolBody_2eproto() {
-  delete ProtocolBodyRequest::default_instance_;
-  delete ProtocolBodyRequest_reflection_;
-  delete ProtocolBodyResponse::default_instance_;
-  delete ProtocolBodyResponse_reflection_;
-}
-
-void protobuf_AddDesc_ProtocolBody_2eproto() {
-  static bool already_here = false;
-  if (already_here) return;
-  already_here = true;
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
-    "\n\022ProtocolBody.proto\"`\n\023ProtocolBodyRequ"
-    "est\022\023\n\013serviceName\030\001 \001(\t\022\023\n\013methodIndex\030"
-    "\002 \001(\r\022\016\n\006callId\030\003 \001(\r\022\017\n\007content\030\004 \001(\014\"7"
-    "\n\024ProtocolBodyResponse\022\016\n\006callId\030\001 \001(\r\022\017"
-    "\n\007content\030\002 \001(\014B\003\200\001\001", 180);
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
-    "ProtocolBody.proto", &protobuf_RegisterTypes);
-  ProtocolBodyRequest::default_instance_ = new ProtocolBodyRequest();
-  ProtocolBodyResponse::default_instance_ = new ProtocolBodyResponse();
-  ProtocolBodyRequest::default_instance_->InitAsDefaultInstance();
-  ProtocolBodyResponse::default_instance_->InitAsDefaultInstance();
-  ::google::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_ProtocolBody_2eproto);
-}
-
-// Force AddDescriptors() to be called at static initialization time.
-struct StaticDescriptorInitializer_ProtocolBody_2eproto {
-  StaticDescriptorInitializer_ProtocolBody_2eproto() {
-    protobuf_AddDesc_ProtocolBody_2eproto();
-  }
-} static_descriptor_initializer_ProtocolBody_2eproto_;
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ProtocolBodyStreamDefaultTypeInternal _ProtocolBodyStream_default_instance_;
+static ::_pb::Metadata file_level_metadata_ProtocolBody_2eproto[3];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_ProtocolBody_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_ProtocolBody_2eproto = nullptr;
+
+const uint32_t TableStruct_ProtocolBody_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::ProtocolBodyRequest, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::ProtocolBodyRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ProtocolBodyRequest, _impl_.servicename_),
+  PROTOBUF_FIELD_OFFSET(::ProtocolBodyRequest, _impl_.methodindex_),
+  PROTOBUF_FIELD_OFFSET(::ProtocolBodyRequest, _impl_.callid_),
+  PROTOBUF_FIELD_OFFSET(::ProtocolBodyRequest, _impl_.content_),
+  PROTOBUF_FIELD_OFFSET(::ProtocolBodyRequest, _impl_.serviceid_),
+  PROTOBUF_FIELD_OFFSET(::ProtocolBodyRequest, _impl_.streamwindow_),
+  PROTOBUF_FIELD_OFFSET(::ProtocolBodyRequest, _impl_.clientstreamwindow_),
+  0,
+  2,
+  3,
+  1,
+  4,
+  5,
+  6,
+  PROTOBUF_FIELD_OFFSET(::ProtocolBodyResponse, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::ProtocolBodyResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ProtocolBodyResponse, _impl_.callid_),
+  PROTOBUF_FIELD_OFFSET(::ProtocolBodyResponse, _impl_.content_),
+  PROTOBUF_FIELD_OFFSET(::ProtocolBodyResponse, _impl_.error_),
+  2,
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::ProtocolBodyStream, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::ProtocolBodyStream, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ProtocolBodyStream, _impl_.callid_),
+  PROTOBUF_FIELD_OFFSET(::ProtocolBodyStream, _impl_.content_),
+  PROTOBUF_FIELD_OFFSET(::ProtocolBodyStream, _impl_.frame_),
+  PROTOBUF_FIELD_OFFSET(::ProtocolBodyStream, _impl_.error_),
+  2,
+  0,
+  3,
+  1,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 13, -1, sizeof(::ProtocolBodyRequest)},
+  { 20, 29, -1, sizeof(::ProtocolBodyResponse)},
+  { 32, 42, -1, sizeof(::ProtocolBodyStream)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::_ProtocolBodyRequest_default_instance_._instance,
+  &::_ProtocolBodyResponse_default_instance_._instance,
+  &::_ProtocolBodyStream_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_ProtocolBody_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\022ProtocolBody.proto\"\245\001\n\023ProtocolBodyReq"
+  "uest\022\023\n\013serviceName\030\001 \001(\t\022\023\n\013methodIndex"
+  "\030\002 \001(\r\022\016\n\006callId\030\003 \001(\r\022\017\n\007content\030\004 \001(\014\022"
+  "\021\n\tserviceId\030\005 \001(\r\022\024\n\014streamWindow\030\006 \001(\r"
+  "\022\032\n\022clientStreamWindow\030\007 \001(\r\"F\n\024Protocol"
+  "BodyResponse\022\016\n\006callId\030\001 \001(\r\022\017\n\007content\030"
+  "\002 \001(\014\022\r\n\005error\030\003 \001(\t\"S\n\022ProtocolBodyStre"
+  "am\022\016\n\006callId\030\001 \001(\r\022\017\n\007content\030\002 \001(\014\022\r\n\005f"
+  "rame\030\003 \001(\r\022\r\n\005error\030\004 \001(\tB\006\200\001\001\370\001\001"
+  ;
+static ::_pbi::once_flag descriptor_table_ProtocolBody_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_ProtocolBody_2eproto = {
+    false, false, 353, descriptor_table_protodef_ProtocolBody_2eproto,
+    "ProtocolBody.proto",
+    &descriptor_table_ProtocolBody_2eproto_once, nullptr, 0, 3,
+    schemas, file_default_instances, TableStruct_ProtocolBody_2eproto::offsets,
+    file_level_metadata_ProtocolBody_2eproto, file_level_enum_descriptors_ProtocolBody_2eproto,
+    file_level_service_descriptors_ProtocolBody_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_ProtocolBody_2eproto_getter() {
+  return &descriptor_table_ProtocolBody_2eproto;
+}
 
-// ===================================================================
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_ProtocolBody_2eproto(&descriptor_table_ProtocolBody_2eproto);
 
-#ifndef _MSC_VER
-const int ProtocolBodyRequest::kServiceNameFieldNumber;
-const int ProtocolBodyRequest::kMethodIndexFieldNumber;
-const int ProtocolBodyRequest::kCallIdFieldNumber;
-const int ProtocolBodyRequest::kContentFieldNumber;
-#endif  // !_MSC_VER
+// ===================================================================
 
-ProtocolBodyRequest::ProtocolBodyRequest()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
+class ProtocolBodyRequest::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ProtocolBodyRequest>()._impl_._has_bits_);
+  static void set_has_servicename(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_methodindex(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_callid(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_content(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_serviceid(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_streamwindow(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_clientstreamwindow(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+};
 
-void ProtocolBodyRequest::InitAsDefaultInstance() {
+ProtocolBodyRequest::ProtocolBodyRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ProtocolBodyRequest)
 }
-
 ProtocolBodyRequest::ProtocolBodyRequest(const ProtocolBodyRequest& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ProtocolBodyRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.servicename_){}
+    , decltype(_impl_.content_){}
+    , decltype(_impl_.methodindex_){}
+    , decltype(_impl_.callid_){}
+    , decltype(_impl_.serviceid_){}
+    , decltype(_impl_.streamwindow_){}
+    , decltype(_impl_.clientstreamwindow_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.servicename_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.servicename_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_servicename()) {
+    _this->_impl_.servicename_.Set(from._internal_servicename(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.content_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.content_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_content()) {
+    _this->_impl_.content_.Set(from._internal_content(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.methodindex_, &from._impl_.methodindex_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.clientstreamwindow_) -
+    reinterpret_cast<char*>(&_impl_.methodindex_)) + sizeof(_impl_.clientstreamwindow_));
+  // @@protoc_insertion_point(copy_constructor:ProtocolBodyRequest)
 }
 
-void ProtocolBodyRequest::SharedCtor() {
-  _cached_size_ = 0;
-  servicename_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  methodindex_ = 0u;
-  callid_ = 0u;
-  content_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+inline void ProtocolBodyRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.servicename_){}
+    , decltype(_impl_.content_){}
+    , decltype(_impl_.methodindex_){0u}
+    , decltype(_impl_.callid_){0u}
+    , decltype(_impl_.serviceid_){0u}
+    , decltype(_impl_.streamwindow_){0u}
+    , decltype(_impl_.clientstreamwindow_){0u}
+  };
+  _impl_.servicename_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.servicename_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.content_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.content_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 ProtocolBodyRequest::~ProtocolBodyRequest() {
+  // @@protoc_insertion_point(destructor:ProtocolBodyRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void ProtocolBodyRequest::SharedDtor() {
-  if (servicename_ != &::google::protobuf::internal::kEmptyString) {
-    delete servicename_;
-  }
-  if (content_ != &::google::protobuf::internal::kEmptyString) {
-    delete content_;
-  }
-  if (this != default_instance_) {
-  }
+inline void ProtocolBodyRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.servicename_.Destroy();
+  _impl_.content_.Destroy();
 }
 
 void ProtocolBodyRequest::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* ProtocolBodyRequest::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return ProtocolBodyRequest_descriptor_;
-}
-
-const ProtocolBodyRequest& ProtocolBodyRequest::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_ProtocolBody_2eproto();
-  return *default_instance_;
+  _impl_._cached_size_.Set(size);
 }
 
-ProtocolBodyRequest* ProtocolBodyRequest::default_instance_ = NULL;
-
-ProtocolBodyRequest* ProtocolBodyRequest::New() const {
-  return new ProtocolBodyRequest;
+void ProtocolBodyRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:ProtocolBodyRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.servicename_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.content_.ClearNonDefaultToEmpty();
+    }
+  }
+  if (cached_has_bits & 0x0000007cu) {
+    ::memset(&_impl_.methodindex_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.clientstreamwindow_) -
+        reinterpret_cast<char*>(&_impl_.methodindex_)) + sizeof(_impl_.clientstreamwindow_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void ProtocolBodyRequest::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (has_servicename()) {
-      if (servicename_ != &::google::protobuf::internal::kEmptyString) {
-        servicename_->clear();
-      }
-    }
-    methodindex_ = 0u;
-    callid_ = 0u;
-    if (has_content()) {
-      if (content_ != &::google::protobuf::internal::kEmptyString) {
-        content_->clear();
-      }
-    }
-  }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool ProtocolBodyRequest::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* ProtocolBodyRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // optional string serviceName = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_servicename()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->servicename().data(), this->servicename().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(16)) goto parse_methodIndex;
-        break;
-      }
-
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_servicename();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "ProtocolBodyRequest.serviceName");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
       // optional uint32 methodIndex = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_methodIndex:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &methodindex_)));
-          set_has_methodindex();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(24)) goto parse_callId;
-        break;
-      }
-
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_methodindex(&has_bits);
+          _impl_.methodindex_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional uint32 callId = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_callId:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &callid_)));
-          set_has_callid();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(34)) goto parse_content;
-        break;
-      }
-
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_callid(&has_bits);
+          _impl_.callid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional bytes content = 4;
-      case 4: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_content:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_content()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_content();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 serviceId = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_serviceid(&has_bits);
+          _impl_.serviceid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 streamWindow = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_streamwindow(&has_bits);
+          _impl_.streamwindow_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 clientStreamWindow = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_clientstreamwindow(&has_bits);
+          _impl_.clientstreamwindow_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-  return true;
-#undef DO_
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void ProtocolBodyRequest::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+uint8_t* ProtocolBodyRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ProtocolBodyRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // optional string serviceName = 1;
-  if (has_servicename()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->servicename().data(), this->servicename().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      1, this->servicename(), output);
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_servicename().data(), static_cast<int>(this->_internal_servicename().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "ProtocolBodyRequest.serviceName");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_servicename(), target);
   }
 
   // optional uint32 methodIndex = 2;
-  if (has_methodindex()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(2, this->methodindex(), output);
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_methodindex(), target);
   }
 
   // optional uint32 callId = 3;
-  if (has_callid()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(3, this->callid(), output);
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_callid(), target);
   }
 
   // optional bytes content = 4;
-  if (has_content()) {
-    ::google::protobuf::internal::WireFormatLite::WriteBytes(
-      4, this->content(), output);
-  }
-
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
-  }
-}
-
-::google::protobuf::uint8* ProtocolBodyRequest::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // optional string serviceName = 1;
-  if (has_servicename()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->servicename().data(), this->servicename().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->servicename(), target);
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->WriteBytesMaybeAliased(
+        4, this->_internal_content(), target);
   }
 
-  // optional uint32 methodIndex = 2;
-  if (has_methodindex()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(2, this->methodindex(), target);
+  // optional uint32 serviceId = 5;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_serviceid(), target);
   }
 
-  // optional uint32 callId = 3;
-  if (has_callid()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(3, this->callid(), target);
+  // optional uint32 streamWindow = 6;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_streamwindow(), target);
   }
 
-  // optional bytes content = 4;
-  if (has_content()) {
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
-        4, this->content(), target);
+  // optional uint32 clientStreamWindow = 7;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(7, this->_internal_clientstreamwindow(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:ProtocolBodyRequest)
   return target;
 }
 
-int ProtocolBodyRequest::ByteSize() const {
-  int total_size = 0;
+size_t ProtocolBodyRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ProtocolBodyRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000007fu) {
     // optional string serviceName = 1;
-    if (has_servicename()) {
+    if (cached_has_bits & 0x00000001u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->servicename());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_servicename());
     }
 
-    // optional uint32 methodIndex = 2;
-    if (has_methodindex()) {
+    // optional bytes content = 4;
+    if (cached_has_bits & 0x00000002u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt32Size(
-          this->methodindex());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_content());
+    }
+
+    // optional uint32 methodIndex = 2;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_methodindex());
     }
 
     // optional uint32 callId = 3;
-    if (has_callid()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt32Size(
-          this->callid());
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_callid());
     }
 
-    // optional bytes content = 4;
-    if (has_content()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::BytesSize(
-          this->content());
+    // optional uint32 serviceId = 5;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_serviceid());
     }
 
-  }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
+    // optional uint32 streamWindow = 6;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_streamwindow());
+    }
+
+    // optional uint32 clientStreamWindow = 7;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_clientstreamwindow());
+    }
 
-void ProtocolBodyRequest::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const ProtocolBodyRequest* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const ProtocolBodyRequest*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
   }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void ProtocolBodyRequest::MergeFrom(const ProtocolBodyRequest& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_servicename()) {
-      set_servicename(from.servicename());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ProtocolBodyRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ProtocolBodyRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ProtocolBodyRequest::GetClassData() const { return &_class_data_; }
+
+
+void ProtocolBodyRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ProtocolBodyRequest*>(&to_msg);
+  auto& from = static_cast<const ProtocolBodyRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ProtocolBodyRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000007fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_servicename(from._internal_servicename());
     }
-    if (from.has_methodindex()) {
-      set_methodindex(from.methodindex());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_content(from._internal_content());
     }
-    if (from.has_callid()) {
-      set_callid(from.callid());
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.methodindex_ = from._impl_.methodindex_;
     }
-    if (from.has_content()) {
-      set_content(from.content());
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.callid_ = from._impl_.callid_;
     }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.serviceid_ = from._impl_.serviceid_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.streamwindow_ = from._impl_.streamwindow_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.clientstreamwindow_ = from._impl_.clientstreamwindow_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void ProtocolBodyRequest::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void ProtocolBodyRequest::CopyFrom(const ProtocolBodyRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ProtocolBodyRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool ProtocolBodyRequest::IsInitialized() const {
-
   return true;
 }
 
-void ProtocolBodyRequest::Swap(ProtocolBodyRequest* other) {
-  if (other != this) {
-    std::swap(servicename_, other->servicename_);
-    std::swap(methodindex_, other->methodindex_);
-    std::swap(callid_, other->callid_);
-    std::swap(content_, other->content_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void ProtocolBodyRequest::InternalSwap(ProtocolBodyRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.servicename_, lhs_arena,
+      &other->_impl_.servicename_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.content_, lhs_arena,
+      &other->_impl_.content_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ProtocolBodyRequest, _impl_.clientstreamwindow_)
+      + sizeof(ProtocolBodyRequest::_impl_.clientstreamwindow_)
+      - PROTOBUF_FIELD_OFFSET(ProtocolBodyRequest, _impl_.methodindex_)>(
+          reinterpret_cast<char*>(&_impl_.methodindex_),
+          reinterpret_cast<char*>(&other->_impl_.methodindex_));
 }
 
-::google::protobuf::Metadata ProtocolBodyRequest::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = ProtocolBodyRequest_descriptor_;
-  metadata.reflection = ProtocolBodyRequest_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata ProtocolBodyRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ProtocolBody_2eproto_getter, &descriptor_table_ProtocolBody_2eproto_once,
+      file_level_metadata_ProtocolBody_2eproto[0]);
 }
 
-
 // ===================================================================
 
-#ifndef _MSC_VER
-const int ProtocolBodyResponse::kCallIdFieldNumber;
-const int ProtocolBodyResponse::kContentFieldNumber;
-#endif  // !_MSC_VER
-
-ProtocolBodyResponse::ProtocolBodyResponse()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
+class ProtocolBodyResponse::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ProtocolBodyResponse>()._impl_._has_bits_);
+  static void set_has_callid(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_content(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_error(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
 
-void ProtocolBodyResponse::InitAsDefaultInstance() {
+ProtocolBodyResponse::ProtocolBodyResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ProtocolBodyResponse)
 }
-
 ProtocolBodyResponse::ProtocolBodyResponse(const ProtocolBodyResponse& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ProtocolBodyResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.content_){}
+    , decltype(_impl_.error_){}
+    , decltype(_impl_.callid_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.content_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.content_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_content()) {
+    _this->_impl_.content_.Set(from._internal_content(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.error_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_error()) {
+    _this->_impl_.error_.Set(from._internal_error(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.callid_ = from._impl_.callid_;
+  // @@protoc_insertion_point(copy_constructor:ProtocolBodyResponse)
 }
 
-void ProtocolBodyResponse::SharedCtor() {
-  _cached_size_ = 0;
-  callid_ = 0u;
-  content_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+inline void ProtocolBodyResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.content_){}
+    , decltype(_impl_.error_){}
+    , decltype(_impl_.callid_){0u}
+  };
+  _impl_.content_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.content_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.error_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 ProtocolBodyResponse::~ProtocolBodyResponse() {
+  // @@protoc_insertion_point(destructor:ProtocolBodyResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void ProtocolBodyResponse::SharedDtor() {
-  if (content_ != &::google::protobuf::internal::kEmptyString) {
-    delete content_;
-  }
-  if (this != default_instance_) {
-  }
+inline void ProtocolBodyResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.content_.Destroy();
+  _impl_.error_.Destroy();
 }
 
 void ProtocolBodyResponse::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  _impl_._cached_size_.Set(size);
 }
-const ::google::protobuf::Descriptor* ProtocolBodyResponse::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return ProtocolBodyResponse_descriptor_;
+
+void ProtocolBodyResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:ProtocolBodyResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.content_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.error_.ClearNonDefaultToEmpty();
+    }
+  }
+  _impl_.callid_ = 0u;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const ProtocolBodyResponse& ProtocolBodyResponse::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_ProtocolBody_2eproto();
-  return *default_instance_;
+const char* ProtocolBodyResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 callId = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_callid(&has_bits);
+          _impl_.callid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bytes content = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_content();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string error = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_error();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "ProtocolBodyResponse.error");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-ProtocolBodyResponse* ProtocolBodyResponse::default_instance_ = NULL;
+uint8_t* ProtocolBodyResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ProtocolBodyResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 callId = 1;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_callid(), target);
+  }
 
-ProtocolBodyResponse* ProtocolBodyResponse::New() const {
-  return new ProtocolBodyResponse;
+  // optional bytes content = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_content(), target);
+  }
+
+  // optional string error = 3;
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_error().data(), static_cast<int>(this->_internal_error().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "ProtocolBodyResponse.error");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_error(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ProtocolBodyResponse)
+  return target;
 }
 
-void ProtocolBodyResponse::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    callid_ = 0u;
-    if (has_content()) {
-      if (content_ != &::google::protobuf::internal::kEmptyString) {
-        content_->clear();
-      }
+size_t ProtocolBodyResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ProtocolBodyResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional bytes content = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_content());
     }
+
+    // optional string error = 3;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_error());
+    }
+
+    // optional uint32 callId = 1;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_callid());
+    }
+
   }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-bool ProtocolBodyResponse::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // optional uint32 callId = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &callid_)));
-          set_has_callid();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(18)) goto parse_content;
-        break;
-      }
-
-      // optional bytes content = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_content:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_content()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ProtocolBodyResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ProtocolBodyResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ProtocolBodyResponse::GetClassData() const { return &_class_data_; }
+
+
+void ProtocolBodyResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ProtocolBodyResponse*>(&to_msg);
+  auto& from = static_cast<const ProtocolBodyResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ProtocolBodyResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_content(from._internal_content());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_error(from._internal_error());
     }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.callid_ = from._impl_.callid_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ProtocolBodyResponse::CopyFrom(const ProtocolBodyResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ProtocolBodyResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ProtocolBodyResponse::IsInitialized() const {
   return true;
-#undef DO_
 }
 
-void ProtocolBodyResponse::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // optional uint32 callId = 1;
-  if (has_callid()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->callid(), output);
+void ProtocolBodyResponse::InternalSwap(ProtocolBodyResponse* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.content_, lhs_arena,
+      &other->_impl_.content_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.error_, lhs_arena,
+      &other->_impl_.error_, rhs_arena
+  );
+  swap(_impl_.callid_, other->_impl_.callid_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ProtocolBodyResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ProtocolBody_2eproto_getter, &descriptor_table_ProtocolBody_2eproto_once,
+      file_level_metadata_ProtocolBody_2eproto[1]);
+}
+
+// ===================================================================
+
+class ProtocolBodyStream::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ProtocolBodyStream>()._impl_._has_bits_);
+  static void set_has_callid(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_content(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
   }
+  static void set_has_frame(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_error(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
 
-  // optional bytes content = 2;
-  if (has_content()) {
-    ::google::protobuf::internal::WireFormatLite::WriteBytes(
-      2, this->content(), output);
+ProtocolBodyStream::ProtocolBodyStream(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ProtocolBodyStream)
+}
+ProtocolBodyStream::ProtocolBodyStream(const ProtocolBodyStream& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ProtocolBodyStream* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.content_){}
+    , decltype(_impl_.error_){}
+    , decltype(_impl_.callid_){}
+    , decltype(_impl_.frame_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.content_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.content_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_content()) {
+    _this->_impl_.content_.Set(from._internal_content(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.error_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_error()) {
+    _this->_impl_.error_.Set(from._internal_error(), 
+      _this->GetArenaForAllocation());
   }
+  ::memcpy(&_impl_.callid_, &from._impl_.callid_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.frame_) -
+    reinterpret_cast<char*>(&_impl_.callid_)) + sizeof(_impl_.frame_));
+  // @@protoc_insertion_point(copy_constructor:ProtocolBodyStream)
+}
+
+inline void ProtocolBodyStream::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.content_){}
+    , decltype(_impl_.error_){}
+    , decltype(_impl_.callid_){0u}
+    , decltype(_impl_.frame_){0u}
+  };
+  _impl_.content_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.content_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.error_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+ProtocolBodyStream::~ProtocolBodyStream() {
+  // @@protoc_insertion_point(destructor:ProtocolBodyStream)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
+  SharedDtor();
+}
+
+inline void ProtocolBodyStream::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.content_.Destroy();
+  _impl_.error_.Destroy();
+}
+
+void ProtocolBodyStream::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ProtocolBodyStream::Clear() {
+// @@protoc_insertion_point(message_clear_start:ProtocolBodyStream)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.content_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.error_.ClearNonDefaultToEmpty();
+    }
+  }
+  if (cached_has_bits & 0x0000000cu) {
+    ::memset(&_impl_.callid_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.frame_) -
+        reinterpret_cast<char*>(&_impl_.callid_)) + sizeof(_impl_.frame_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-::google::protobuf::uint8* ProtocolBodyResponse::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
+const char* ProtocolBodyStream::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 callId = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_callid(&has_bits);
+          _impl_.callid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bytes content = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_content();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 frame = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_frame(&has_bits);
+          _impl_.frame_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string error = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_error();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "ProtocolBodyStream.error");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ProtocolBodyStream::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ProtocolBodyStream)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // optional uint32 callId = 1;
-  if (has_callid()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(1, this->callid(), target);
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_callid(), target);
   }
 
   // optional bytes content = 2;
-  if (has_content()) {
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
-        2, this->content(), target);
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_content(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  // optional uint32 frame = 3;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_frame(), target);
   }
+
+  // optional string error = 4;
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_error().data(), static_cast<int>(this->_internal_error().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "ProtocolBodyStream.error");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_error(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ProtocolBodyStream)
   return target;
 }
 
-int ProtocolBodyResponse::ByteSize() const {
-  int total_size = 0;
+size_t ProtocolBodyStream::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ProtocolBodyStream)
+  size_t total_size = 0;
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // optional uint32 callId = 1;
-    if (has_callid()) {
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    // optional bytes content = 2;
+    if (cached_has_bits & 0x00000001u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt32Size(
-          this->callid());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_content());
     }
 
-    // optional bytes content = 2;
-    if (has_content()) {
+    // optional string error = 4;
+    if (cached_has_bits & 0x00000002u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::BytesSize(
-          this->content());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_error());
     }
 
-  }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
+    // optional uint32 callId = 1;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_callid());
+    }
+
+    // optional uint32 frame = 3;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_frame());
+    }
 
-void ProtocolBodyResponse::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const ProtocolBodyResponse* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const ProtocolBodyResponse*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
   }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void ProtocolBodyResponse::MergeFrom(const ProtocolBodyResponse& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_callid()) {
-      set_callid(from.callid());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ProtocolBodyStream::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ProtocolBodyStream::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ProtocolBodyStream::GetClassData() const { return &_class_data_; }
+
+
+void ProtocolBodyStream::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ProtocolBodyStream*>(&to_msg);
+  auto& from = static_cast<const ProtocolBodyStream&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ProtocolBodyStream)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_content(from._internal_content());
     }
-    if (from.has_content()) {
-      set_content(from.content());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_error(from._internal_error());
     }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.callid_ = from._impl_.callid_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.frame_ = from._impl_.frame_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void ProtocolBodyResponse::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void ProtocolBodyResponse::CopyFrom(const ProtocolBodyResponse& from) {
+void ProtocolBodyStream::CopyFrom(const ProtocolBodyStream& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ProtocolBodyStream)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool ProtocolBodyResponse::IsInitialized() const {
-
+bool ProtocolBodyStream::IsInitialized() const {
   return true;
 }
 
-void ProtocolBodyResponse::Swap(ProtocolBodyResponse* other) {
-  if (other != this) {
-    std::swap(callid_, other->callid_);
-    std::swap(content_, other->content_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void ProtocolBodyStream::InternalSwap(ProtocolBodyStream* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.content_, lhs_arena,
+      &other->_impl_.content_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.error_, lhs_arena,
+      &other->_impl_.error_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ProtocolBodyStream, _impl_.frame_)
+      + sizeof(ProtocolBodyStream::_impl_.frame_)
+      - PROTOBUF_FIELD_OFFSET(ProtocolBodyStream, _impl_.callid_)>(
+          reinterpret_cast<char*>(&_impl_.callid_),
+          reinterpret_cast<char*>(&other->_impl_.callid_));
 }
 
-::google::protobuf::Metadata ProtocolBodyResponse::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = ProtocolBodyResponse_descriptor_;
-  metadata.reflection = ProtocolBodyResponse_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata ProtocolBodyStream::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ProtocolBody_2eproto_getter, &descriptor_table_ProtocolBody_2eproto_once,
+      file_level_metadata_ProtocolBody_2eproto[2]);
 }
 
-
 // @@protoc_insertion_point(namespace_scope)
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::ProtocolBodyRequest*
+Arena::CreateMaybeMessage< ::ProtocolBodyRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ProtocolBodyRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ProtocolBodyResponse*
+Arena::CreateMaybeMessage< ::ProtocolBodyResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ProtocolBodyResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ProtocolBodyStream*
+Arena::CreateMaybeMessage< ::ProtocolBodyStream >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ProtocolBodyStream >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -1,447 +1,1024 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: ProtocolBody.proto
 
-#ifndef PROTOBUF_ProtocolBody_2eproto__INCLUDED
-#define PROTOBUF_ProtocolBody_2eproto__INCLUDED
+#ifndef GOOGLE_PROTOBUF_INCLUDED_ProtocolBody_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_ProtocolBody_2eproto
 
+#include <limits>
 #include <string>
 
-#include <google/protobuf/stubs/common.h>
-
-#if GOOGLE_PROTOBUF_VERSION < 2005000
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please update
+#error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 2005000 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please
+#error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
 #endif
 
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
 #include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
-#include <google/protobuf/repeated_field.h>
-#include <google/protobuf/extension_set.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
 #include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
-
-// Internal implementation detail -- do not call these.
-void  protobuf_AddDesc_ProtocolBody_2eproto();
-void protobuf_AssignDesc_ProtocolBody_2eproto();
-void protobuf_ShutdownFile_ProtocolBody_2eproto();
-
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_ProtocolBody_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_ProtocolBody_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_ProtocolBody_2eproto;
 class ProtocolBodyRequest;
+struct ProtocolBodyRequestDefaultTypeInternal;
+extern ProtocolBodyRequestDefaultTypeInternal _ProtocolBodyRequest_default_instance_;
 class ProtocolBodyResponse;
+struct ProtocolBodyResponseDefaultTypeInternal;
+extern ProtocolBodyResponseDefaultTypeInternal _ProtocolBodyResponse_default_instance_;
+class ProtocolBodyStream;
+struct ProtocolBodyStreamDefaultTypeInternal;
+extern ProtocolBodyStreamDefaultTypeInternal _ProtocolBodyStream_default_instance_;
+PROTOBUF_NAMESPACE_OPEN
+template<> ::ProtocolBodyRequest* Arena::CreateMaybeMessage<::ProtocolBodyRequest>(Arena*);
+template<> ::ProtocolBodyResponse* Arena::CreateMaybeMessage<::ProtocolBodyResponse>(Arena*);
+template<> ::ProtocolBodyStream* Arena::CreateMaybeMessage<::ProtocolBodyStream>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
 
 // ===================================================================
 
-class ProtocolBodyRequest : public ::google::protobuf::Message {
+class ProtocolBodyRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ProtocolBodyRequest) */ {
  public:
-  ProtocolBodyRequest();
-  virtual ~ProtocolBodyRequest();
+  inline ProtocolBodyRequest() : ProtocolBodyRequest(nullptr) {}
+  ~ProtocolBodyRequest() override;
+  explicit PROTOBUF_CONSTEXPR ProtocolBodyRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   ProtocolBodyRequest(const ProtocolBodyRequest& from);
+  ProtocolBodyRequest(ProtocolBodyRequest&& from) noexcept
+    : ProtocolBodyRequest() {
+    *this = ::std::move(from);
+  }
 
   inline ProtocolBodyRequest& operator=(const ProtocolBodyRequest& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline ProtocolBodyRequest& operator=(ProtocolBodyRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const ProtocolBodyRequest& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ProtocolBodyRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ProtocolBodyRequest* internal_default_instance() {
+    return reinterpret_cast<const ProtocolBodyRequest*>(
+               &_ProtocolBodyRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
 
-  void Swap(ProtocolBodyRequest* other);
+  friend void swap(ProtocolBodyRequest& a, ProtocolBodyRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ProtocolBodyRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ProtocolBodyRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  ProtocolBodyRequest* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  ProtocolBodyRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ProtocolBodyRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const ProtocolBodyRequest& from);
-  void MergeFrom(const ProtocolBodyRequest& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ProtocolBodyRequest& from) {
+    ProtocolBodyRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ProtocolBodyRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ProtocolBodyRequest";
+  }
+  protected:
+  explicit ProtocolBodyRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kServiceNameFieldNumber = 1,
+    kContentFieldNumber = 4,
+    kMethodIndexFieldNumber = 2,
+    kCallIdFieldNumber = 3,
+    kServiceIdFieldNumber = 5,
+    kStreamWindowFieldNumber = 6,
+    kClientStreamWindowFieldNumber = 7,
+  };
   // optional string serviceName = 1;
-  inline bool has_servicename() const;
-  inline void clear_servicename();
-  static const int kServiceNameFieldNumber = 1;
-  inline const ::std::string& servicename() const;
-  inline void set_servicename(const ::std::string& value);
-  inline void set_servicename(const char* value);
-  inline void set_servicename(const char* value, size_t size);
-  inline ::std::string* mutable_servicename();
-  inline ::std::string* release_servicename();
-  inline void set_allocated_servicename(::std::string* servicename);
+  bool has_servicename() const;
+  private:
+  bool _internal_has_servicename() const;
+  public:
+  void clear_servicename();
+  const std::string& servicename() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_servicename(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_servicename();
+  PROTOBUF_NODISCARD std::string* release_servicename();
+  void set_allocated_servicename(std::string* servicename);
+  private:
+  const std::string& _internal_servicename() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_servicename(const std::string& value);
+  std::string* _internal_mutable_servicename();
+  public:
+
+  // optional bytes content = 4;
+  bool has_content() const;
+  private:
+  bool _internal_has_content() const;
+  public:
+  void clear_content();
+  const std::string& content() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_content(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_content();
+  PROTOBUF_NODISCARD std::string* release_content();
+  void set_allocated_content(std::string* content);
+  private:
+  const std::string& _internal_content() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_content(const std::string& value);
+  std::string* _internal_mutable_content();
+  public:
 
   // optional uint32 methodIndex = 2;
-  inline bool has_methodindex() const;
-  inline void clear_methodindex();
-  static const int kMethodIndexFieldNumber = 2;
-  inline ::google::protobuf::uint32 methodindex() const;
-  inline void set_methodindex(::google::protobuf::uint32 value);
+  bool has_methodindex() const;
+  private:
+  bool _internal_has_methodindex() const;
+  public:
+  void clear_methodindex();
+  uint32_t methodindex() const;
+  void set_methodindex(uint32_t value);
+  private:
+  uint32_t _internal_methodindex() const;
+  void _internal_set_methodindex(uint32_t value);
+  public:
 
   // optional uint32 callId = 3;
-  inline bool has_callid() const;
-  inline void clear_callid();
-  static const int kCallIdFieldNumber = 3;
-  inline ::google::protobuf::uint32 callid() const;
-  inline void set_callid(::google::protobuf::uint32 value);
+  bool has_callid() const;
+  private:
+  bool _internal_has_callid() const;
+  public:
+  void clear_callid();
+  uint32_t callid() const;
+  void set_callid(uint32_t value);
+  private:
+  uint32_t _internal_callid() const;
+  void _internal_set_callid(uint32_t value);
+  public:
 
-  // optional bytes content = 4;
-  inline bool has_content() const;
-  inline void clear_content();
-  static const int kContentFieldNumber = 4;
-  inline const ::std::string& content() const;
-  inline void set_content(const ::std::string& value);
-  inline void set_content(const char* value);
-  inline void set_content(const void* value, size_t size);
-  inline ::std::string* mutable_content();
-  inline ::std::string* release_content();
-  inline void set_allocated_content(::std::string* content);
+  // optional uint32 serviceId = 5;
+  bool has_serviceid() const;
+  private:
+  bool _internal_has_serviceid() const;
+  public:
+  void clear_serviceid();
+  uint32_t serviceid() const;
+  void set_serviceid(uint32_t value);
+  private:
+  uint32_t _internal_serviceid() const;
+  void _internal_set_serviceid(uint32_t value);
+  public:
+
+  // optional uint32 streamWindow = 6;
+  bool has_streamwindow() const;
+  private:
+  bool _internal_has_streamwindow() const;
+  public:
+  void clear_streamwindow();
+  uint32_t streamwindow() const;
+  void set_streamwindow(uint32_t value);
+  private:
+  uint32_t _internal_streamwindow() const;
+  void _internal_set_streamwindow(uint32_t value);
+  public:
+
+  // optional uint32 clientStreamWindow = 7;
+  bool has_clientstreamwindow() const;
+  private:
+  bool _internal_has_clientstreamwindow() const;
+  public:
+  void clear_clientstreamwindow();
+  uint32_t clientstreamwindow() const;
+  void set_clientstreamwindow(uint32_t value);
+  private:
+  uint32_t _internal_clientstreamwindow() const;
+  void _internal_set_clientstreamwindow(uint32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:ProtocolBodyRequest)
  private:
-  inline void set_has_servicename();
-  inline void clear_has_servicename();
-  inline void set_has_methodindex();
-  inline void clear_has_methodindex();
-  inline void set_has_callid();
-  inline void clear_has_callid();
-  inline void set_has_content();
-  inline void clear_has_content();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::std::string* servicename_;
-  ::google::protobuf::uint32 methodindex_;
-  ::google::protobuf::uint32 callid_;
-  ::std::string* content_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(4 + 31) / 32];
-
-  friend void  protobuf_AddDesc_ProtocolBody_2eproto();
-  friend void protobuf_AssignDesc_ProtocolBody_2eproto();
-  friend void protobuf_ShutdownFile_ProtocolBody_2eproto();
-
-  void InitAsDefaultInstance();
-  static ProtocolBodyRequest* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr servicename_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr content_;
+    uint32_t methodindex_;
+    uint32_t callid_;
+    uint32_t serviceid_;
+    uint32_t streamwindow_;
+    uint32_t clientstreamwindow_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_ProtocolBody_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ProtocolBodyResponse : public ::google::protobuf::Message {
+class ProtocolBodyResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ProtocolBodyResponse) */ {
  public:
-  ProtocolBodyResponse();
-  virtual ~ProtocolBodyResponse();
+  inline ProtocolBodyResponse() : ProtocolBodyResponse(nullptr) {}
+  ~ProtocolBodyResponse() override;
+  explicit PROTOBUF_CONSTEXPR ProtocolBodyResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   ProtocolBodyResponse(const ProtocolBodyResponse& from);
+  ProtocolBodyResponse(ProtocolBodyResponse&& from) noexcept
+    : ProtocolBodyResponse() {
+    *this = ::std::move(from);
+  }
 
   inline ProtocolBodyResponse& operator=(const ProtocolBodyResponse& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline ProtocolBodyResponse& operator=(ProtocolBodyResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const ProtocolBodyResponse& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ProtocolBodyResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ProtocolBodyResponse* internal_default_instance() {
+    return reinterpret_cast<const ProtocolBodyResponse*>(
+               &_ProtocolBodyResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
 
-  void Swap(ProtocolBodyResponse* other);
+  friend void swap(ProtocolBodyResponse& a, ProtocolBodyResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ProtocolBodyResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ProtocolBodyResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  ProtocolBodyResponse* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  ProtocolBodyResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ProtocolBodyResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const ProtocolBodyResponse& from);
-  void MergeFrom(const ProtocolBodyResponse& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ProtocolBodyResponse& from) {
+    ProtocolBodyResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ProtocolBodyResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ProtocolBodyResponse";
+  }
+  protected:
+  explicit ProtocolBodyResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional uint32 callId = 1;
-  inline bool has_callid() const;
-  inline void clear_callid();
-  static const int kCallIdFieldNumber = 1;
-  inline ::google::protobuf::uint32 callid() const;
-  inline void set_callid(::google::protobuf::uint32 value);
-
+  enum : int {
+    kContentFieldNumber = 2,
+    kErrorFieldNumber = 3,
+    kCallIdFieldNumber = 1,
+  };
   // optional bytes content = 2;
-  inline bool has_content() const;
-  inline void clear_content();
-  static const int kContentFieldNumber = 2;
-  inline const ::std::string& content() const;
-  inline void set_content(const ::std::string& value);
-  inline void set_content(const char* value);
-  inline void set_content(const void* value, size_t size);
-  inline ::std::string* mutable_content();
-  inline ::std::string* release_content();
-  inline void set_allocated_content(::std::string* content);
+  bool has_content() const;
+  private:
+  bool _internal_has_content() const;
+  public:
+  void clear_content();
+  const std::string& content() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_content(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_content();
+  PROTOBUF_NODISCARD std::string* release_content();
+  void set_allocated_content(std::string* content);
+  private:
+  const std::string& _internal_content() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_content(const std::string& value);
+  std::string* _internal_mutable_content();
+  public:
+
+  // optional string error = 3;
+  bool has_error() const;
+  private:
+  bool _internal_has_error() const;
+  public:
+  void clear_error();
+  const std::string& error() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_error();
+  PROTOBUF_NODISCARD std::string* release_error();
+  void set_allocated_error(std::string* error);
+  private:
+  const std::string& _internal_error() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error(const std::string& value);
+  std::string* _internal_mutable_error();
+  public:
+
+  // optional uint32 callId = 1;
+  bool has_callid() const;
+  private:
+  bool _internal_has_callid() const;
+  public:
+  void clear_callid();
+  uint32_t callid() const;
+  void set_callid(uint32_t value);
+  private:
+  uint32_t _internal_callid() const;
+  void _internal_set_callid(uint32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:ProtocolBodyResponse)
  private:
-  inline void set_has_callid();
-  inline void clear_has_callid();
-  inline void set_has_content();
-  inline void clear_has_content();
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr content_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_;
+    uint32_t callid_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_ProtocolBody_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ProtocolBodyStream final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ProtocolBodyStream) */ {
+ public:
+  inline ProtocolBodyStream() : ProtocolBodyStream(nullptr) {}
+  ~ProtocolBodyStream() override;
+  explicit PROTOBUF_CONSTEXPR ProtocolBodyStream(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ProtocolBodyStream(const ProtocolBodyStream& from);
+  ProtocolBodyStream(ProtocolBodyStream&& from) noexcept
+    : ProtocolBodyStream() {
+    *this = ::std::move(from);
+  }
+
+  inline ProtocolBodyStream& operator=(const ProtocolBodyStream& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ProtocolBodyStream& operator=(ProtocolBodyStream&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ProtocolBodyStream& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ProtocolBodyStream* internal_default_instance() {
+    return reinterpret_cast<const ProtocolBodyStream*>(
+               &_ProtocolBodyStream_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(ProtocolBodyStream& a, ProtocolBodyStream& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ProtocolBodyStream* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ProtocolBodyStream* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ProtocolBodyStream* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ProtocolBodyStream>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ProtocolBodyStream& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ProtocolBodyStream& from) {
+    ProtocolBodyStream::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ProtocolBodyStream* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ProtocolBodyStream";
+  }
+  protected:
+  explicit ProtocolBodyStream(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kContentFieldNumber = 2,
+    kErrorFieldNumber = 4,
+    kCallIdFieldNumber = 1,
+    kFrameFieldNumber = 3,
+  };
+  // optional bytes content = 2;
+  bool has_content() const;
+  private:
+  bool _internal_has_content() const;
+  public:
+  void clear_content();
+  const std::string& content() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_content(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_content();
+  PROTOBUF_NODISCARD std::string* release_content();
+  void set_allocated_content(std::string* content);
+  private:
+  const std::string& _internal_content() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_content(const std::string& value);
+  std::string* _internal_mutable_content();
+  public:
 
-  ::std::string* content_;
-  ::google::protobuf::uint32 callid_;
+  // optional string error = 4;
+  bool has_error() const;
+  private:
+  bool _internal_has_error() const;
+  public:
+  void clear_error();
+  const std::string& error() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_error();
+  PROTOBUF_NODISCARD std::string* release_error();
+  void set_allocated_error(std::string* error);
+  private:
+  const std::string& _internal_error() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error(const std::string& value);
+  std::string* _internal_mutable_error();
+  public:
 
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
+  // optional uint32 callId = 1;
+  bool has_callid() const;
+  private:
+  bool _internal_has_callid() const;
+  public:
+  void clear_callid();
+  uint32_t callid() const;
+  void set_callid(uint32_t value);
+  private:
+  uint32_t _internal_callid() const;
+  void _internal_set_callid(uint32_t value);
+  public:
 
-  friend void  protobuf_AddDesc_ProtocolBody_2eproto();
-  friend void protobuf_AssignDesc_ProtocolBody_2eproto();
-  friend void protobuf_ShutdownFile_ProtocolBody_2eproto();
+  // optional uint32 frame = 3;
+  bool has_frame() const;
+  private:
+  bool _internal_has_frame() const;
+  public:
+  void clear_frame();
+  uint32_t frame() const;
+  void set_frame(uint32_t value);
+  private:
+  uint32_t _internal_frame() const;
+  void _internal_set_frame(uint32_t value);
+  public:
 
-  void InitAsDefaultInstance();
-  static ProtocolBodyResponse* default_instance_;
+  // @@protoc_insertion_point(class_scope:ProtocolBodyStream)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr content_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_;
+    uint32_t callid_;
+    uint32_t frame_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_ProtocolBody_2eproto;
 };
 // ===================================================================
 
 
 // ===================================================================
 
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
 // ProtocolBodyRequest
 
 // optional string serviceName = 1;
+inline bool ProtocolBodyRequest::_internal_has_servicename() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
 inline bool ProtocolBodyRequest::has_servicename() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+  return _internal_has_servicename();
 }
-inline void ProtocolBodyRequest::set_has_servicename() {
-  _has_bits_[0] |= 0x00000001u;
+inline void ProtocolBodyRequest::clear_servicename() {
+  _impl_.servicename_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline void ProtocolBodyRequest::clear_has_servicename() {
-  _has_bits_[0] &= ~0x00000001u;
+inline const std::string& ProtocolBodyRequest::servicename() const {
+  // @@protoc_insertion_point(field_get:ProtocolBodyRequest.serviceName)
+  return _internal_servicename();
 }
-inline void ProtocolBodyRequest::clear_servicename() {
-  if (servicename_ != &::google::protobuf::internal::kEmptyString) {
-    servicename_->clear();
-  }
-  clear_has_servicename();
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ProtocolBodyRequest::set_servicename(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.servicename_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ProtocolBodyRequest.serviceName)
 }
-inline const ::std::string& ProtocolBodyRequest::servicename() const {
-  return *servicename_;
+inline std::string* ProtocolBodyRequest::mutable_servicename() {
+  std::string* _s = _internal_mutable_servicename();
+  // @@protoc_insertion_point(field_mutable:ProtocolBodyRequest.serviceName)
+  return _s;
 }
-inline void ProtocolBodyRequest::set_servicename(const ::std::string& value) {
-  set_has_servicename();
-  if (servicename_ == &::google::protobuf::internal::kEmptyString) {
-    servicename_ = new ::std::string;
-  }
-  servicename_->assign(value);
+inline const std::string& ProtocolBodyRequest::_internal_servicename() const {
+  return _impl_.servicename_.Get();
 }
-inline void ProtocolBodyRequest::set_servicename(const char* value) {
-  set_has_servicename();
-  if (servicename_ == &::google::protobuf::internal::kEmptyString) {
-    servicename_ = new ::std::string;
-  }
-  servicename_->assign(value);
+inline void ProtocolBodyRequest::_internal_set_servicename(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.servicename_.Set(value, GetArenaForAllocation());
 }
-inline void ProtocolBodyRequest::set_servicename(const char* value, size_t size) {
-  set_has_servicename();
-  if (servicename_ == &::google::protobuf::internal::kEmptyString) {
-    servicename_ = new ::std::string;
-  }
-  servicename_->assign(reinterpret_cast<const char*>(value), size);
+inline std::string* ProtocolBodyRequest::_internal_mutable_servicename() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.servicename_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* ProtocolBodyRequest::mutable_servicename() {
-  set_has_servicename();
-  if (servicename_ == &::google::protobuf::internal::kEmptyString) {
-    servicename_ = new ::std::string;
+inline std::string* ProtocolBodyRequest::release_servicename() {
+  // @@protoc_insertion_point(field_release:ProtocolBodyRequest.serviceName)
+  if (!_internal_has_servicename()) {
+    return nullptr;
   }
-  return servicename_;
-}
-inline ::std::string* ProtocolBodyRequest::release_servicename() {
-  clear_has_servicename();
-  if (servicename_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
-  } else {
-    ::std::string* temp = servicename_;
-    servicename_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.servicename_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.servicename_.IsDefault()) {
+    _impl_.servicename_.Set("", GetArenaForAllocation());
   }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
-inline void ProtocolBodyRequest::set_allocated_servicename(::std::string* servicename) {
-  if (servicename_ != &::google::protobuf::internal::kEmptyString) {
-    delete servicename_;
-  }
-  if (servicename) {
-    set_has_servicename();
-    servicename_ = servicename;
+inline void ProtocolBodyRequest::set_allocated_servicename(std::string* servicename) {
+  if (servicename != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    clear_has_servicename();
-    servicename_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.servicename_.SetAllocated(servicename, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.servicename_.IsDefault()) {
+    _impl_.servicename_.Set("", GetArenaForAllocation());
   }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ProtocolBodyRequest.serviceName)
 }
 
 // optional uint32 methodIndex = 2;
+inline bool ProtocolBodyRequest::_internal_has_methodindex() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
 inline bool ProtocolBodyRequest::has_methodindex() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+  return _internal_has_methodindex();
 }
-inline void ProtocolBodyRequest::set_has_methodindex() {
-  _has_bits_[0] |= 0x00000002u;
+inline void ProtocolBodyRequest::clear_methodindex() {
+  _impl_.methodindex_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
-inline void ProtocolBodyRequest::clear_has_methodindex() {
-  _has_bits_[0] &= ~0x00000002u;
+inline uint32_t ProtocolBodyRequest::_internal_methodindex() const {
+  return _impl_.methodindex_;
 }
-inline void ProtocolBodyRequest::clear_methodindex() {
-  methodindex_ = 0u;
-  clear_has_methodindex();
+inline uint32_t ProtocolBodyRequest::methodindex() const {
+  // @@protoc_insertion_point(field_get:ProtocolBodyRequest.methodIndex)
+  return _internal_methodindex();
 }
-inline ::google::protobuf::uint32 ProtocolBodyRequest::methodindex() const {
-  return methodindex_;
+inline void ProtocolBodyRequest::_internal_set_methodindex(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.methodindex_ = value;
 }
-inline void ProtocolBodyRequest::set_methodindex(::google::protobuf::uint32 value) {
-  set_has_methodindex();
-  methodindex_ = value;
+inline void ProtocolBodyRequest::set_methodindex(uint32_t value) {
+  _internal_set_methodindex(value);
+  // @@protoc_insertion_point(field_set:ProtocolBodyRequest.methodIndex)
 }
 
 // optional uint32 callId = 3;
+inline bool ProtocolBodyRequest::_internal_has_callid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
 inline bool ProtocolBodyRequest::has_callid() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+  return _internal_has_callid();
 }
-inline void ProtocolBodyRequest::set_has_callid() {
-  _has_bits_[0] |= 0x00000004u;
+inline void ProtocolBodyRequest::clear_callid() {
+  _impl_.callid_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000008u;
 }
-inline void ProtocolBodyRequest::clear_has_callid() {
-  _has_bits_[0] &= ~0x00000004u;
+inline uint32_t ProtocolBodyRequest::_internal_callid() const {
+  return _impl_.callid_;
 }
-inline void ProtocolBodyRequest::clear_callid() {
-  callid_ = 0u;
-  clear_has_callid();
+inline uint32_t ProtocolBodyRequest::callid() const {
+  // @@protoc_insertion_point(field_get:ProtocolBodyRequest.callId)
+  return _internal_callid();
 }
-inline ::google::protobuf::uint32 ProtocolBodyRequest::callid() const {
-  return callid_;
+inline void ProtocolBodyRequest::_internal_set_callid(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.callid_ = value;
 }
-inline void ProtocolBodyRequest::set_callid(::google::protobuf::uint32 value) {
-  set_has_callid();
-  callid_ = value;
+inline void ProtocolBodyRequest::set_callid(uint32_t value) {
+  _internal_set_callid(value);
+  // @@protoc_insertion_point(field_set:ProtocolBodyRequest.callId)
 }
 
 // optional bytes content = 4;
+inline bool ProtocolBodyRequest::_internal_has_content() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
 inline bool ProtocolBodyRequest::has_content() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
+  return _internal_has_content();
 }
-inline void ProtocolBodyRequest::set_has_content() {
-  _has_bits_[0] |= 0x00000008u;
+inline void ProtocolBodyRequest::clear_content() {
+  _impl_.content_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline void ProtocolBodyRequest::clear_has_content() {
-  _has_bits_[0] &= ~0x00000008u;
+inline const std::string& ProtocolBodyRequest::content() const {
+  // @@protoc_insertion_point(field_get:ProtocolBodyRequest.content)
+  return _internal_content();
 }
-inline void ProtocolBodyRequest::clear_content() {
-  if (content_ != &::google::protobuf::internal::kEmptyString) {
-    content_->clear();
-  }
-  clear_has_content();
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ProtocolBodyRequest::set_content(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.content_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ProtocolBodyRequest.content)
 }
-inline const ::std::string& ProtocolBodyRequest::content() const {
-  return *content_;
+inline std::string* ProtocolBodyRequest::mutable_content() {
+  std::string* _s = _internal_mutable_content();
+  // @@protoc_insertion_point(field_mutable:ProtocolBodyRequest.content)
+  return _s;
 }
-inline void ProtocolBodyRequest::set_content(const ::std::string& value) {
-  set_has_content();
-  if (content_ == &::google::protobuf::internal::kEmptyString) {
-    content_ = new ::std::string;
-  }
-  content_->assign(value);
+inline const std::string& ProtocolBodyRequest::_internal_content() const {
+  return _impl_.content_.Get();
 }
-inline void ProtocolBodyRequest::set_content(const char* value) {
-  set_has_content();
-  if (content_ == &::google::protobuf::internal::kEmptyString) {
-    content_ = new ::std::string;
-  }
-  content_->assign(value);
+inline void ProtocolBodyRequest::_internal_set_content(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.content_.Set(value, GetArenaForAllocation());
 }
-inline void ProtocolBodyRequest::set_content(const void* value, size_t size) {
-  set_has_content();
-  if (content_ == &::google::protobuf::internal::kEmptyString) {
-    content_ = new ::std::string;
-  }
-  content_->assign(reinterpret_cast<const char*>(value), size);
+inline std::string* ProtocolBodyRequest::_internal_mutable_content() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.content_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* ProtocolBodyRequest::mutable_content() {
-  set_has_content();
-  if (content_ == &::google::protobuf::internal::kEmptyString) {
-    content_ = new ::std::string;
+inline std::string* ProtocolBodyRequest::release_content() {
+  // @@protoc_insertion_point(field_release:ProtocolBodyRequest.content)
+  if (!_internal_has_content()) {
+    return nullptr;
   }
-  return content_;
-}
-inline ::std::string* ProtocolBodyRequest::release_content() {
-  clear_has_content();
-  if (content_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
-  } else {
-    ::std::string* temp = content_;
-    content_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.content_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.content_.IsDefault()) {
+    _impl_.content_.Set("", GetArenaForAllocation());
   }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
-inline void ProtocolBodyRequest::set_allocated_content(::std::string* content) {
-  if (content_ != &::google::protobuf::internal::kEmptyString) {
-    delete content_;
-  }
-  if (content) {
-    set_has_content();
-    content_ = content;
+inline void ProtocolBodyRequest::set_allocated_content(std::string* content) {
+  if (content != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    clear_has_content();
-    content_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.content_.SetAllocated(content, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.content_.IsDefault()) {
+    _impl_.content_.Set("", GetArenaForAllocation());
   }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ProtocolBodyRequest.content)
+}
+
+// optional uint32 serviceId = 5;
+inline bool ProtocolBodyRequest::_internal_has_serviceid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool ProtocolBodyRequest::has_serviceid() const {
+  return _internal_has_serviceid();
+}
+inline void ProtocolBodyRequest::clear_serviceid() {
+  _impl_.serviceid_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint32_t ProtocolBodyRequest::_internal_serviceid() const {
+  return _impl_.serviceid_;
+}
+inline uint32_t ProtocolBodyRequest::serviceid() const {
+  // @@protoc_insertion_point(field_get:ProtocolBodyRequest.serviceId)
+  return _internal_serviceid();
+}
+inline void ProtocolBodyRequest::_internal_set_serviceid(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.serviceid_ = value;
+}
+inline void ProtocolBodyRequest::set_serviceid(uint32_t value) {
+  _internal_set_serviceid(value);
+  // @@protoc_insertion_point(field_set:ProtocolBodyRequest.serviceId)
+}
+
+// optional uint32 streamWindow = 6;
+inline bool ProtocolBodyRequest::_internal_has_streamwindow() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool ProtocolBodyRequest::has_streamwindow() const {
+  return _internal_has_streamwindow();
+}
+inline void ProtocolBodyRequest::clear_streamwindow() {
+  _impl_.streamwindow_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline uint32_t ProtocolBodyRequest::_internal_streamwindow() const {
+  return _impl_.streamwindow_;
+}
+inline uint32_t ProtocolBodyRequest::streamwindow() const {
+  // @@protoc_insertion_point(field_get:ProtocolBodyRequest.streamWindow)
+  return _internal_streamwindow();
+}
+inline void ProtocolBodyRequest::_internal_set_streamwindow(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.streamwindow_ = value;
+}
+inline void ProtocolBodyRequest::set_streamwindow(uint32_t value) {
+  _internal_set_streamwindow(value);
+  // @@protoc_insertion_point(field_set:ProtocolBodyRequest.streamWindow)
+}
+
+// optional uint32 clientStreamWindow = 7;
+inline bool ProtocolBodyRequest::_internal_has_clientstreamwindow() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool ProtocolBodyRequest::has_clientstreamwindow() const {
+  return _internal_has_clientstreamwindow();
+}
+inline void ProtocolBodyRequest::clear_clientstreamwindow() {
+  _impl_.clientstreamwindow_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline uint32_t ProtocolBodyRequest::_internal_clientstreamwindow() const {
+  return _impl_.clientstreamwindow_;
+}
+inline uint32_t ProtocolBodyRequest::clientstreamwindow() const {
+  // @@protoc_insertion_point(field_get:ProtocolBodyRequest.clientStreamWindow)
+  return _internal_clientstreamwindow();
+}
+inline void ProtocolBodyRequest::_internal_set_clientstreamwindow(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.clientstreamwindow_ = value;
+}
+inline void ProtocolBodyRequest::set_clientstreamwindow(uint32_t value) {
+  _internal_set_clientstreamwindow(value);
+  // @@protoc_insertion_point(field_set:ProtocolBodyRequest.clientStreamWindow)
 }
 
 // -------------------------------------------------------------------
@@ -449,109 +1026,377 @@ inline void ProtocolBodyRequest::set_allocated_content(::std::string* content) {
 // ProtocolBodyResponse
 
 // optional uint32 callId = 1;
+inline bool ProtocolBodyResponse::_internal_has_callid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
 inline bool ProtocolBodyResponse::has_callid() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+  return _internal_has_callid();
 }
-inline void ProtocolBodyResponse::set_has_callid() {
-  _has_bits_[0] |= 0x00000001u;
+inline void ProtocolBodyResponse::clear_callid() {
+  _impl_.callid_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
-inline void ProtocolBodyResponse::clear_has_callid() {
-  _has_bits_[0] &= ~0x00000001u;
+inline uint32_t ProtocolBodyResponse::_internal_callid() const {
+  return _impl_.callid_;
 }
-inline void ProtocolBodyResponse::clear_callid() {
-  callid_ = 0u;
-  clear_has_callid();
+inline uint32_t ProtocolBodyResponse::callid() const {
+  // @@protoc_insertion_point(field_get:ProtocolBodyResponse.callId)
+  return _internal_callid();
 }
-inline ::google::protobuf::uint32 ProtocolBodyResponse::callid() const {
-  return callid_;
+inline void ProtocolBodyResponse::_internal_set_callid(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.callid_ = value;
 }
-inline void ProtocolBodyResponse::set_callid(::google::protobuf::uint32 value) {
-  set_has_callid();
-  callid_ = value;
+inline void ProtocolBodyResponse::set_callid(uint32_t value) {
+  _internal_set_callid(value);
+  // @@protoc_insertion_point(field_set:ProtocolBodyResponse.callId)
 }
 
 // optional bytes content = 2;
+inline bool ProtocolBodyResponse::_internal_has_content() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
 inline bool ProtocolBodyResponse::has_content() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+  return _internal_has_content();
 }
-inline void ProtocolBodyResponse::set_has_content() {
-  _has_bits_[0] |= 0x00000002u;
+inline void ProtocolBodyResponse::clear_content() {
+  _impl_.content_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline void ProtocolBodyResponse::clear_has_content() {
-  _has_bits_[0] &= ~0x00000002u;
+inline const std::string& ProtocolBodyResponse::content() const {
+  // @@protoc_insertion_point(field_get:ProtocolBodyResponse.content)
+  return _internal_content();
 }
-inline void ProtocolBodyResponse::clear_content() {
-  if (content_ != &::google::protobuf::internal::kEmptyString) {
-    content_->clear();
-  }
-  clear_has_content();
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ProtocolBodyResponse::set_content(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.content_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ProtocolBodyResponse.content)
+}
+inline std::string* ProtocolBodyResponse::mutable_content() {
+  std::string* _s = _internal_mutable_content();
+  // @@protoc_insertion_point(field_mutable:ProtocolBodyResponse.content)
+  return _s;
+}
+inline const std::string& ProtocolBodyResponse::_internal_content() const {
+  return _impl_.content_.Get();
+}
+inline void ProtocolBodyResponse::_internal_set_content(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.content_.Set(value, GetArenaForAllocation());
 }
-inline const ::std::string& ProtocolBodyResponse::content() const {
-  return *content_;
+inline std::string* ProtocolBodyResponse::_internal_mutable_content() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.content_.Mutable(GetArenaForAllocation());
 }
-inline void ProtocolBodyResponse::set_content(const ::std::string& value) {
-  set_has_content();
-  if (content_ == &::google::protobuf::internal::kEmptyString) {
-    content_ = new ::std::string;
+inline std::string* ProtocolBodyResponse::release_content() {
+  // @@protoc_insertion_point(field_release:ProtocolBodyResponse.content)
+  if (!_internal_has_content()) {
+    return nullptr;
   }
-  content_->assign(value);
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.content_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.content_.IsDefault()) {
+    _impl_.content_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
-inline void ProtocolBodyResponse::set_content(const char* value) {
-  set_has_content();
-  if (content_ == &::google::protobuf::internal::kEmptyString) {
-    content_ = new ::std::string;
+inline void ProtocolBodyResponse::set_allocated_content(std::string* content) {
+  if (content != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.content_.SetAllocated(content, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.content_.IsDefault()) {
+    _impl_.content_.Set("", GetArenaForAllocation());
   }
-  content_->assign(value);
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ProtocolBodyResponse.content)
+}
+
+// optional string error = 3;
+inline bool ProtocolBodyResponse::_internal_has_error() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void ProtocolBodyResponse::set_content(const void* value, size_t size) {
-  set_has_content();
-  if (content_ == &::google::protobuf::internal::kEmptyString) {
-    content_ = new ::std::string;
+inline bool ProtocolBodyResponse::has_error() const {
+  return _internal_has_error();
+}
+inline void ProtocolBodyResponse::clear_error() {
+  _impl_.error_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& ProtocolBodyResponse::error() const {
+  // @@protoc_insertion_point(field_get:ProtocolBodyResponse.error)
+  return _internal_error();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ProtocolBodyResponse::set_error(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ProtocolBodyResponse.error)
+}
+inline std::string* ProtocolBodyResponse::mutable_error() {
+  std::string* _s = _internal_mutable_error();
+  // @@protoc_insertion_point(field_mutable:ProtocolBodyResponse.error)
+  return _s;
+}
+inline const std::string& ProtocolBodyResponse::_internal_error() const {
+  return _impl_.error_.Get();
+}
+inline void ProtocolBodyResponse::_internal_set_error(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.error_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ProtocolBodyResponse::_internal_mutable_error() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.error_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ProtocolBodyResponse::release_error() {
+  // @@protoc_insertion_point(field_release:ProtocolBodyResponse.error)
+  if (!_internal_has_error()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.error_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
   }
-  content_->assign(reinterpret_cast<const char*>(value), size);
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
-inline ::std::string* ProtocolBodyResponse::mutable_content() {
-  set_has_content();
-  if (content_ == &::google::protobuf::internal::kEmptyString) {
-    content_ = new ::std::string;
+inline void ProtocolBodyResponse::set_allocated_error(std::string* error) {
+  if (error != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.error_.SetAllocated(error, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
   }
-  return content_;
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ProtocolBodyResponse.error)
+}
+
+// -------------------------------------------------------------------
+
+// ProtocolBodyStream
+
+// optional uint32 callId = 1;
+inline bool ProtocolBodyStream::_internal_has_callid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool ProtocolBodyStream::has_callid() const {
+  return _internal_has_callid();
+}
+inline void ProtocolBodyStream::clear_callid() {
+  _impl_.callid_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t ProtocolBodyStream::_internal_callid() const {
+  return _impl_.callid_;
+}
+inline uint32_t ProtocolBodyStream::callid() const {
+  // @@protoc_insertion_point(field_get:ProtocolBodyStream.callId)
+  return _internal_callid();
+}
+inline void ProtocolBodyStream::_internal_set_callid(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.callid_ = value;
+}
+inline void ProtocolBodyStream::set_callid(uint32_t value) {
+  _internal_set_callid(value);
+  // @@protoc_insertion_point(field_set:ProtocolBodyStream.callId)
+}
+
+// optional bytes content = 2;
+inline bool ProtocolBodyStream::_internal_has_content() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ProtocolBodyStream::has_content() const {
+  return _internal_has_content();
 }
-inline ::std::string* ProtocolBodyResponse::release_content() {
-  clear_has_content();
-  if (content_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
+inline void ProtocolBodyStream::clear_content() {
+  _impl_.content_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& ProtocolBodyStream::content() const {
+  // @@protoc_insertion_point(field_get:ProtocolBodyStream.content)
+  return _internal_content();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ProtocolBodyStream::set_content(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.content_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ProtocolBodyStream.content)
+}
+inline std::string* ProtocolBodyStream::mutable_content() {
+  std::string* _s = _internal_mutable_content();
+  // @@protoc_insertion_point(field_mutable:ProtocolBodyStream.content)
+  return _s;
+}
+inline const std::string& ProtocolBodyStream::_internal_content() const {
+  return _impl_.content_.Get();
+}
+inline void ProtocolBodyStream::_internal_set_content(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.content_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ProtocolBodyStream::_internal_mutable_content() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.content_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ProtocolBodyStream::release_content() {
+  // @@protoc_insertion_point(field_release:ProtocolBodyStream.content)
+  if (!_internal_has_content()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.content_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.content_.IsDefault()) {
+    _impl_.content_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ProtocolBodyStream::set_allocated_content(std::string* content) {
+  if (content != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    ::std::string* temp = content_;
-    content_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.content_.SetAllocated(content, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.content_.IsDefault()) {
+    _impl_.content_.Set("", GetArenaForAllocation());
   }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ProtocolBodyStream.content)
+}
+
+// optional uint32 frame = 3;
+inline bool ProtocolBodyStream::_internal_has_frame() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool ProtocolBodyStream::has_frame() const {
+  return _internal_has_frame();
+}
+inline void ProtocolBodyStream::clear_frame() {
+  _impl_.frame_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint32_t ProtocolBodyStream::_internal_frame() const {
+  return _impl_.frame_;
+}
+inline uint32_t ProtocolBodyStream::frame() const {
+  // @@protoc_insertion_point(field_get:ProtocolBodyStream.frame)
+  return _internal_frame();
+}
+inline void ProtocolBodyStream::_internal_set_frame(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.frame_ = value;
 }
-inline void ProtocolBodyResponse::set_allocated_content(::std::string* content) {
-  if (content_ != &::google::protobuf::internal::kEmptyString) {
-    delete content_;
+inline void ProtocolBodyStream::set_frame(uint32_t value) {
+  _internal_set_frame(value);
+  // @@protoc_insertion_point(field_set:ProtocolBodyStream.frame)
+}
+
+// optional string error = 4;
+inline bool ProtocolBodyStream::_internal_has_error() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool ProtocolBodyStream::has_error() const {
+  return _internal_has_error();
+}
+inline void ProtocolBodyStream::clear_error() {
+  _impl_.error_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& ProtocolBodyStream::error() const {
+  // @@protoc_insertion_point(field_get:ProtocolBodyStream.error)
+  return _internal_error();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ProtocolBodyStream::set_error(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ProtocolBodyStream.error)
+}
+inline std::string* ProtocolBodyStream::mutable_error() {
+  std::string* _s = _internal_mutable_error();
+  // @@protoc_insertion_point(field_mutable:ProtocolBodyStream.error)
+  return _s;
+}
+inline const std::string& ProtocolBodyStream::_internal_error() const {
+  return _impl_.error_.Get();
+}
+inline void ProtocolBodyStream::_internal_set_error(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.error_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ProtocolBodyStream::_internal_mutable_error() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.error_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ProtocolBodyStream::release_error() {
+  // @@protoc_insertion_point(field_release:ProtocolBodyStream.error)
+  if (!_internal_has_error()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.error_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
   }
-  if (content) {
-    set_has_content();
-    content_ = content;
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ProtocolBodyStream::set_allocated_error(std::string* error) {
+  if (error != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    clear_has_content();
-    content_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.error_.SetAllocated(error, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
   }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ProtocolBodyStream.error)
 }
 
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
 
-// @@protoc_insertion_point(namespace_scope)
+// -------------------------------------------------------------------
 
-#ifndef SWIG
-namespace google {
-namespace protobuf {
 
+// @@protoc_insertion_point(namespace_scope)
 
-}  // namespace google
-}  // namespace protobuf
-#endif  // SWIG
 
 // @@protoc_insertion_point(global_scope)
 
-#endif  // PROTOBUF_ProtocolBody_2eproto__INCLUDED
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_ProtocolBody_2eproto
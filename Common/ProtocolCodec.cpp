@@ -0,0 +1,510 @@
+#include "ProtocolCodec.h"
+#include "EvbufferStream.h"
+#include "Compressor.h"
+#include <climits>
+#include <cstring>
+#include <vector>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/wire_format_lite.h>
+
+using google::protobuf::io::CodedInputStream;
+using google::protobuf::io::CodedOutputStream;
+using google::protobuf::internal::WireFormatLite;
+
+/************************************************************************
+  ܣжȡheadvarintĳȣ5ֽ
+  
+	pArr룬
+	len룬鳤
+	posȡλãȡɹƵvarint֮
+	value
+ֵHEAD_DECODE_RESULTĶ
+************************************************************************/
+static HEAD_DECODE_RESULT readHeadVarint32(const unsigned char *pArr, size_t len, size_t &pos, uint32_t &value)
+{
+	value = 0;
+	for (unsigned int i = 0; i < 5; ++i, ++pos)
+	{
+		if (pos >= len)
+			return HEAD_DECODE_MORE;
+		unsigned char b = pArr[pos];
+		//5ֻֽõ4λ򳬳32λ
+		if (4 == i && b > 0x0F)
+			return HEAD_DECODE_INVALID;
+		value |= (uint32_t)(b & 0x7F) << (7 * i);
+		if (0 == (b & 0x80))
+		{
+			++pos;
+			return HEAD_DECODE_OK;
+		}
+	}
+	return HEAD_DECODE_INVALID;
+}
+
+size_t ProtocolCodec::getHeadSize(unsigned char version, bodySize_t bodySize)
+{
+	if (PROTOCOL_V2 != version)
+		return HEAD_SIZE;
+	return HEAD_V2_FIXED_SIZE + CodedOutputStream::VarintSize32(bodySize);
+}
+
+size_t ProtocolCodec::encodeHead(unsigned char *pArr, unsigned char version, unsigned char dataType, unsigned char compressType, bodySize_t bodySize)
+{
+	unsigned char typeByte = (unsigned char)((dataType & DATA_TYPE_MASK) | (compressType << COMPRESS_TYPE_SHIFT));
+	//v1bodyȱֽɰ汾ĶԶһ
+	if (PROTOCOL_V2 != version)
+	{
+		pArr[0] = typeByte;
+		memcpy(pArr + 1, &bodySize, sizeof(bodySize));
+		return HEAD_SIZE;
+	}
+	pArr[0] = HEAD_V2_MAGIC;
+	pArr[1] = (unsigned char)(PROTOCOL_V2 << HEAD_VERSION_SHIFT);
+	pArr[2] = typeByte;
+	//varintֽڴӵλλ룬ֽ޹
+	return CodedOutputStream::WriteVarint32ToArray(bodySize, pArr + HEAD_V2_FIXED_SIZE) - pArr;
+}
+
+HEAD_DECODE_RESULT ProtocolCodec::decodeHead(const unsigned char *pArr, size_t len, FrameHead &head)
+{
+	if (0 == len)
+		return HEAD_DECODE_MORE;
+
+	//1ֽڲħv1 headbodymemcpyȡδָת
+	if (HEAD_V2_MAGIC != pArr[0])
+	{
+		if (len < HEAD_SIZE)
+			return HEAD_DECODE_MORE;
+		head.version = PROTOCOL_V1;
+		head.flags = 0;
+		head.dataType = pArr[0] & DATA_TYPE_MASK;
+		head.compressType = pArr[0] >> COMPRESS_TYPE_SHIFT;
+		memcpy(&head.bodySize, pArr + 1, sizeof(head.bodySize));
+		head.extSize = 0;
+		head.headSize = HEAD_SIZE;
+		return HEAD_DECODE_OK;
+	}
+
+	if (len < HEAD_V2_FIXED_SIZE)
+		return HEAD_DECODE_MORE;
+	//߰汾headʽδ֪޷
+	head.version = pArr[1] >> HEAD_VERSION_SHIFT;
+	if (PROTOCOL_V2 != head.version)
+		return HEAD_DECODE_INVALID;
+	head.flags = pArr[1] & HEAD_FLAG_MASK;
+	head.dataType = pArr[2] & DATA_TYPE_MASK;
+	head.compressType = pArr[2] >> COMPRESS_TYPE_SHIFT;
+
+	size_t pos = HEAD_V2_FIXED_SIZE;
+	HEAD_DECODE_RESULT result = readHeadVarint32(pArr, len, pos, head.bodySize);
+	if (HEAD_DECODE_OK != result)
+		return result;
+	head.extSize = 0;
+	if (0 != (head.flags & HEAD_FLAG_EXTENSION))
+	{
+		result = readHeadVarint32(pArr, len, pos, head.extSize);
+		if (HEAD_DECODE_OK != result)
+			return result;
+		if (head.extSize > HEAD_EXTENSION_MAX_SIZE)
+			return HEAD_DECODE_INVALID;
+	}
+	head.headSize = pos;
+	return HEAD_DECODE_OK;
+}
+
+HEAD_DECODE_RESULT ProtocolCodec::peekHead(evbuffer *pBuf, FrameHead &head)
+{
+	//v2 head֮󻹿չ
+	unsigned char arr[HEAD_MAX_SIZE + 5];
+	ev_ssize_t len = evbuffer_copyout(pBuf, arr, sizeof(arr));
+	if (len <= 0)
+		return HEAD_DECODE_MORE;
+	return decodeHead(arr, (size_t)len, head);
+}
+
+bool ProtocolCodec::decodeRequestView(evbuffer *pBuf, RequestView &view)
+{
+	if (NULL == pBuf)
+		return false;
+
+	//ЭbodyλͬһڴʱСĳֱڴϽ룬ʡȥĿ
+	size_t len = evbuffer_get_length(pBuf);
+	const unsigned char *pData = getContiguous(pBuf, 0, len);
+	if (NULL != pData)
+	{
+		CodedInputStream coded(pData, (int)len);
+		return decodeRequestView(coded, view);
+	}
+
+	EvbufferInputStream stream(pBuf);
+	CodedInputStream coded(&stream);
+	return decodeRequestView(coded, view);
+}
+
+bool ProtocolCodec::parseFromEvbuffer(evbuffer *pBuf, size_t offset, size_t len, google::protobuf::Message *pMessage)
+{
+	if (NULL == pBuf || NULL == pMessage)
+		return false;
+	size_t total = evbuffer_get_length(pBuf);
+	if (offset > total || len > total - offset)
+		return false;
+
+	const unsigned char *pData = getContiguous(pBuf, offset, len);
+	if (NULL != pData)
+		return pMessage->ParseFromArray(pData, (int)len);
+
+	EvbufferInputStream stream(pBuf, offset, len);
+	CodedInputStream coded(&stream);
+	return pMessage->ParseFromCodedStream(&coded);
+}
+
+bool ProtocolCodec::encodeResponse(evbuffer *pBuf, callId_t callId, const google::protobuf::Message &resp, unsigned char version)
+{
+	if (NULL == pBuf)
+		return false;
+
+	//κЭbodyĳȣByteSizeLong()Ỻֶεĳȣлʹ
+	size_t contentSize = resp.ByteSizeLong();
+	size_t bodySize = 1 + CodedOutputStream::VarintSize32(callId)
+		+ 1 + CodedOutputStream::VarintSize32((uint32_t)contentSize) + contentSize;
+	if (contentSize > INT_MAX || bodySize > (bodySize_t)-1)
+		return false;
+
+	//Эhead
+	unsigned char arrHead[HEAD_MAX_SIZE];
+	size_t headSize = encodeHead(arrHead, version, DATA_TYPE_RESPONSE, COMPRESS_NONE, (bodySize_t)bodySize);
+
+	size_t oldLen = evbuffer_get_length(pBuf);
+	bool bOk;
+	{
+		//һԤЭݵĳȣֱлԤڴ
+		EvbufferOutputStream stream(pBuf, headSize + bodySize);
+		{
+			//CodedOutputStreamʱ˻δдڴ棬ύ֮ǰ
+			CodedOutputStream coded(&stream);
+			coded.WriteRaw(arrHead, (int)headSize);
+			coded.WriteTag(GOOGLE_PROTOBUF_WIRE_FORMAT_MAKE_TAG(ProtocolBodyResponse::kCallIdFieldNumber, WireFormatLite::WIRETYPE_VARINT));
+			coded.WriteVarint32(callId);
+			coded.WriteTag(GOOGLE_PROTOBUF_WIRE_FORMAT_MAKE_TAG(ProtocolBodyResponse::kContentFieldNumber, WireFormatLite::WIRETYPE_LENGTH_DELIMITED));
+			coded.WriteVarint32((uint32_t)contentSize);
+			resp.SerializeWithCachedSizes(&coded);
+			bOk = !coded.HadError();
+		}
+		bOk = stream.commit() && bOk;
+	}
+	return bOk && evbuffer_get_length(pBuf) - oldLen == headSize + bodySize;
+}
+
+bool ProtocolCodec::encodeErrorResponse(evbuffer *pBuf, callId_t callId, const std::string &error, unsigned char version)
+{
+	if (NULL == pBuf)
+		return false;
+
+	size_t bodySize = 1 + CodedOutputStream::VarintSize32(callId)
+		+ 1 + CodedOutputStream::VarintSize32((uint32_t)error.size()) + error.size();
+	if (error.size() > INT_MAX || bodySize > (bodySize_t)-1)
+		return false;
+
+	unsigned char arrHead[HEAD_MAX_SIZE];
+	size_t headSize = encodeHead(arrHead, version, DATA_TYPE_RESPONSE, COMPRESS_NONE, (bodySize_t)bodySize);
+
+	size_t oldLen = evbuffer_get_length(pBuf);
+	bool bOk;
+	{
+		EvbufferOutputStream stream(pBuf, headSize + bodySize);
+		{
+			CodedOutputStream coded(&stream);
+			coded.WriteRaw(arrHead, (int)headSize);
+			coded.WriteTag(GOOGLE_PROTOBUF_WIRE_FORMAT_MAKE_TAG(ProtocolBodyResponse::kCallIdFieldNumber, WireFormatLite::WIRETYPE_VARINT));
+			coded.WriteVarint32(callId);
+			coded.WriteTag(GOOGLE_PROTOBUF_WIRE_FORMAT_MAKE_TAG(ProtocolBodyResponse::kErrorFieldNumber, WireFormatLite::WIRETYPE_LENGTH_DELIMITED));
+			coded.WriteVarint32((uint32_t)error.size());
+			coded.WriteString(error);
+			bOk = !coded.HadError();
+		}
+		bOk = stream.commit() && bOk;
+	}
+	return bOk && evbuffer_get_length(pBuf) - oldLen == headSize + bodySize;
+}
+
+bool ProtocolCodec::serializeToEvbuffer(evbuffer *pBuf, const google::protobuf::Message &msg)
+{
+	if (NULL == pBuf)
+		return false;
+
+	size_t size = msg.ByteSizeLong();
+	if (size > INT_MAX)
+		return false;
+
+	size_t oldLen = evbuffer_get_length(pBuf);
+	bool bOk;
+	{
+		EvbufferOutputStream stream(pBuf, size);
+		{
+			CodedOutputStream coded(&stream);
+			msg.SerializeWithCachedSizes(&coded);
+			bOk = !coded.HadError();
+		}
+		bOk = stream.commit() && bOk;
+	}
+	return bOk && evbuffer_get_length(pBuf) - oldLen == size;
+}
+
+bool ProtocolCodec::encodeRequest(evbuffer *pBuf, callId_t callId, const std::string *pServiceName, uint32_t serviceId, uint32_t methodIndex, evbuffer *pContent,
+	uint32_t streamWindow, uint32_t clientStreamWindow, unsigned char version)
+{
+	if (NULL == pBuf || NULL == pContent)
+		return false;
+
+	//content֮ǰֶεĳȣټcontentĳȣõЭbodyĳ
+	size_t contentSize = evbuffer_get_length(pContent);
+	size_t fieldsSize = 1 + CodedOutputStream::VarintSize32(callId)
+		+ 1 + CodedOutputStream::VarintSize32(methodIndex)
+		+ 1 + CodedOutputStream::VarintSize32((uint32_t)contentSize);
+	if (NULL != pServiceName)
+		fieldsSize += 1 + CodedOutputStream::VarintSize32((uint32_t)pServiceName->size()) + pServiceName->size();
+	if (serviceId > 0)
+		fieldsSize += 1 + CodedOutputStream::VarintSize32(serviceId);
+	if (streamWindow > 0)
+		fieldsSize += 1 + CodedOutputStream::VarintSize32(streamWindow);
+	if (clientStreamWindow > 0)
+		fieldsSize += 1 + CodedOutputStream::VarintSize32(clientStreamWindow);
+	size_t bodySize = fieldsSize + contentSize;
+	if (contentSize > INT_MAX || bodySize > (bodySize_t)-1)
+		return false;
+
+	//headcontent֮ǰֶջϱ룬ÿÿֻһΣϳʱڶϱ
+	unsigned char arrStack[PROTOCOL_CODEC_STACK_SIZE];
+	std::vector<unsigned char> vecHeap;
+	unsigned char *pHead = arrStack;
+	size_t headSize = getHeadSize(version, (bodySize_t)bodySize);
+	if (headSize + fieldsSize > sizeof(arrStack))
+	{
+		vecHeap.resize(headSize + fieldsSize);
+		pHead = &vecHeap[0];
+	}
+
+	//Эhead
+	encodeHead(pHead, version, DATA_TYPE_REQUEST, COMPRESS_NONE, (bodySize_t)bodySize);
+	//contentֶε˳Ӱ
+	unsigned char *p = pHead + headSize;
+	if (NULL != pServiceName)
+	{
+		p = CodedOutputStream::WriteTagToArray(GOOGLE_PROTOBUF_WIRE_FORMAT_MAKE_TAG(ProtocolBodyRequest::kServiceNameFieldNumber, WireFormatLite::WIRETYPE_LENGTH_DELIMITED), p);
+		p = CodedOutputStream::WriteVarint32ToArray((uint32_t)pServiceName->size(), p);
+		p = CodedOutputStream::WriteRawToArray(pServiceName->data(), (int)pServiceName->size(), p);
+	}
+	p = CodedOutputStream::WriteTagToArray(GOOGLE_PROTOBUF_WIRE_FORMAT_MAKE_TAG(ProtocolBodyRequest::kMethodIndexFieldNumber, WireFormatLite::WIRETYPE_VARINT), p);
+	p = CodedOutputStream::WriteVarint32ToArray(methodIndex, p);
+	p = CodedOutputStream::WriteTagToArray(GOOGLE_PROTOBUF_WIRE_FORMAT_MAKE_TAG(ProtocolBodyRequest::kCallIdFieldNumber, WireFormatLite::WIRETYPE_VARINT), p);
+	p = CodedOutputStream::WriteVarint32ToArray(callId, p);
+	if (serviceId > 0)
+	{
+		p = CodedOutputStream::WriteTagToArray(GOOGLE_PROTOBUF_WIRE_FORMAT_MAKE_TAG(ProtocolBodyRequest::kServiceIdFieldNumber, WireFormatLite::WIRETYPE_VARINT), p);
+		p = CodedOutputStream::WriteVarint32ToArray(serviceId, p);
+	}
+	if (streamWindow > 0)
+	{
+		p = CodedOutputStream::WriteTagToArray(GOOGLE_PROTOBUF_WIRE_FORMAT_MAKE_TAG(ProtocolBodyRequest::kStreamWindowFieldNumber, WireFormatLite::WIRETYPE_VARINT), p);
+		p = CodedOutputStream::WriteVarint32ToArray(streamWindow, p);
+	}
+	if (clientStreamWindow > 0)
+	{
+		p = CodedOutputStream::WriteTagToArray(GOOGLE_PROTOBUF_WIRE_FORMAT_MAKE_TAG(ProtocolBodyRequest::kClientStreamWindowFieldNumber, WireFormatLite::WIRETYPE_VARINT), p);
+		p = CodedOutputStream::WriteVarint32ToArray(clientStreamWindow, p);
+	}
+	p = CodedOutputStream::WriteTagToArray(GOOGLE_PROTOBUF_WIRE_FORMAT_MAKE_TAG(ProtocolBodyRequest::kContentFieldNumber, WireFormatLite::WIRETYPE_LENGTH_DELIMITED), p);
+	p = CodedOutputStream::WriteVarint32ToArray((uint32_t)contentSize, p);
+
+	//headֶһд룬ʧʱevbuffer
+	if ((size_t)(p - pHead) != headSize + fieldsSize || 0 != evbuffer_add(pBuf, pHead, headSize + fieldsSize))
+		return false;
+	//contentڴ룬
+	evbuffer_add_buffer(pBuf, pContent);
+	return true;
+}
+
+bool ProtocolCodec::encodeStreamFrame(evbuffer *pBuf, callId_t callId, uint32_t frame, const google::protobuf::Message *pMsg, const std::string *pError,
+	unsigned char version)
+{
+	if (NULL == pBuf)
+		return false;
+
+	//ϢЭbodyĳȣByteSizeLong()Ỻֶεĳȣлʹ
+	size_t contentSize = (NULL == pMsg) ? 0 : pMsg->ByteSizeLong();
+	size_t bodySize = 1 + CodedOutputStream::VarintSize32(callId) + 1 + CodedOutputStream::VarintSize32(frame);
+	if (NULL != pError)
+		bodySize += 1 + CodedOutputStream::VarintSize32((uint32_t)pError->size()) + pError->size();
+	if (NULL != pMsg)
+		bodySize += 1 + CodedOutputStream::VarintSize32((uint32_t)contentSize) + contentSize;
+	if (contentSize > INT_MAX || bodySize > (bodySize_t)-1)
+		return false;
+
+	//Эhead
+	unsigned char arrHead[HEAD_MAX_SIZE];
+	size_t headSize = encodeHead(arrHead, version, DATA_TYPE_STREAM, COMPRESS_NONE, (bodySize_t)bodySize);
+
+	size_t oldLen = evbuffer_get_length(pBuf);
+	bool bOk;
+	{
+		//һԤЭݵĳȣϢֱлԤڴ
+		EvbufferOutputStream stream(pBuf, headSize + bodySize);
+		{
+			CodedOutputStream coded(&stream);
+			coded.WriteRaw(arrHead, (int)headSize);
+			coded.WriteTag(GOOGLE_PROTOBUF_WIRE_FORMAT_MAKE_TAG(ProtocolBodyStream::kCallIdFieldNumber, WireFormatLite::WIRETYPE_VARINT));
+			coded.WriteVarint32(callId);
+			coded.WriteTag(GOOGLE_PROTOBUF_WIRE_FORMAT_MAKE_TAG(ProtocolBodyStream::kFrameFieldNumber, WireFormatLite::WIRETYPE_VARINT));
+			coded.WriteVarint32(frame);
+			if (NULL != pError)
+			{
+				coded.WriteTag(GOOGLE_PROTOBUF_WIRE_FORMAT_MAKE_TAG(ProtocolBodyStream::kErrorFieldNumber, WireFormatLite::WIRETYPE_LENGTH_DELIMITED));
+				coded.WriteVarint32((uint32_t)pError->size());
+				coded.WriteString(*pError);
+			}
+			if (NULL != pMsg)
+			{
+				coded.WriteTag(GOOGLE_PROTOBUF_WIRE_FORMAT_MAKE_TAG(ProtocolBodyStream::kContentFieldNumber, WireFormatLite::WIRETYPE_LENGTH_DELIMITED));
+				coded.WriteVarint32((uint32_t)contentSize);
+				pMsg->SerializeWithCachedSizes(&coded);
+			}
+			bOk = !coded.HadError();
+		}
+		bOk = stream.commit() && bOk;
+	}
+	return bOk && evbuffer_get_length(pBuf) - oldLen == headSize + bodySize;
+}
+
+bool ProtocolCodec::encodeStreamCredit(evbuffer *pBuf, callId_t callId, credit_t credit, unsigned char version)
+{
+	if (NULL == pBuf)
+		return false;
+
+	unsigned char arr[HEAD_MAX_SIZE + sizeof(callId_t) + sizeof(credit_t)];
+	size_t headSize = encodeHead(arr, version, DATA_TYPE_STREAM_CREDIT, COMPRESS_NONE, sizeof(callId_t) + sizeof(credit_t));
+	CodedOutputStream::WriteLittleEndian32ToArray(callId, arr + headSize);
+	CodedOutputStream::WriteLittleEndian32ToArray(credit, arr + headSize + sizeof(callId_t));
+	return 0 == evbuffer_add(pBuf, arr, headSize + sizeof(callId_t) + sizeof(credit_t));
+}
+
+bool ProtocolCodec::compressBody(evbuffer *pBuf, unsigned char compressType)
+{
+	if (NULL == pBuf || COMPRESS_NONE == compressType)
+		return false;
+	size_t len = evbuffer_get_length(pBuf);
+	//Эݲչ
+	FrameHead head;
+	if (HEAD_DECODE_OK != peekHead(pBuf, head) || 0 != head.extSize || len <= head.headSize)
+		return false;
+
+	evbuffer *pCompressed = evbuffer_new();
+	if (NULL == pCompressed)
+		return false;
+	if (!Compressor::compress(compressType, pBuf, head.headSize, len - head.headSize, pCompressed)
+		|| evbuffer_get_length(pCompressed) >= len - head.headSize)
+	{
+		evbuffer_free(pCompressed);
+		return false;
+	}
+
+	//±Эheadѹ㷨bodyȸΪѹĳȣv2 headĳȿ֮
+	unsigned char arrHead[HEAD_MAX_SIZE];
+	size_t headSize = encodeHead(arrHead, head.version, head.dataType, compressType, (bodySize_t)evbuffer_get_length(pCompressed));
+
+	//ѹЭ滻ԭģѹֻƶڴ
+	evbuffer_drain(pBuf, len);
+	evbuffer_add(pBuf, arrHead, headSize);
+	evbuffer_add_buffer(pBuf, pCompressed);
+	evbuffer_free(pCompressed);
+	return true;
+}
+
+bool ProtocolCodec::peekCallId(evbuffer *pBuf, callId_t &callId)
+{
+	//ӦʽӦ֡ĵidǵ1ֶΣлǰ
+	unsigned char arr[CALL_ID_MAX_PREFIX_SIZE];
+	ev_ssize_t len = evbuffer_copyout(pBuf, arr, sizeof(arr));
+	if (len <= 0)
+		return false;
+	CodedInputStream coded(arr, (int)len);
+	return GOOGLE_PROTOBUF_WIRE_FORMAT_MAKE_TAG(ProtocolBodyResponse::kCallIdFieldNumber, WireFormatLite::WIRETYPE_VARINT) == coded.ReadTag()
+		&& coded.ReadVarint32(&callId);
+}
+
+const unsigned char *ProtocolCodec::getContiguous(evbuffer *pBuf, size_t offset, size_t len)
+{
+	//ûжӦڴ飬NULLָ뼴
+	static const unsigned char empty = 0;
+	if (0 == len)
+		return &empty;
+
+	evbuffer_ptr ptr;
+	if (evbuffer_ptr_set(pBuf, &ptr, offset, EVBUFFER_PTR_SET) < 0)
+		return NULL;
+	evbuffer_iovec iov;
+	if (1 != evbuffer_peek(pBuf, len, &ptr, &iov, 1) || iov.iov_len < len)
+		return NULL;
+	return (const unsigned char *)iov.iov_base;
+}
+
+bool ProtocolCodec::decodeRequestView(CodedInputStream &coded, RequestView &view)
+{
+	while (true)
+	{
+		uint32_t tag = coded.ReadTag();
+		//bodyĩβ
+		if (0 == tag)
+			break;
+
+		switch (tag)
+		{
+		case GOOGLE_PROTOBUF_WIRE_FORMAT_MAKE_TAG(ProtocolBodyRequest::kServiceNameFieldNumber, WireFormatLite::WIRETYPE_LENGTH_DELIMITED):
+			{
+				uint32_t len;
+				if (!coded.ReadVarint32(&len) || !coded.ReadString(&view.serviceName, len))
+					return false;
+				break;
+			}
+		case GOOGLE_PROTOBUF_WIRE_FORMAT_MAKE_TAG(ProtocolBodyRequest::kServiceIdFieldNumber, WireFormatLite::WIRETYPE_VARINT):
+			if (!coded.ReadVarint32(&view.serviceId))
+				return false;
+			break;
+		case GOOGLE_PROTOBUF_WIRE_FORMAT_MAKE_TAG(ProtocolBodyRequest::kMethodIndexFieldNumber, WireFormatLite::WIRETYPE_VARINT):
+			if (!coded.ReadVarint32(&view.methodIndex))
+				return false;
+			break;
+		case GOOGLE_PROTOBUF_WIRE_FORMAT_MAKE_TAG(ProtocolBodyRequest::kCallIdFieldNumber, WireFormatLite::WIRETYPE_VARINT):
+			if (!coded.ReadVarint32(&view.callId))
+				return false;
+			break;
+		case GOOGLE_PROTOBUF_WIRE_FORMAT_MAKE_TAG(ProtocolBodyRequest::kStreamWindowFieldNumber, WireFormatLite::WIRETYPE_VARINT):
+			if (!coded.ReadVarint32(&view.streamWindow))
+				return false;
+			break;
+		case GOOGLE_PROTOBUF_WIRE_FORMAT_MAKE_TAG(ProtocolBodyRequest::kClientStreamWindowFieldNumber, WireFormatLite::WIRETYPE_VARINT):
+			if (!coded.ReadVarint32(&view.clientStreamWindow))
+				return false;
+			break;
+		case GOOGLE_PROTOBUF_WIRE_FORMAT_MAKE_TAG(ProtocolBodyRequest::kContentFieldNumber, WireFormatLite::WIRETYPE_LENGTH_DELIMITED):
+			{
+				//ֻ¼contentλúͳȣȻ
+				uint32_t len;
+				if (!coded.ReadVarint32(&len))
+					return false;
+				view.contentOffset = coded.CurrentPosition();
+				view.contentSize = len;
+				if (!coded.Skip(len))
+					return false;
+				break;
+			}
+		default:
+			//δֶ֪ΣԼݺչЭ
+			if (!WireFormatLite::SkipField(&coded, tag))
+				return false;
+			break;
+		}
+	}
+
+	//ReadTag()0ȿǵĩβҲ
+	return coded.ConsumedEntireMessage();
+}
@@ -0,0 +1,303 @@
+#ifndef _PROTOCOLCODEC_H_
+#define _PROTOCOLCODEC_H_
+
+#include <string>
+#include <event2/buffer.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/io/coded_stream.h>
+#include "Global.h"
+
+#ifdef WIN32
+#ifdef RPCSERVER_EXPORTS
+#define PROTOCOLCODEC_DLL_EXPORTS __declspec(dllexport)
+#else
+#ifdef RPCCLIENT_EXPORTS
+#define PROTOCOLCODEC_DLL_EXPORTS __declspec(dllexport)
+#else
+#define PROTOCOLCODEC_DLL_EXPORTS __declspec(dllimport)
+#endif
+#endif
+#else
+#define PROTOCOLCODEC_DLL_EXPORTS
+#endif
+
+//ʱЭheadcontent֮ǰֶջϱ󳤶
+#define PROTOCOL_CODEC_STACK_SIZE 64
+
+//ЭheadĽ
+enum HEAD_DECODE_RESULT
+{
+	//ɹ
+	HEAD_DECODE_OK = 0, 
+	//ݲһheadҪȴ
+	HEAD_DECODE_MORE = 1, 
+	//headЧֵ֧İ汾bodyȻչȴ󣩣֮޷
+	HEAD_DECODE_INVALID = 2
+};
+
+//Эhead汾headṹ
+struct FrameHead
+{
+	FrameHead()
+	{
+		version = PROTOCOL_V1;
+		flags = 0;
+		dataType = 0;
+		compressType = COMPRESS_NONE;
+		bodySize = 0;
+		extSize = 0;
+		headSize = 0;
+	}
+
+	//Э汾
+	unsigned char version;
+	//־λv1Ϊ0
+	unsigned char flags;
+	//
+	unsigned char dataType;
+	//bodyѹ㷨
+	unsigned char compressType;
+	//bodyĳ
+	bodySize_t bodySize;
+	//չĳȣλhead֮body֮ǰv1Ϊ0
+	uint32_t extSize;
+	//headĳȣչ
+	size_t headSize;
+};
+
+//Эbodyͼ
+//contentֶβֻ¼evbufferеλãɷֱevbufferϷл
+struct RequestView
+{
+	RequestView()
+	{
+		serviceId = 0;
+		methodIndex = 0;
+		callId = 0;
+		streamWindow = 0;
+		clientStreamWindow = 0;
+		contentOffset = 0;
+		contentSize = 0;
+	}
+
+	//ֻа󶨷ŵ;ɸʽŴз
+	std::string serviceName;
+	//ϵıţΪ0ʾδ
+	uint32_t serviceId;
+	//±
+	uint32_t methodIndex;
+	//id
+	callId_t callId;
+	//ʽõĳʼϢȣΪ0ʾͨ
+	uint32_t streamWindow;
+	//ͻʽϢڣΪ0ʾǿͻʽ
+	uint32_t clientStreamWindow;
+	//contentevbufferеʼλ
+	size_t contentOffset;
+	//contentĳ
+	size_t contentSize;
+};
+
+//ЭheadЭbody룬ֱevbufferϽУм俽
+class PROTOCOLCODEC_DLL_EXPORTS ProtocolCodec
+{
+public:
+	/************************************************************************
+	  ܣЭheadĳ
+	  
+		version룬Э汾
+		bodySize룬bodyĳ
+	ֵheadĳ
+	************************************************************************/
+	static size_t getHeadSize(unsigned char version, bodySize_t bodySize);
+
+	/************************************************************************
+	  ܣЭheadv2 headչ
+	  
+		pArrhead飬ΪHEAD_MAX_SIZE
+		version룬Э汾
+		dataType룬
+		compressType룬bodyѹ㷨
+		bodySize룬bodyĳ
+	ֵheadĳ
+	************************************************************************/
+	static size_t encodeHead(unsigned char *pArr, unsigned char version, unsigned char dataType, unsigned char compressType, bodySize_t bodySize);
+
+	/************************************************************************
+	  ܣЭhead1ְֽ汾չֻȡ䳤
+	  
+		pArr룬ЭݵĿͷ
+		len룬pArrеݳ
+		headhead
+	ֵHEAD_DECODE_RESULTĶ
+	************************************************************************/
+	static HEAD_DECODE_RESULT decodeHead(const unsigned char *pArr, size_t len, FrameHead &head);
+
+	/************************************************************************
+	  ܣevbufferͷЭheadheadܷɢڲڴ飬ջϽ룬Ƴ
+	  
+		pBuf룬Эλڿͷevbuffer
+		headhead
+	ֵHEAD_DECODE_RESULTĶ
+	************************************************************************/
+	static HEAD_DECODE_RESULT peekHead(evbuffer *pBuf, FrameHead &head);
+
+	/************************************************************************
+	  ܣЭbodyProtocolBodyRequestcontentֶֻ¼λã
+	  
+		pBuf룬ֻһЭbodyevbuffer
+		viewЭbodyͼ
+	ֵ
+		trueɹ
+		falseʧ
+	************************************************************************/
+	static bool decodeRequestView(evbuffer *pBuf, RequestView &view);
+
+	/************************************************************************
+	  ܣevbufferֱָӷлΪMessagepullup
+	  
+		pBuf룬evbufferָ
+		offset룬evbufferеʼλ
+		len룬ݳ
+		pMessageлõMessage
+	ֵ
+		trueлɹ
+		falseлʧ
+	************************************************************************/
+	static bool parseFromEvbuffer(evbuffer *pBuf, size_t offset, size_t len, google::protobuf::Message *pMessage);
+
+	/************************************************************************
+	  ܣӦΪЭݣhead + ProtocolBodyResponseֱлevbufferĩβԤڴ
+		ByteSizeLong()ԤֻлһΣмַ
+	  
+		pBufЭݵevbufferʧʱܲݣӦ
+		callId룬id
+		resp룬
+		version룬Эheadİ汾ĬΪv1
+	ֵ
+		trueɹ
+		falseʧ
+	************************************************************************/
+	static bool encodeResponse(evbuffer *pBuf, callId_t callId, const google::protobuf::Message &resp, unsigned char version = PROTOCOL_V1);
+
+	/************************************************************************
+	  ܣʧܵӦΪЭݣhead + ֻϢProtocolBodyResponse
+	  
+		pBufЭݵevbufferʧʱܲݣӦ
+		callId룬id
+		error룬Ϣ
+		version룬Эheadİ汾ĬΪv1
+	ֵ
+		trueɹ
+		falseʧ
+	************************************************************************/
+	static bool encodeErrorResponse(evbuffer *pBuf, callId_t callId, const std::string &error, unsigned char version = PROTOCOL_V1);
+
+	/************************************************************************
+	  ܣMessageлevbufferĩβByteSizeLong()ԤһԤڴ棬мַ
+		ͻڵ߳лΣõevbufferIOWorker߳
+	  
+		pBufлݵevbufferлʧʱܲݣӦ
+		msg룬Message
+	ֵ
+		trueлɹ
+		falseлʧ
+	************************************************************************/
+	static bool serializeToEvbuffer(evbuffer *pBuf, const google::protobuf::Message &msg);
+
+	/************************************************************************
+	  ܣΪЭݣhead + ProtocolBodyRequestдevbufferĩβ
+		contentֶηлķ룬
+	  
+		pBufЭݵevbuffer
+		callId룬id
+		pServiceName룬ΪNULLʾ
+		serviceId룬ϵıţΪ0ʾ
+		methodIndex룬±
+		pContent룬лķΣɹΪ
+		streamWindow룬ʽõĳʼϢȣĬΪ0ʾͨ
+		clientStreamWindow룬ͻʽϢڣĬΪ0ʾǿͻʽ
+		version룬Эheadİ汾ĬΪv1
+	ֵ
+		trueɹ
+		falseʧܣpBufpContent
+	************************************************************************/
+	static bool encodeRequest(evbuffer *pBuf, callId_t callId, const std::string *pServiceName, uint32_t serviceId, uint32_t methodIndex, evbuffer *pContent,
+		uint32_t streamWindow = 0, uint32_t clientStreamWindow = 0, unsigned char version = PROTOCOL_V1);
+
+	/************************************************************************
+	  ܣʽ֡ΪЭݣhead + ProtocolBodyStreamֱлevbufferĩβԤڴ
+	  
+		pBufЭݵevbufferʧʱܲݣӦ
+		callId룬id
+		frame룬֡ͣSTREAM_FRAMEĶ
+		pMsg룬MESSAGE֡Ϣ֡ΪNULL
+		pError룬ERROR֡ĴϢ֡ΪNULL
+		version룬Эheadİ汾ĬΪv1
+	ֵ
+		trueɹ
+		falseʧ
+	************************************************************************/
+	static bool encodeStreamFrame(evbuffer *pBuf, callId_t callId, uint32_t frame, const google::protobuf::Message *pMsg, const std::string *pError,
+		unsigned char version = PROTOCOL_V1);
+
+	/************************************************************************
+	  ܣȱΪЭݣhead + 4ֽڵĵid + 4ֽڵĶдevbufferĩβ
+	  
+		pBufЭݵevbuffer
+		callId룬id
+		credit룬Ϊ0ʾȡ
+		version룬Эheadİ汾ĬΪv1
+	ֵ
+		trueɹ
+		falseʧ
+	************************************************************************/
+	static bool encodeStreamCredit(evbuffer *pBuf, callId_t callId, credit_t credit, unsigned char version = PROTOCOL_V1);
+
+	/************************************************************************
+	  ܣѹevbufferЭݣhead + bodybodyheadбѹ㷨ѹĳ
+		bodyevbufferڴʽѹѹûбСʱԭheadԭİ汾
+	  
+		pBufֻһЭݵevbuffer
+		compressType룬ѹ㷨
+	ֵ
+		trueѹ
+		falseδѹpBuf
+	************************************************************************/
+	static bool compressBody(evbuffer *pBuf, unsigned char compressType);
+
+	/************************************************************************
+	  ܣӦʽӦ֡ЭbodyĿͷȡidbodyԲѹʧʱֻѹ˿ͷ֣
+	  
+		pBuf룬evbufferָ룬Эbodyλڿͷ޸
+		callIdid
+	ֵ
+		trueȡɹ
+		falseͷǵidֶ
+	************************************************************************/
+	static bool peekCallId(evbuffer *pBuf, callId_t &callId);
+
+private:
+	/************************************************************************
+	  ܣevbufferָλͬһڴ飬ȡָ
+	  
+		pBuf룬evbufferָ
+		offset룬evbufferеʼλ
+		len룬ݳ
+	ֵָ룬ΪNULLʾݿԽڴ
+	************************************************************************/
+	static const unsigned char *getContiguous(evbuffer *pBuf, size_t offset, size_t len);
+
+	/************************************************************************
+	  ܣнЭbody
+	  
+		coded룬
+		viewЭbodyͼ
+	ֵ
+		trueɹ
+		falseʧ
+	************************************************************************/
+	static bool decodeRequestView(google::protobuf::io::CodedInputStream &coded, RequestView &view);
+};
+
+#endif
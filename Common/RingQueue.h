@@ -0,0 +1,307 @@
+#ifndef _RINGQUEUE_H_
+#define _RINGQUEUE_H_
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
+
+//г
+#define CACHE_LINE_SIZE 64
+
+//߶ߵн绷ζ
+//1߳̿ͬʱput()ҲͬʱԷʽtake()takeBatch()֮ͨCASռһеԪ
+//2ʽʶʱֻһ߳˯ߵȴߣȡֻ̣߳tryTakeBatch()
+//3put()take()takeBatch()ֻʽʶ߳Ҫ˯ʱŻõ
+//4±ꡢ±ֱռУα
+//5TĬϹ졣
+template<typename T>
+class RingQueue
+{
+public:
+	/************************************************************************
+	  ܣ캯
+	  
+		maxSize룬е󳤶ȣʵʳȻȡΪ2
+		bWait룬Ƿʽʶ
+			trueʽʶУпʱ߳˯ߵȴ
+			falseԷʽʶУĬֵ
+	ֵ
+	************************************************************************/
+	RingQueue(unsigned int maxSize, bool bWait = false)
+	{
+		m_capacity = 1;
+		while (m_capacity < maxSize)
+			m_capacity <<= 1;
+		m_mask = m_capacity - 1;
+		m_pCells = new Cell[m_capacity];
+		for (size_t i = 0; i < m_capacity; ++i)
+			m_pCells[i].seq.store(i, std::memory_order_relaxed);
+		m_tail.store(0, std::memory_order_relaxed);
+		m_head.store(0, std::memory_order_relaxed);
+		m_bWait = bWait;
+		m_bSleeping.store(false, std::memory_order_relaxed);
+		m_bStopped.store(false, std::memory_order_relaxed);
+	}
+
+	/************************************************************************
+	  ܣ
+	  
+	ֵ
+	************************************************************************/
+	~RingQueue()
+	{
+		delete[] m_pCells;
+	}
+
+	/************************************************************************
+	  ܣзһֵʱȴ
+	  
+		x룬еֵ
+	ֵ
+		trueųɹ
+		falseʧ
+	************************************************************************/
+	bool put(const T &x)
+	{
+		Cell *pCell = claim();
+		if (NULL == pCell)
+			return false;
+		pCell->data = x;
+		publish(pCell);
+		return true;
+	}
+
+	/************************************************************************
+	  ܣзһֵʱȴ
+	  
+		x룬еֵ
+	ֵ
+		trueųɹ
+		falseʧ
+	************************************************************************/
+	bool put(T &&x)
+	{
+		Cell *pCell = claim();
+		if (NULL == pCell)
+			return false;
+		pCell->data = std::move(x);
+		publish(pCell);
+		return true;
+	}
+
+	/************************************************************************
+	  ܣӶȡֵ
+	  
+		xӶȡֵ
+	ֵ
+		trueȡɹ
+		falseȡʧ
+	************************************************************************/
+	bool take(T &x)
+	{
+		return 1 == takeBatch(&x, 1);
+	}
+
+	/************************************************************************
+	  ܣӶȡֵ
+		ʽʶʱΪգһֱȴֱзǿջⲿstop()
+	  
+		pArrȡֵ
+		maxCount룬ȡĸ
+	ֵʵȡĸΪ0ʾȡʧ
+	************************************************************************/
+	unsigned int takeBatch(T *pArr, unsigned int maxCount)
+	{
+		unsigned int count = tryTakeBatch(pArr, maxCount);
+		if (count > 0 || !m_bWait)
+			return count;
+
+		//Ϊ·߼˯ߣټһζУ֮䶪ʧ
+		boost::unique_lock<boost::mutex> lock(m_mutex);
+		while (true)
+		{
+			m_bSleeping.store(true, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			count = tryTakeBatch(pArr, maxCount);
+			if (count > 0 || m_bStopped.load(std::memory_order_relaxed))
+				break;
+			m_notEmpty.wait(lock);
+		}
+		m_bSleeping.store(false, std::memory_order_relaxed);
+		return count;
+	}
+
+	/************************************************************************
+	  ܣԷʽӶȡֵɶ߳ͬʱ
+	  
+		pArrȡֵ
+		maxCount룬ȡĸ
+	ֵʵȡĸ
+	************************************************************************/
+	unsigned int tryTakeBatch(T *pArr, unsigned int maxCount)
+	{
+		if (0 == maxCount)
+			return 0;
+
+		size_t pos = m_head.load(std::memory_order_relaxed);
+		unsigned int count;
+		while (true)
+		{
+			Cell *pCell = &m_pCells[pos & m_mask];
+			ptrdiff_t diff = (ptrdiff_t)pCell->seq.load(std::memory_order_acquire) - (ptrdiff_t)(pos + 1);
+			//ԪδдãΪ
+			if (diff < 0)
+				return 0;
+			//Ԫѱȡߣ¶ȡ±
+			if (diff > 0)
+			{
+				pos = m_head.load(std::memory_order_relaxed);
+				continue;
+			}
+
+			//ͳƴposʼɶĵԪ
+			count = 1;
+			while (count < maxCount && m_pCells[(pos + count) & m_mask].seq.load(std::memory_order_acquire) == pos + count + 1)
+				++count;
+			//ͨCASһռԪʧʱposΪµ±
+			if (m_head.compare_exchange_weak(pos, pos + count, std::memory_order_relaxed))
+				break;
+		}
+
+		for (unsigned int i = 0; i < count; ++i, ++pos)
+		{
+			Cell *pCell = &m_pCells[pos & m_mask];
+			pArr[i] = std::move(pCell->data);
+			//Ԫ±Ϊдһʹ
+			pCell->seq.store(pos + m_capacity, std::memory_order_release);
+		}
+		return count;
+	}
+
+	/************************************************************************
+	  ܣзʷʽΪʱ˯е̣߳˺ֻԷķʽʶ
+	  
+	ֵ
+	************************************************************************/
+	void stop()
+	{
+		if (m_bWait)
+		{
+			boost::unique_lock<boost::mutex> lock(m_mutex);
+			m_bStopped.store(true, std::memory_order_relaxed);
+			m_notEmpty.notify_all();
+		}
+	}
+
+	/************************************************************************
+	  ܣȡеǰȣڶֻ̻߳һֵ
+	  
+	ֵеǰ
+	************************************************************************/
+	unsigned int getSize()
+	{
+		size_t tail = m_tail.load(std::memory_order_relaxed);
+		size_t head = m_head.load(std::memory_order_relaxed);
+		return (tail > head) ? (unsigned int)(tail - head) : 0;
+	}
+
+	/************************************************************************
+	  ܣȡе󳤶
+	  
+	ֵе󳤶
+	************************************************************************/
+	unsigned int getCapacity()
+	{
+		return (unsigned int)m_capacity;
+	}
+
+private:
+	RingQueue(const RingQueue &);
+	RingQueue &operator=(const RingQueue &);
+
+	//еԪseqڱʶԪ״̬seq == ±ʾдseq == ± + 1ʾɶ
+	struct Cell
+	{
+		std::atomic<size_t> seq;
+		T data;
+	};
+
+	/************************************************************************
+	  ܣռһдĶеԪ
+	  
+	ֵռĶеԪָ룬ΪNULLʾ
+	************************************************************************/
+	Cell *claim()
+	{
+		size_t pos = m_tail.load(std::memory_order_relaxed);
+		while (true)
+		{
+			Cell *pCell = &m_pCells[pos & m_mask];
+			size_t seq = pCell->seq.load(std::memory_order_acquire);
+			ptrdiff_t diff = (ptrdiff_t)seq - (ptrdiff_t)pos;
+			if (0 == diff)
+			{
+				//ԪдͨCASռ±
+				if (m_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+					return pCell;
+			}
+			//Ԫδȡߣ
+			else if (diff < 0)
+				return NULL;
+			//Ԫѱռ¶ȡ±
+			else
+				pos = m_tail.load(std::memory_order_relaxed);
+		}
+	}
+
+	/************************************************************************
+	  ܣ߷дõĶеԪ߿˯ʱ
+	  
+		pCell룬дõĶеԪָ
+	ֵ
+	************************************************************************/
+	void publish(Cell *pCell)
+	{
+		//ռʱԪseq±꣬1ԱǵԪɶ
+		size_t seq = pCell->seq.load(std::memory_order_relaxed);
+		pCell->seq.store(seq + 1, std::memory_order_release);
+
+		if (m_bWait)
+		{
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			if (m_bSleeping.load(std::memory_order_relaxed))
+			{
+				boost::unique_lock<boost::mutex> lock(m_mutex);
+				m_notEmpty.notify_one();
+			}
+		}
+	}
+
+	//еԪ
+	Cell *m_pCells;
+	//е󳤶ȣΪ2
+	size_t m_capacity;
+	//±
+	size_t m_mask;
+	//Ƿʽʶ
+	bool m_bWait;
+	char m_pad0[CACHE_LINE_SIZE];
+	//±꣬߾
+	std::atomic<size_t> m_tail;
+	char m_pad1[CACHE_LINE_SIZE - sizeof(std::atomic<size_t>)];
+	//±꣬߾
+	std::atomic<size_t> m_head;
+	char m_pad2[CACHE_LINE_SIZE - sizeof(std::atomic<size_t>)];
+	//ʽʶʱΨһǷ˯
+	std::atomic<bool> m_bSleeping;
+	//Ƿstop()
+	std::atomic<bool> m_bStopped;
+	//ֻ˯ߡ
+	boost::mutex m_mutex;
+	//зǿ
+	boost::condition_variable m_notEmpty;
+};
+
+#endif
\ No newline at end of file
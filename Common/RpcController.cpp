@@ -2,6 +2,7 @@
 
 RpcController::RpcController()
 {
+	m_timeoutMs = 0;
 	Reset();
 }
 
@@ -9,6 +10,12 @@ void RpcController::Reset()
 {
 	m_strError.clear();
 	m_bFailed = false;
+	m_bTimedOut = false;
+	m_bCallCanceled = false;
+	m_cancelFn = NULL;
+	m_pCancelArg = NULL;
+	m_bCancelRequested.store(false);
+	m_cancelSlot.store(0);
 }
 
 bool RpcController::Failed() const
@@ -23,6 +30,12 @@ std::string RpcController::ErrorText() const
 
 void RpcController::StartCancel()
 {
+	//λȡǣٶȡȡidIOWorkerдȡidٶȡȡǣ
+	//߶˳һµĲһܿһߣ©ȡ
+	m_bCancelRequested.store(true);
+	uint64_t slot = m_cancelSlot.load();
+	if (0 != slot && NULL != m_cancelFn)
+		m_cancelFn(m_pCancelArg, (uint32_t)slot);
 }
 
 void RpcController::SetFailed(const std::string& reason)
@@ -38,4 +51,53 @@ bool RpcController::IsCanceled() const
 
 void RpcController::NotifyOnCancel(google::protobuf::Closure* callback)
 {
-}
\ No newline at end of file
+}
+
+void RpcController::setTimeout(unsigned int timeoutMs)
+{
+	m_timeoutMs = timeoutMs;
+}
+
+unsigned int RpcController::getTimeout() const
+{
+	return m_timeoutMs;
+}
+
+void RpcController::setTimedOut()
+{
+	SetFailed(RPC_ERROR_TIMEOUT);
+	m_bTimedOut = true;
+}
+
+bool RpcController::isTimedOut() const
+{
+	return m_bTimedOut;
+}
+
+void RpcController::setCancelHandler(CancelFn fn, void *pArg)
+{
+	m_cancelFn = fn;
+	m_pCancelArg = pArg;
+}
+
+bool RpcController::bindCancelId(uint32_t cancelId)
+{
+	m_cancelSlot.store(((uint64_t)1 << 32) | cancelId);
+	return m_bCancelRequested.load();
+}
+
+void RpcController::unbindCancelId()
+{
+	m_cancelSlot.store(0);
+}
+
+void RpcController::setCallCanceled()
+{
+	SetFailed(RPC_ERROR_CANCELED);
+	m_bCallCanceled = true;
+}
+
+bool RpcController::isCallCanceled() const
+{
+	return m_bCallCanceled;
+}
@@ -2,6 +2,8 @@
 #define _RPCCONTROLLER_H_
 
 #include <string>
+#include <atomic>
+#include <cstdint>
 #include <google/protobuf/service.h>
 
 #ifdef WIN32
@@ -18,6 +20,11 @@
 #define RPCCONTROLLER_DLL_EXPORTS
 #endif
 
+//óʱĴϢ
+#define RPC_ERROR_TIMEOUT "call timeout"
+//ñȡĴϢ
+#define RPC_ERROR_CANCELED "call canceled"
+
 class RPCCONTROLLER_DLL_EXPORTS RpcController : public google::protobuf::RpcController
 {
 public:
@@ -30,9 +37,98 @@ public:
 	virtual bool IsCanceled() const;
 	virtual void NotifyOnCancel(google::protobuf::Closure* callback);
 
+	/************************************************************************
+	  ܣõõĳʱʱ䣬Reset()
+	  
+		timeoutMs룬ʱʱ䣬λΪ룬Ϊ0ʾʹRpcChannelĬϳʱʱ
+	ֵ
+	************************************************************************/
+	void setTimeout(unsigned int timeoutMs);
+
+	/************************************************************************
+	  ܣȡõĳʱʱ
+	  
+	ֵʱʱ䣬λΪ룬Ϊ0ʾʹRpcChannelĬϳʱʱ
+	************************************************************************/
+	unsigned int getTimeout() const;
+
+	/************************************************************************
+	  ܣԳʱʧܽãErrorText()ΪRPC_ERROR_TIMEOUT
+	  
+	ֵ
+	************************************************************************/
+	void setTimedOut();
+
+	/************************************************************************
+	  ܣǷʱʧ
+	  
+	ֵ
+		trueóʱ
+		falseδʱ
+	************************************************************************/
+	bool isTimedOut() const;
+
+	//ͻȡõĴpArgΪʱĲcancelIdΪõȡid
+	typedef void (*CancelFn)(void *pArg, uint32_t cancelId);
+
+	/************************************************************************
+	  ܣʱRpcChannelڵ̵߳ãȡõĴReset()
+	  
+		fn룬
+		pArg룬Ĳ
+	ֵ
+	************************************************************************/
+	void setCancelHandler(CancelFn fn, void *pArg);
+
+	/************************************************************************
+	  ܣÿȡʱIOWorker̵߳ã¼õȡid
+	  
+		cancelId룬õȡid
+	ֵ
+		trueڴ֮ǰѵùStartCancel()Ӧȡ
+		falseδҪȡ
+	************************************************************************/
+	bool bindCancelId(uint32_t cancelId);
+
+	/************************************************************************
+	  ܣýʱIOWorker߳ڷû֮ǰã˺StartCancel()κ
+	  
+	ֵ
+	************************************************************************/
+	void unbindCancelId();
+
+	/************************************************************************
+	  ܣȡʧܽãErrorText()ΪRPC_ERROR_CANCELED
+	  
+	ֵ
+	************************************************************************/
+	void setCallCanceled();
+
+	/************************************************************************
+	  ܣǷȡʧܣͻˣʹõIsCanceled()ͬ
+	  
+	ֵ
+		trueñȡ
+		falseδȡ
+	************************************************************************/
+	bool isCallCanceled() const;
+
 private:
 	std::string m_strError;
 	bool m_bFailed;
+	//Ƿʱʧ
+	bool m_bTimedOut;
+	//õĳʱʱ䣬λΪ
+	unsigned int m_timeoutMs;
+	//Ƿȡʧ
+	bool m_bCallCanceled;
+	//ȡõĴ
+	CancelFn m_cancelFn;
+	void *m_pCancelArg;
+	//ǷѵùStartCancel()
+	std::atomic<bool> m_bCancelRequested;
+	//õȡid32λΪ1ʾѰ󶨣Ϊ0ʾδIOWorkerѽ
+	std::atomic<uint64_t> m_cancelSlot;
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,199 @@
+#ifndef _SLABTABLE_H_
+#define _SLABTABLE_H_
+
+#include <vector>
+#include <cstdint>
+
+//λڰidȡ;
+//1idĵλǲλ±꣬λǲλĴλÿͷһδ1
+//2롢ҡɾO(1)ģвλٷڴ棻
+//3λͷŲ·󣬴ɴidʧܣڵidȡµĶ
+//4̰߳ȫֻһ߳ʹá
+template<typename T>
+class SlabTable
+{
+public:
+	/************************************************************************
+	  ܣ캯
+	  
+		capacity룬λȡΪ2ݣΪ2^24ʣĸλڴ
+	ֵ
+	************************************************************************/
+	SlabTable(uint32_t capacity)
+	{
+		m_indexBits = 0;
+		while (m_indexBits < SLAB_TABLE_MAX_INDEX_BITS && ((uint32_t)1 << m_indexBits) < capacity)
+			++m_indexBits;
+		m_capacity = (uint32_t)1 << m_indexBits;
+		m_indexMask = m_capacity - 1;
+		m_freeHead = SLAB_TABLE_NIL;
+		m_size = 0;
+		//ֻԤַռ䣬λ״ʹʱŹ죬δõڴҳᱻռ
+		m_vecSlot.reserve(m_capacity);
+	}
+
+	/************************************************************************
+	  ܣ󣬷һλ
+	  
+		pValue룬ָ룬ΪNULL
+		idid
+	ֵ
+		trueɹ
+		falseλ
+	************************************************************************/
+	bool insert(T *pValue, uint32_t &id)
+	{
+		if (NULL == pValue)
+			return false;
+
+		uint32_t index;
+		//ȸÿвλûʱʹôδùĲλ
+		if (SLAB_TABLE_NIL != m_freeHead)
+		{
+			index = m_freeHead;
+			m_freeHead = m_vecSlot[index].nextFree;
+		}
+		else if (m_vecSlot.size() < m_capacity)
+		{
+			index = m_vecSlot.size();
+			m_vecSlot.push_back(Slot());
+		}
+		else
+			return false;
+
+		Slot &slot = m_vecSlot[index];
+		slot.pValue = pValue;
+		++m_size;
+		id = (slot.generation << m_indexBits) | index;
+		return true;
+	}
+
+	/************************************************************************
+	  ܣidҶ
+	  
+		id룬id
+	ֵָ룬ΪNULLʾidڻѹ
+	************************************************************************/
+	T *find(uint32_t id)
+	{
+		Slot *pSlot = getSlot(id);
+		return (NULL != pSlot) ? pSlot->pValue : NULL;
+	}
+
+	/************************************************************************
+	  ܣidɾͷλ
+	  
+		id룬id
+	ֵɾĶָ룬ΪNULLʾidڻѹ
+	************************************************************************/
+	T *remove(uint32_t id)
+	{
+		Slot *pSlot = getSlot(id);
+		if (NULL == pSlot)
+			return NULL;
+
+		T *pValue = pSlot->pValue;
+		release(id & m_indexMask);
+		return pValue;
+	}
+
+	/************************************************************************
+	  ܣɾжͷвλ
+	  
+		vecValueɾĶָ
+	ֵ
+	************************************************************************/
+	void removeAll(std::vector<T *> &vecValue)
+	{
+		for (uint32_t i = 0; i < m_vecSlot.size() && m_size > 0; ++i)
+		{
+			if (NULL == m_vecSlot[i].pValue)
+				continue;
+			vecValue.push_back(m_vecSlot[i].pValue);
+			release(i);
+		}
+	}
+
+	/************************************************************************
+	  ܣȡ
+	  
+	ֵ
+	************************************************************************/
+	uint32_t size()
+	{
+		return m_size;
+	}
+
+private:
+	//λ±λ8λ
+	static const uint32_t SLAB_TABLE_MAX_INDEX_BITS = 24;
+	//
+	static const uint32_t SLAB_TABLE_NIL = ~((uint32_t)0);
+
+	//λ
+	struct Slot
+	{
+		//ָ룬ΪNULLʾλ
+		T *pValue;
+		//λĴ
+		uint32_t generation;
+		//ʱһвλ±
+		uint32_t nextFree;
+
+		Slot()
+		{
+			pValue = NULL;
+			generation = 0;
+			nextFree = SLAB_TABLE_NIL;
+		}
+	};
+
+	/************************************************************************
+	  ܣidȡʹõĲλУ
+	  
+		id룬id
+	ֵλָ룬ΪNULLʾidڻѹ
+	************************************************************************/
+	Slot *getSlot(uint32_t id)
+	{
+		uint32_t index = id & m_indexMask;
+		if (index >= m_vecSlot.size())
+			return NULL;
+		Slot &slot = m_vecSlot[index];
+		if (NULL == slot.pValue || slot.generation != (id >> m_indexBits))
+			return NULL;
+		return &slot;
+	}
+
+	/************************************************************************
+	  ܣͷŲλ1Żؿ
+	  
+		index룬λ±
+	ֵ
+	************************************************************************/
+	void release(uint32_t index)
+	{
+		Slot &slot = m_vecSlot[index];
+		slot.pValue = NULL;
+		//ֻռidĸλ
+		slot.generation = (slot.generation + 1) & (~((uint32_t)0) >> m_indexBits);
+		slot.nextFree = m_freeHead;
+		m_freeHead = index;
+		--m_size;
+	}
+
+	//λڹʱԤ·
+	std::vector<Slot> m_vecSlot;
+	//λ
+	uint32_t m_capacity;
+	//λ±λ
+	uint32_t m_indexBits;
+	//λ±
+	uint32_t m_indexMask;
+	//ͷΪSLAB_TABLE_NILʾûбͷŹĿвλ
+	uint32_t m_freeHead;
+	//
+	uint32_t m_size;
+};
+
+#endif
@@ -77,12 +77,12 @@ public:
 	bool take(T &x)
 	{
 		//зʷʽΪҶΪգ
-		if (!bWait && m_queue.empty())
+		if (!m_bWait && m_queue.empty())
 			return false;
 
 		//²
 		boost::unique_lock<boost::mutex> lock(m_mutex);
-		if (bWait)
+		if (m_bWait)
 		{
 			//ⲿδùstop()ʱͬȴеķǿ
 			while (!m_bStopped && m_queue.empty())
@@ -135,7 +135,8 @@ public:
 				return false;
 		}
 
-		queue = m_queue;
+		//ֱӽ⿽нڵ
+		queue.swap(m_queue);
 		m_queue.clear();
 		if (m_bWait)
 			m_notFull.notify_one();
@@ -239,7 +240,7 @@ private:
 		if (bLeftValue)
 			m_queue.push_back(x);
 		else
-			m_queue.push_back(move(x));
+			m_queue.push_back(std::move(x));
 		if (m_bWait)
 			//дʱǿգѵȴеķǿ߳
 			m_notEmpty.notify_one();
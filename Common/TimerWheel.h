@@ -0,0 +1,277 @@
+#ifndef _TIMERWHEEL_H_
+#define _TIMERWHEEL_H_
+
+#include <cstdint>
+#include <cstddef>
+
+//ʱֵ0Ĳλλ
+#define TIMER_WHEEL_ROOT_BITS 8
+//ʱֵ1㼰ÿĲλλ
+#define TIMER_WHEEL_LEVEL_BITS 6
+//ʱֵ1㼰ϵĲ
+#define TIMER_WHEEL_UPPER_LEVELS 3
+
+//ʱϵĶʱڵ㣬ǶڱʱĶУʱִڴ
+struct TimerNode
+{
+	//ǰһڵ㣬ΪNULLʾڵ㲻ʱ
+	TimerNode *pPrev;
+	//ĺһڵ
+	TimerNode *pNext;
+	//ڵtick
+	uint64_t expire;
+	//ʱĶָ
+	void *pOwner;
+
+	TimerNode()
+	{
+		pPrev = NULL;
+		pNext = NULL;
+		expire = 0;
+		pOwner = NULL;
+	}
+
+	/************************************************************************
+	  ܣڵǷʱ
+	  
+	ֵ
+		trueʱ
+		falseʱ
+	************************************************************************/
+	bool isLinked() const
+	{
+		return NULL != pPrev;
+	}
+};
+
+//ֲʱ
+//102^TIMER_WHEEL_ROOT_BITSλÿλ1tickϸÿλһһȦ
+//2ӡɾO(1)ģÿƽһtickֻһλϲλ²תһȦʱ·ţcascade
+//3ʱ䳬ʱַΧĽڵ߲·ź¼λã
+//4̰߳ȫֻһ߳ʹá
+class TimerWheel
+{
+public:
+	/************************************************************************
+	  ܣ캯
+	  
+		currentTick룬ǰtick
+	ֵ
+	************************************************************************/
+	TimerWheel(uint64_t currentTick = 0)
+	{
+		m_currentTick = currentTick;
+		m_size = 0;
+		for (unsigned int i = 0; i < ROOT_SIZE; ++i)
+			initList(m_arrRoot[i]);
+		for (unsigned int i = 0; i < TIMER_WHEEL_UPPER_LEVELS; ++i)
+		{
+			for (unsigned int j = 0; j < LEVEL_SIZE; ++j)
+				initList(m_arrLevel[i][j]);
+		}
+	}
+
+	/************************************************************************
+	  ܣӶʱڵʱʱɾ
+	  
+		pNode룬ʱڵ
+		expire룬ڵtickڵǰtickʱһadvance()ʱ
+	ֵ
+	************************************************************************/
+	void add(TimerNode *pNode, uint64_t expire)
+	{
+		remove(pNode);
+		pNode->expire = expire;
+		link(pNode);
+		++m_size;
+	}
+
+	/************************************************************************
+	  ܣɾʱڵ㲻ʱʱκ
+	  
+		pNode룬ʱڵ
+	ֵ
+	************************************************************************/
+	void remove(TimerNode *pNode)
+	{
+		if (!pNode->isLinked())
+			return;
+		unlink(pNode);
+		--m_size;
+	}
+
+	/************************************************************************
+	  ܣƽʱֵָtickÿڵĽڵonExpireڵڵǰѴʱɾ
+	  
+		nowTick룬ǰtick
+		onExpire룬ڴΪTimerNodeָ룬ӡɾڵ
+	ֵ
+	************************************************************************/
+	template<typename Fn>
+	void advance(uint64_t nowTick, Fn onExpire)
+	{
+		while (m_currentTick <= nowTick)
+		{
+			//ʱΪʱֱǰtick
+			if (0 == m_size)
+			{
+				m_currentTick = nowTick + 1;
+				return;
+			}
+
+			unsigned int index = m_currentTick & (ROOT_SIZE - 1);
+			//0תһȦϲ·һλϲҲתһȦʱӸϲ·
+			for (unsigned int level = 0; 0 == index && level < TIMER_WHEEL_UPPER_LEVELS; ++level)
+			{
+				index = (m_currentTick >> (TIMER_WHEEL_ROOT_BITS + level * TIMER_WHEEL_LEVEL_BITS)) & (LEVEL_SIZE - 1);
+				cascade(m_arrLevel[level][index]);
+			}
+
+			//ȰѵڵĲλƳӵĽڵ㲻ڱtickڱ
+			TimerNode expired;
+			initList(expired);
+			spliceList(m_arrRoot[m_currentTick & (ROOT_SIZE - 1)], expired);
+			++m_currentTick;
+			while (expired.pNext != &expired)
+			{
+				TimerNode *pNode = expired.pNext;
+				unlink(pNode);
+				--m_size;
+				onExpire(pNode);
+			}
+		}
+	}
+
+	/************************************************************************
+	  ܣȡʱϵĽڵ
+	  
+	ֵڵ
+	************************************************************************/
+	size_t size() const
+	{
+		return m_size;
+	}
+
+private:
+	TimerWheel(const TimerWheel &);
+	TimerWheel &operator=(const TimerWheel &);
+
+	//0λ
+	static const unsigned int ROOT_SIZE = 1u << TIMER_WHEEL_ROOT_BITS;
+	//1㼰ÿλ
+	static const unsigned int LEVEL_SIZE = 1u << TIMER_WHEEL_LEVEL_BITS;
+	//ʱֱӱʾʱ
+	static const uint64_t MAX_SPAN = ((uint64_t)1 << (TIMER_WHEEL_ROOT_BITS + TIMER_WHEEL_UPPER_LEVELS * TIMER_WHEEL_LEVEL_BITS)) - 1;
+
+	/************************************************************************
+	  ܣʱѽڵӦĲλ
+	  
+		pNode룬ʱڵ
+	ֵ
+	************************************************************************/
+	void link(TimerNode *pNode)
+	{
+		uint64_t expire = pNode->expire;
+		//ѵڵĽڵ뵱ǰλ
+		if (expire < m_currentTick)
+			expire = m_currentTick;
+		//ΧĽڵԶ·ʱ¼λ
+		else if (expire - m_currentTick > MAX_SPAN)
+			expire = m_currentTick + MAX_SPAN;
+
+		uint64_t delta = expire - m_currentTick;
+		TimerNode *pHead;
+		if (delta < ROOT_SIZE)
+			pHead = &m_arrRoot[expire & (ROOT_SIZE - 1)];
+		else
+		{
+			unsigned int level = 0;
+			unsigned int shift = TIMER_WHEEL_ROOT_BITS;
+			while (level + 1 < TIMER_WHEEL_UPPER_LEVELS && delta >= ((uint64_t)1 << (shift + TIMER_WHEEL_LEVEL_BITS)))
+			{
+				++level;
+				shift += TIMER_WHEEL_LEVEL_BITS;
+			}
+			pHead = &m_arrLevel[level][(expire >> shift) & (LEVEL_SIZE - 1)];
+		}
+
+		pNode->pPrev = pHead->pPrev;
+		pNode->pNext = pHead;
+		pHead->pPrev->pNext = pNode;
+		pHead->pPrev = pNode;
+	}
+
+	/************************************************************************
+	  ܣѽڵڵժ
+	  
+		pNode룬ʱڵ
+	ֵ
+	************************************************************************/
+	static void unlink(TimerNode *pNode)
+	{
+		pNode->pPrev->pNext = pNode->pNext;
+		pNode->pNext->pPrev = pNode->pPrev;
+		pNode->pPrev = NULL;
+		pNode->pNext = NULL;
+	}
+
+	/************************************************************************
+	  ܣϲһλеĽڵ·ʱ֣ǻ䵽͵Ĳ
+	  
+		head룬ϲλͷ
+	ֵ
+	************************************************************************/
+	void cascade(TimerNode &head)
+	{
+		TimerNode list;
+		initList(list);
+		spliceList(head, list);
+		while (list.pNext != &list)
+		{
+			TimerNode *pNode = list.pNext;
+			unlink(pNode);
+			link(pNode);
+		}
+	}
+
+	/************************************************************************
+	  ܣʼͷָԼ
+	  
+		head룬ͷ
+	ֵ
+	************************************************************************/
+	static void initList(TimerNode &head)
+	{
+		head.pPrev = &head;
+		head.pNext = &head;
+	}
+
+	/************************************************************************
+	  ܣfromенڵƵtoУfromΪ
+	  
+		from룬Դͷ
+		toĿͷΪ
+	ֵ
+	************************************************************************/
+	static void spliceList(TimerNode &from, TimerNode &to)
+	{
+		if (from.pNext == &from)
+			return;
+		to.pNext = from.pNext;
+		to.pPrev = from.pPrev;
+		to.pNext->pPrev = &to;
+		to.pPrev->pNext = &to;
+		initList(from);
+	}
+
+	//ǰtickһtick
+	uint64_t m_currentTick;
+	//ڵ
+	size_t m_size;
+	//0λͷ
+	TimerNode m_arrRoot[ROOT_SIZE];
+	//1㼰ϲλͷ
+	TimerNode m_arrLevel[TIMER_WHEEL_UPPER_LEVELS][LEVEL_SIZE];
+};
+
+#endif
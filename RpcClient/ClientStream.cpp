@@ -0,0 +1,222 @@
+#include "ClientStream.h"
+#include <boost/thread/locks.hpp>
+#include "ProtocolCodec.h"
+
+ClientStream::ClientStream()
+{
+	m_bEnded = true;
+	m_pController = NULL;
+	m_window = 1;
+	m_consumed = 0;
+	m_connId = 0;
+	m_callId = 0;
+	m_creditFn = NULL;
+	m_pCreditArg = NULL;
+	m_bWritable = false;
+	m_writeCredit = 0;
+	m_bWritesDone = false;
+	m_version = PROTOCOL_V1;
+	m_frameFn = NULL;
+}
+
+ClientStream::~ClientStream()
+{
+	close();
+}
+
+google::protobuf::Closure *ClientStream::start(RpcController *pController, uint32_t window)
+{
+	reset(pController, window, false);
+	return this;
+}
+
+google::protobuf::Closure *ClientStream::startWrite(RpcController *pController)
+{
+	reset(pController, 1, true);
+	return this;
+}
+
+void ClientStream::reset(RpcController *pController, uint32_t window, bool bWritable)
+{
+	boost::lock_guard<boost::mutex> lock(m_mutex);
+	m_queMessage.clear();
+	m_bEnded = false;
+	m_pController = pController;
+	m_window = (0 == window) ? 1 : window;
+	m_consumed = 0;
+	m_creditFn = NULL;
+	m_pCreditArg = NULL;
+	m_bWritable = bWritable;
+	m_writeCredit = 0;
+	m_bWritesDone = false;
+	m_frameFn = NULL;
+}
+
+void ClientStream::bind(unsigned int connId, uint32_t callId, unsigned char version, CreditFn creditFn, FrameFn frameFn, void *pArg)
+{
+	boost::lock_guard<boost::mutex> lock(m_mutex);
+	m_connId = connId;
+	m_callId = callId;
+	m_version = version;
+	m_creditFn = creditFn;
+	m_pCreditArg = pArg;
+	if (m_bWritable)
+	{
+		m_frameFn = frameFn;
+		//finish()ڵȴ󷢳
+		m_cond.notify_all();
+	}
+}
+
+void ClientStream::grant(uint32_t credit)
+{
+	boost::lock_guard<boost::mutex> lock(m_mutex);
+	bool bWake = (0 == m_writeCredit);
+	m_writeCredit += credit;
+	if (bWake)
+		m_cond.notify_all();
+}
+
+void ClientStream::push(std::string *pContent)
+{
+	boost::lock_guard<boost::mutex> lock(m_mutex);
+	m_queMessage.push_back(std::string());
+	m_queMessage.back().swap(*pContent);
+	//ȡֻ߳ûϢʱȴ
+	if (1 == m_queMessage.size())
+		m_cond.notify_one();
+}
+
+void ClientStream::Run()
+{
+	boost::lock_guard<boost::mutex> lock(m_mutex);
+	//ѽٹ黹ȣҲٷϢ
+	m_bEnded = true;
+	m_creditFn = NULL;
+	m_frameFn = NULL;
+	m_cond.notify_all();
+}
+
+bool ClientStream::read(google::protobuf::Message *pMsg)
+{
+	std::string strContent;
+	CreditFn creditFn = NULL;
+	void *pCreditArg = NULL;
+	unsigned int connId = 0;
+	uint32_t callId = 0;
+	uint32_t credit = 0;
+	{
+		boost::unique_lock<boost::mutex> lock(m_mutex);
+		while (m_queMessage.empty() && !m_bEnded)
+			m_cond.wait(lock);
+		//ýǰϢȻԶȡ
+		if (m_queMessage.empty())
+			return false;
+		strContent.swap(m_queMessage.front());
+		m_queMessage.pop_front();
+
+		//ȡԼһ봰ڵϢ黹ȣÿϢһζ
+		if (++m_consumed >= (m_window + 1) / 2 && NULL != m_creditFn)
+		{
+			creditFn = m_creditFn;
+			pCreditArg = m_pCreditArg;
+			connId = m_connId;
+			callId = m_callId;
+			credit = m_consumed;
+			m_consumed = 0;
+		}
+	}
+	//ãIOWorker߳̿ڵȴϢ
+	if (NULL != creditFn)
+		creditFn(pCreditArg, connId, callId, credit);
+
+	return NULL != pMsg && pMsg->ParseFromString(strContent);
+}
+
+bool ClientStream::write(const google::protobuf::Message &msg)
+{
+	FrameFn frameFn;
+	void *pArg;
+	unsigned int connId;
+	uint32_t callId;
+	unsigned char version;
+	{
+		boost::unique_lock<boost::mutex> lock(m_mutex);
+		if (!m_bWritable)
+			return false;
+		//ܵúʼȣȵǰһѷ
+		while (0 == m_writeCredit && !m_bEnded && !m_bWritesDone)
+			m_cond.wait(lock);
+		if (m_bEnded || m_bWritesDone || NULL == m_frameFn)
+			return false;
+		--m_writeCredit;
+		frameFn = m_frameFn;
+		pArg = m_pCreditArg;
+		connId = m_connId;
+		callId = m_callId;
+		version = m_version;
+	}
+	//ڵ̱߳ϢIOWorker߳̿ڵȴ
+	if (sendFrame(STREAM_MESSAGE, &msg, frameFn, pArg, connId, callId, version))
+		return true;
+	//Ϣûз˻ض
+	boost::lock_guard<boost::mutex> lock(m_mutex);
+	++m_writeCredit;
+	return false;
+}
+
+void ClientStream::finish()
+{
+	boost::unique_lock<boost::mutex> lock(m_mutex);
+	if (!m_bWritable)
+		return;
+	//󷢳֪id
+	while (NULL == m_frameFn && !m_bEnded)
+		m_cond.wait(lock);
+	if (!m_bEnded && !m_bWritesDone)
+	{
+		m_bWritesDone = true;
+		FrameFn frameFn = m_frameFn;
+		void *pArg = m_pCreditArg;
+		unsigned int connId = m_connId;
+		uint32_t callId = m_callId;
+		unsigned char version = m_version;
+		lock.unlock();
+		//END֡ȥʱȲϢд꣬ȡ
+		if (!sendFrame(STREAM_END, NULL, frameFn, pArg, connId, callId, version) && NULL != m_pController)
+			m_pController->StartCancel();
+		lock.lock();
+	}
+	while (!m_bEnded)
+		m_cond.wait(lock);
+}
+
+bool ClientStream::sendFrame(uint32_t frame, const google::protobuf::Message *pMsg, FrameFn frameFn, void *pArg,
+	unsigned int connId, uint32_t callId, unsigned char version)
+{
+	evbuffer *pBuf = evbuffer_new();
+	if (NULL == pBuf || !ProtocolCodec::encodeStreamFrame(pBuf, callId, frame, pMsg, NULL, version))
+	{
+		if (NULL != pBuf)
+			evbuffer_free(pBuf);
+		return false;
+	}
+	return frameFn(pArg, connId, callId, pBuf);
+}
+
+void ClientStream::close()
+{
+	boost::unique_lock<boost::mutex> lock(m_mutex);
+	if (m_bEnded)
+		return;
+	//ȡãIOWorker漴ȡʧܽãֹ֪ͨͣ
+	if (NULL != m_pController)
+	{
+		lock.unlock();
+		m_pController->StartCancel();
+		lock.lock();
+	}
+	while (!m_bEnded)
+		m_cond.wait(lock);
+	m_queMessage.clear();
+}
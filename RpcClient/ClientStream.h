@@ -0,0 +1,206 @@
+#ifndef _CLIENTSTREAM_H_
+#define _CLIENTSTREAM_H_
+
+#include <cstdint>
+#include <string>
+#include <deque>
+#include <google/protobuf/service.h>
+#include <google/protobuf/message.h>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
+#include "RpcController.h"
+
+#ifdef WIN32
+#ifdef RPCCLIENT_EXPORTS
+#define RPCCLIENT_DLL_EXPORTS __declspec(dllexport)
+#else
+#define RPCCLIENT_DLL_EXPORTS __declspec(dllimport)
+#endif
+#else
+#define RPCCLIENT_DLL_EXPORTS
+#endif
+
+struct evbuffer;
+//ͻûջϣڷʽʱϢ÷
+//	ClientStream stream;
+//	pChannel->startStream(pMethod, &controller, &req, &stream);
+//	while (stream.read(&resp)) { ... }
+//	if (controller.Failed()) { ... }
+//ڿͻʽʱϢ÷
+//	ClientStream stream;
+//	pChannel->startClientStream(pMethod, &controller, &resp, &stream);
+//	for (...) { if (!stream.write(req)) break; }
+//	stream.finish();
+//	if (controller.Failed()) { ... }
+//1Ϣ󼴿ɶȡصý
+//2໺洰ڴСδȡϢȡԼһ봰ںѶȹ黹ʱͣͣ
+//   ˶ȡĿͻͬʱΪռõڴ棻
+//3дÿϢ1Ķȣʱwrite()ֱȡϢ黹ȣ
+//   ˶ȡķͬʱΪռõڴ棻
+//4õĳʱʱӷʱ𣬸ʱӦRpcController㹻ĳʱʱ䣻
+//5ͬһʱֻһ̶߳ȡдͬһڵýǰʱȡòȴ
+class RPCCLIENT_DLL_EXPORTS ClientStream : private google::protobuf::Closure
+{
+public:
+	//黹ȵĴpArgΪʱĲ
+	typedef void (*CreditFn)(void *pArg, unsigned int connId, uint32_t callId, uint32_t credit);
+	//Ϳͻʽõʽ֡ĴpBufΪЭݣͷţǷѽIOWorker
+	typedef bool (*FrameFn)(void *pArg, unsigned int connId, uint32_t callId, evbuffer *pBuf);
+
+	/************************************************************************
+	  ܣ췽½ѽ״̬
+	  
+	ֵ
+	************************************************************************/
+	ClientStream();
+
+	/************************************************************************
+	  ܣδʱȡòȴ
+	  
+	ֵ
+	************************************************************************/
+	~ClientStream();
+
+	/************************************************************************
+	  ܣȡһϢûѵϢʱȴ
+	  
+		pMsgϢһǷ͵Message
+	ֵ
+		trueȡɹ
+		falseѽɹʧԭRpcControllerϢлʧʱҲfalse
+	************************************************************************/
+	bool read(google::protobuf::Message *pMsg);
+
+	/************************************************************************
+	  ܣһϢĶʱȴֻڿͻʽ
+	  
+		msg룬ϢһǷ͵Message
+	ֵ
+		trueϢѽIOWorker
+		falseѽѻظʧܡʱȡѵfinish()ǿͻʽûIOWorkerʱҲfalse
+	************************************************************************/
+	bool write(const google::protobuf::Message &msg);
+
+	/************************************************************************
+	  ܣͻʽõд룬߷Ϣд꣬ȴý֮ɴRpcControllerͳλȡ
+	  
+	ֵ
+	************************************************************************/
+	void finish();
+
+	/************************************************************************
+	  ܣǰȡã漴ֹͣͣȴý
+	  
+	ֵ
+	************************************************************************/
+	void close();
+
+	/************************************************************************
+	  ܣʼһʽãRpcChannelڵ̵߳ãýǰٴοʼ
+	  
+		pController룬õRpcControllerָ룬ȡ
+		window룬Ĵڣ໺δȡϢΪ0ʱ1
+	ֵIOWorkerĵýص
+	************************************************************************/
+	google::protobuf::Closure *start(RpcController *pController, uint32_t window);
+
+	/************************************************************************
+	  ܣʼһοͻʽãRpcChannelڵ̵߳ãýǰٴοʼ
+	  
+		pController룬õRpcControllerָ룬ȡ
+	ֵIOWorkerĵýص
+	************************************************************************/
+	google::protobuf::Closure *startWrite(RpcController *pController);
+
+	/************************************************************************
+	  ܣ󷢳ʱIOWorker̵߳ã󶨹黹Ⱥͷʽ֡Ĵ
+	  
+		connId룬ڵid
+		callId룬id
+		version룬ϷʱʹõЭ汾ڱʽ֡
+		creditFn룬黹ȵĴ
+		frameFn룬ʽ֡Ĵ
+		pArg룬Ĳ
+	ֵ
+	************************************************************************/
+	void bind(unsigned int connId, uint32_t callId, unsigned char version, CreditFn creditFn, FrameFn frameFn, void *pArg);
+
+	/************************************************************************
+	  ܣյĿͻʽõĶʱIOWorker̵߳
+	  
+		credit룬
+	ֵ
+	************************************************************************/
+	void grant(uint32_t credit);
+
+	/************************************************************************
+	  ܣյһϢʱIOWorker̵߳
+	  
+		pContentлϢݱУ
+	ֵ
+	************************************************************************/
+	void push(std::string *pContent);
+
+private:
+	ClientStream(const ClientStream &);
+	ClientStream &operator=(const ClientStream &);
+
+	//ýIOWorkeṛ߳ʧʱڵִ̣߳
+	void Run();
+
+	/************************************************************************
+	  ܣ״̬ʼһε
+	  
+		pController룬õRpcControllerָ
+		window룬Ĵ
+		bWritable룬Ƿǿͻʽ
+	ֵ
+	************************************************************************/
+	void reset(RpcController *pController, uint32_t window, bool bWritable);
+
+	/************************************************************************
+	  ܣʽ֡IOWorkerͣ
+	  
+		frame룬֡
+		pMsg룬MESSAGE֡Ϣ֡ΪNULL
+		frameFnpArgconnIdcallIdversion룬ʱȡõϢ
+	ֵ
+		trueѽIOWorker
+		falseʧܻIOWorker
+	************************************************************************/
+	static bool sendFrame(uint32_t frame, const google::protobuf::Message *pMsg, FrameFn frameFn, void *pArg,
+		unsigned int connId, uint32_t callId, unsigned char version);
+
+	boost::mutex m_mutex;
+	//Ϣȵ󷢳ýʱȡд߳ϱ
+	boost::condition_variable m_cond;
+	//ѵδȡϢ
+	std::deque<std::string> m_queMessage;
+	//Ƿѽ
+	bool m_bEnded;
+	//õRpcControllerָ
+	RpcController *m_pController;
+	//Ĵ
+	uint32_t m_window;
+	//ϴι黹ȺȡϢ
+	uint32_t m_consumed;
+	//ڵid͵id󷢳Ч
+	unsigned int m_connId;
+	uint32_t m_callId;
+	//黹ȵĴ󷢳ǰΪNULL
+	CreditFn m_creditFn;
+	//ʽ֡ĴĲ
+	void *m_pCreditArg;
+	//Ƿǿͻʽ
+	bool m_bWritable;
+	//ʣд
+	uint32_t m_writeCredit;
+	//Ƿѽд
+	bool m_bWritesDone;
+	//ϷʱʹõЭ汾󷢳Ч
+	unsigned char m_version;
+	//ʽ֡Ĵͻʽõ󷢳ǰ͵ýΪNULL
+	FrameFn m_frameFn;
+};
+
+#endif
@@ -0,0 +1,171 @@
+#include "Hedge.h"
+#include "IOWorker.h"
+
+HedgePolicy::HedgePolicy(unsigned int hedgeDelayMs, RpcChannel *pHedgeChannel)
+{
+	m_callCount.store(0);
+	m_hedgeCount.store(0);
+	m_hedgeWinCount.store(0);
+	m_retryCount.store(0);
+	m_fixedDelayMs.store(hedgeDelayMs);
+	m_pHedgeChannel.store(pHedgeChannel);
+	for (unsigned int i = 0; i < HEDGE_LATENCY_BUCKETS; ++i)
+		m_arrBucket[i] = 0;
+	m_sampleCount = 0;
+	m_sinceUpdate = 0;
+	m_adaptiveDelayMs.store(0);
+}
+
+void HedgePolicy::set(unsigned int hedgeDelayMs, RpcChannel *pHedgeChannel)
+{
+	m_fixedDelayMs.store(hedgeDelayMs);
+	m_pHedgeChannel.store(pHedgeChannel);
+}
+
+unsigned int HedgePolicy::getHedgeDelay()
+{
+	unsigned int fixedDelayMs = m_fixedDelayMs.load(std::memory_order_relaxed);
+	return (fixedDelayMs > 0) ? fixedDelayMs : m_adaptiveDelayMs.load(std::memory_order_relaxed);
+}
+
+RpcChannel *HedgePolicy::getHedgeChannel()
+{
+	return m_pHedgeChannel.load();
+}
+
+void HedgePolicy::recordLatency(uint64_t latencyMs)
+{
+	boost::lock_guard<boost::mutex> lock(m_mutex);
+	++m_arrBucket[getBucket(latencyMs)];
+	++m_sampleCount;
+	//ʱͰ룬Ȩ˥
+	if (m_sampleCount >= HEDGE_LATENCY_WINDOW)
+	{
+		m_sampleCount = 0;
+		for (unsigned int i = 0; i < HEDGE_LATENCY_BUCKETS; ++i)
+		{
+			m_arrBucket[i] /= 2;
+			m_sampleCount += m_arrBucket[i];
+		}
+	}
+
+	if (++m_sinceUpdate < HEDGE_P95_UPDATE_INTERVAL || m_sampleCount < HEDGE_MIN_SAMPLES)
+		return;
+	m_sinceUpdate = 0;
+	//ӵ͵ۼӣҵ95%ͰȡϽ
+	unsigned int target = m_sampleCount - m_sampleCount / 20;
+	unsigned int sum = 0;
+	for (unsigned int i = 0; i < HEDGE_LATENCY_BUCKETS; ++i)
+	{
+		sum += m_arrBucket[i];
+		if (sum >= target)
+		{
+			m_adaptiveDelayMs.store(getBucketUpper(i));
+			break;
+		}
+	}
+}
+
+void HedgePolicy::getStat(HedgeStat &stat)
+{
+	stat.callCount = m_callCount.load();
+	stat.hedgeCount = m_hedgeCount.load();
+	stat.hedgeWinCount = m_hedgeWinCount.load();
+	stat.retryCount = m_retryCount.load();
+	stat.hedgeDelayMs = getHedgeDelay();
+}
+
+unsigned int HedgePolicy::getBucket(uint64_t latencyMs)
+{
+	if (latencyMs < 16)
+		return (unsigned int)latencyMs;
+	//2[2^exp, 2^(exp+1))Ϊ4Ͱ
+	unsigned int exp = 4;
+	while (exp < 63 && (latencyMs >> (exp + 1)) > 0)
+		++exp;
+	unsigned int bucket = 16 + (exp - 4) * 4 + (unsigned int)((latencyMs >> (exp - 2)) & 3);
+	return (bucket < HEDGE_LATENCY_BUCKETS) ? bucket : HEDGE_LATENCY_BUCKETS - 1;
+}
+
+unsigned int HedgePolicy::getBucketUpper(unsigned int bucket)
+{
+	if (bucket < 16)
+		return bucket + 1;
+	unsigned int exp = 4 + (bucket - 16) / 4;
+	unsigned int sub = (bucket - 16) % 4;
+	return (1u << exp) + (sub + 1) * (1u << (exp - 2));
+}
+
+HedgeGroup::HedgeGroup()
+{
+	bDelivered = false;
+	bSecondLegSent = false;
+	pendingLegs = 1;
+	refCount.store(1);
+	pPolicy = NULL;
+	pChannel = NULL;
+	pServiceDescriptor = NULL;
+	methodIndex = 0;
+	deadlineMs = 0;
+	pRespMessage = NULL;
+	pClosure = NULL;
+	pController = NULL;
+	pWaiter = NULL;
+}
+
+bool HedgeGroup::claim(bool bSuccess, bool bHedgeLeg, bool &bRetry)
+{
+	bRetry = false;
+	boost::lock_guard<boost::mutex> lock(mutex);
+	--pendingLegs;
+	if (bDelivered)
+		return false;
+
+	if (bSuccess)
+	{
+		bDelivered = true;
+		if (bHedgeLeg)
+			++pPolicy->m_hedgeWinCount;
+		return true;
+	}
+
+	//ʧʱڶûδֹʱ䣬
+	if (!bSecondLegSent && (0 == deadlineMs || IOWorker::getNowMs() < deadlineMs))
+	{
+		bSecondLegSent = true;
+		++pendingLegs;
+		bRetry = true;
+		return false;
+	}
+	//һ;ȴĽ
+	if (pendingLegs > 0)
+		return false;
+	bDelivered = true;
+	return true;
+}
+
+bool HedgeGroup::startHedge()
+{
+	boost::lock_guard<boost::mutex> lock(mutex);
+	if (bDelivered || bSecondLegSent)
+		return false;
+	bSecondLegSent = true;
+	++pendingLegs;
+	return true;
+}
+
+bool HedgeGroup::abortLeg()
+{
+	boost::lock_guard<boost::mutex> lock(mutex);
+	--pendingLegs;
+	if (bDelivered || pendingLegs > 0)
+		return false;
+	bDelivered = true;
+	return true;
+}
+
+void HedgeGroup::release()
+{
+	if (1 == refCount.fetch_sub(1))
+		delete this;
+}
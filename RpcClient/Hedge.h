@@ -0,0 +1,191 @@
+#ifndef _HEDGE_H_
+#define _HEDGE_H_
+
+#include "RpcClientGlobal.h"
+#include "IRpcChannel.h"
+
+//ӳֱͼͰ0~15ÿһͰ֮ÿ2Ϊ4Ͱ
+#define HEDGE_LATENCY_BUCKETS 64
+//ӳﵽֵʱͰ룬ʹp95ӳٱ仯
+#define HEDGE_LATENCY_WINDOW 1024
+//ﵽֵſʼp95ӦԳ
+#define HEDGE_MIN_SAMPLES 100
+//ÿ¼ô¼һp95
+#define HEDGE_P95_UPDATE_INTERVAL 64
+
+class RpcChannel;
+
+//ĶԳԼͳ
+//1Գӳٹ̶ʱ÷ôδأһӣԳͨ
+//2ԳӳΪ0ʱ÷Ӧӳٵp95ӦʱԳ壻
+//3һʧܶһδʱһΡ
+class HedgePolicy
+{
+public:
+	/************************************************************************
+	  ܣ췽
+	  
+		hedgeDelayMs룬Գӳ٣λΪ룬Ϊ0ʾp95Ӧ
+		pHedgeChannel룬ʹõͨΪNULLʾʹõڵͨ
+	ֵ
+	************************************************************************/
+	HedgePolicy(unsigned int hedgeDelayMs, RpcChannel *pHedgeChannel);
+
+	/************************************************************************
+	  ܣ޸Ĳ
+	  췽
+	ֵ
+	************************************************************************/
+	void set(unsigned int hedgeDelayMs, RpcChannel *pHedgeChannel);
+
+	/************************************************************************
+	  ܣȡǰĶԳӳ٣̵߳
+	  
+	ֵԳӳ٣λΪ룬Ϊ0ʾεòԳ
+	************************************************************************/
+	unsigned int getHedgeDelay();
+
+	/************************************************************************
+	  ܣȡʹõͨ
+	  
+	ֵָͨ룬ΪNULLʾʹõڵͨ
+	************************************************************************/
+	RpcChannel *getHedgeChannel();
+
+	/************************************************************************
+	  ܣ¼һӦӳ٣̵߳
+	  
+		latencyMs룬Ӧӳ٣λΪ
+	ֵ
+	************************************************************************/
+	void recordLatency(uint64_t latencyMs);
+
+	/************************************************************************
+	  ܣȡͳ
+	  
+		statͳ
+	ֵ
+	************************************************************************/
+	void getStat(HedgeStat &stat);
+
+	//ʹô˲Եĵ
+	std::atomic<unsigned long long> m_callCount;
+	//ĶԳ
+	std::atomic<unsigned long long> m_hedgeCount;
+	//ԳԭɹصĴ
+	std::atomic<unsigned long long> m_hedgeWinCount;
+	//ʧܺ󷢳
+	std::atomic<unsigned long long> m_retryCount;
+
+private:
+	/************************************************************************
+	  ܣȡӳڵͰ
+	  
+		latencyMs룬ӳ٣λΪ
+	ֵͰ±
+	************************************************************************/
+	static unsigned int getBucket(uint64_t latencyMs);
+
+	/************************************************************************
+	  ܣȡͰӳϽ
+	  
+		bucket룬Ͱ±
+	ֵӳϽ磬λΪ
+	************************************************************************/
+	static unsigned int getBucketUpper(unsigned int bucket);
+
+	//̶ĶԳӳ٣Ϊ0ʾp95Ӧ
+	std::atomic<unsigned int> m_fixedDelayMs;
+	//ʹõͨ
+	std::atomic<RpcChannel *> m_pHedgeChannel;
+	//ֱͼ
+	boost::mutex m_mutex;
+	//ӳֱͼ
+	unsigned int m_arrBucket[HEDGE_LATENCY_BUCKETS];
+	//ֱͼе
+	unsigned int m_sampleCount;
+	//ϴμp95¼
+	unsigned int m_sinceUpdate;
+	//ӦĶԳӳ٣ʱΪ0
+	std::atomic<unsigned int> m_adaptiveDelayMs;
+};
+
+//һζԳõĹ״̬ԭͱ󣨸һCallͬ
+//1һɹѽûĽԣ
+//2ʧʱһʧܵʧܽû
+//3ڲͬIOWorker߳Ͻ״̬һʱ١
+struct HedgeGroup
+{
+	HedgeGroup();
+
+	/************************************************************************
+	  ܣһʱǷѽû
+	  
+		bSuccess룬Ƿɹ
+		bHedgeLeg룬ǷǶԳ
+		bRetryǷҪҪʱѼ;
+	ֵ
+		trueɱѽû
+		falseԱĽ
+	************************************************************************/
+	bool claim(bool bSuccess, bool bHedgeLeg, bool &bRetry);
+
+	/************************************************************************
+	  ܣԳӳٵʱǷ񷢳Գ
+	  
+	ֵ
+		trueҪԳѼ;
+		falseѽûѷڶ
+	************************************************************************/
+	bool startHedge();
+
+	/************************************************************************
+	  ܣڶ󷢳ʧʱ;
+	  
+	ֵ
+		trueû;ҽδûҪʧ
+		falseҪ
+	************************************************************************/
+	bool abortLeg();
+
+	/************************************************************************
+	  ܣͷһãһͷʱ
+	  
+	ֵ
+	************************************************************************/
+	void release();
+
+	//״̬
+	boost::mutex mutex;
+	//Ƿѽû
+	bool bDelivered;
+	//Ƿѷڶ
+	bool bSecondLegSent;
+	//;
+	int pendingLegs;
+	//ÿһ
+	std::atomic<int> refCount;
+
+	//Գ
+	HedgePolicy *pPolicy;
+	//ڵͨԺδָԳͨʱĶԳʹ
+	RpcChannel *pChannel;
+	//лݣڶʹ
+	string strReq;
+	//õķָ
+	const google::protobuf::ServiceDescriptor *pServiceDescriptor;
+	//õķ±
+	uint32_t methodIndex;
+	//õĽֹʱ䣬Ϊ0ʾʱ
+	uint64_t deadlineMs;
+	//ûӦMessageָ
+	google::protobuf::Message *pRespMessage;
+	//ûClosureָ
+	google::protobuf::Closure *pClosure;
+	//ûRpcControllerָ
+	google::protobuf::RpcController *pController;
+	//ͬõĵȴָ
+	SyncWaiter *pWaiter;
+};
+
+#endif
@@ -1,25 +1,40 @@
 #include "IOWorker.h"
+#include "RpcChannel.h"
+#include "Hedge.h"
+#include "Compressor.h"
+#include <climits>
+#include <boost/chrono.hpp>
 
-IOWorker::IOWorker(evutil_socket_t *fds, unsigned int queueMaxSize, timeval heartbeatInterval)
+IOWorker::IOWorker(unsigned int queueMaxSize, timeval heartbeatInterval, unsigned int corkUsec, unsigned int maxResponseSize)
+	: m_callTimerWheel(getNowMs() / CALL_TIMER_TICK_MS), m_cancelTable(MAX_PENDING_CALL)
 {
-	m_notified_fd = fds[0];
-	m_notify_fd = fds[1];
+	m_bEndNotified.store(false);
 	m_pEvBase = NULL;
 	m_heartbeatInterval = heartbeatInterval;
+	m_corkInterval.tv_sec = corkUsec / 1000000;
+	m_corkInterval.tv_usec = corkUsec % 1000000;
+	m_pCorkEv = NULL;
+	m_pCallTimerEv = NULL;
+	m_callTimerInterval.tv_sec = CALL_TIMER_TICK_MS / 1000;
+	m_callTimerInterval.tv_usec = (CALL_TIMER_TICK_MS % 1000) * 1000;
+	m_connNum.store(0);
+	m_pInflateBuf = evbuffer_new();
+	m_maxResponseSize = (0 == maxResponseSize) ? INT_MAX : maxResponseSize;
 	m_bStarted = false;
 	m_bEnded = false;
 	m_queue.setMaxSize(queueMaxSize);
+	m_callQueue.setMaxSize(queueMaxSize);
 }
 
 IOWorker::~IOWorker()
 {
 	//֪ͨIOWorker¼ѭ
-	char buf[1] = { NOTIFY_IOWORKER_END };
-	send(m_notify_fd, buf, 1, 0);
+	m_bEndNotified.store(true);
+	m_notifier.notify();
 	//ȴ߳̽
 	m_thd.join();
-	//رsocketpairĶ
-	evutil_closesocket(m_notified_fd);
+	if (NULL != m_pInflateBuf)
+		evbuffer_free(m_pInflateBuf);
 }
 
 void IOWorker::start()
@@ -30,36 +45,58 @@ void IOWorker::start()
 	m_bStarted = true;
 
 	//߳
-	m_thd = std::move(boost::thread(&IOWorker::threadMain, this, m_notified_fd));
+	m_thd = std::move(boost::thread(&IOWorker::threadMain, this));
 }
 
-void IOWorker::threadMain(evutil_socket_t notified_fd)
+void IOWorker::threadMain()
 {
-	//event_base
-	event_base *pEvBase = event_base_new();
-	if (NULL == pEvBase)
-	{
-		evutil_closesocket(notified_fd);
+	if (!m_notifier.isValid())
 		return;
+	//event_baseдϲ΢뼶ģҪȷʱepollȡ
+	event_base *pEvBase = NULL;
+	if (m_corkInterval.tv_sec > 0 || m_corkInterval.tv_usec > 0)
+	{
+		event_config *pEvConfig = event_config_new();
+		if (NULL == pEvConfig)
+			return;
+		event_config_set_flag(pEvConfig, EVENT_BASE_FLAG_PRECISE_TIMER);
+		pEvBase = event_base_new_with_config(pEvConfig);
+		event_config_free(pEvConfig);
 	}
-	//event_baseָ󶨣ôevent_baseԶٲͷԴ
-	unique_ptr<event_base, function<void(event_base *)> > ptrEvBase(pEvBase, [&notified_fd](event_base *p) {
-		event_base_free(p);
-		//رsocketpairĶ
-		evutil_closesocket(notified_fd);
-	});
+	else
+		pEvBase = event_base_new();
+	if (NULL == pEvBase)
+		return;
+	//event_baseָ󶨣ôevent_baseԶ
+	unique_ptr<event_base, function<void(event_base *)> > ptrEvBase(pEvBase, event_base_free);
 
-	//socketpairĶϵĿɶ¼
-	event *pNotifiedEv = event_new(pEvBase, notified_fd, EV_READ | EV_PERSIST, notifiedCallback, this);
+	//֪ͨϵĿɶ¼
+	event *pNotifiedEv = event_new(pEvBase, m_notifier.getFd(), EV_READ | EV_PERSIST, notifiedCallback, this);
 	if (NULL == pNotifiedEv)
 		return;
 	//¼ָ󶨣ô¼Զ
 	unique_ptr<event, function<void(event *)> > ptrNotifiedEv(pNotifiedEv, event_free);
 
-	//socketpairĶϵĿɶ¼Ϊδ
+	//֪ͨϵĿɶ¼Ϊδ
 	if (0 != event_add(pNotifiedEv, NULL))
 		return;
 
+	//дϲڵĶʱ¼
+	unique_ptr<event, function<void(event *)> > ptrCorkEv;
+	if (m_corkInterval.tv_sec > 0 || m_corkInterval.tv_usec > 0)
+	{
+		m_pCorkEv = evtimer_new(pEvBase, corkCallback, this);
+		if (NULL == m_pCorkEv)
+			return;
+		ptrCorkEv = unique_ptr<event, function<void(event *)> >(m_pCorkEv, event_free);
+	}
+
+	//óʱĶʱ¼ÿIOWorkerֻһΪÿô¼
+	m_pCallTimerEv = event_new(pEvBase, -1, EV_PERSIST, callTimerCallback, this);
+	if (NULL == m_pCallTimerEv)
+		return;
+	unique_ptr<event, function<void(event *)> > ptrCallTimerEv(m_pCallTimerEv, event_free);
+
 	m_pEvBase = pEvBase;
 	//¼ѭ
 	event_base_dispatch(pEvBase);
@@ -70,21 +107,24 @@ void notifiedCallback(evutil_socket_t fd, short events, void *pArg)
 	if (NULL == pArg)
 		return;
 
-	//ͨsocketpairĶȡ֪ͨ
-	char buf[1];
-	recv(fd, buf, 1, 0);
-	IOWorker *pWorker = (IOWorker *)pArg;
+	((IOWorker *)pArg)->handleNotified();
+}
 
-	if (NOTIFY_IOWORKER_IOTASK == buf[0])
-	{
-		pWorker->handleIOTask();
-	}
-	else if (NOTIFY_IOWORKER_END == buf[0])
-		pWorker->handleEnd();
+void IOWorker::handleNotified()
+{
+	//֪ͨٴдIOԱ֤©ϲ֪ͨ
+	m_notifier.consume();
+
+	handleIOTask();
+	if (m_bEndNotified.load())
+		handleEnd();
 }
 
 void IOWorker::handleIOTask()
 {
+	//ȡãȡIO񣺵ӵCONNECTһڵύ
+	//ȡĵõһڱIOлѼm_mapConn
+	Call *pCall = m_callQueue.takeAll();
 	//ΪһԴӶȡIO
 	list<IOTask> queue;
 	m_queue.takeAll(queue);
@@ -92,7 +132,12 @@ void IOWorker::handleIOTask()
 	{
 		if (IOTask::CONNECT == (*it).type)
 		{
-			connect((Conn *)(*it).pData);
+			Conn *pConn = (Conn *)(*it).pData;
+			if (NULL != pConn)
+			{
+				m_mapConn[pConn->connId] = pConn;
+				connect(pConn);
+			}
 		}
 		else if (IOTask::DISCONNECT == (*it).type)
 		{
@@ -103,9 +148,94 @@ void IOWorker::handleIOTask()
 				delete pConnId;
 			}
 		}
-		else if (IOTask::CALL == (*it).type)
-			handleCall((Call *)(*it).pData);
+		else if (IOTask::CANCEL == (*it).type)
+		{
+			uint32_t *pCancelId = (uint32_t *)(*it).pData;
+			if (NULL != pCancelId)
+			{
+				handleCancel(*pCancelId);
+				delete pCancelId;
+			}
+		}
+		else if (IOTask::STREAM_CREDIT == (*it).type)
+		{
+			StreamCredit *pCredit = (StreamCredit *)(*it).pData;
+			if (NULL != pCredit)
+			{
+				handleStreamCredit(*pCredit);
+				delete pCredit;
+			}
+		}
+		else if (IOTask::STREAM_FRAME == (*it).type)
+		{
+			StreamFrame *pFrame = (StreamFrame *)(*it).pData;
+			if (NULL != pFrame)
+			{
+				handleStreamFrameTask(*pFrame);
+				evbuffer_free(pFrame->pBuf);
+				delete pFrame;
+			}
+		}
+	}
+	//ύ˳ãhandleCall()ٵãȡһ
+	while (NULL != pCall)
+	{
+		Call *pNext = pCall->pNextSubmit;
+		pCall->pNextSubmit = NULL;
+		handleCall(pCall);
+		pCall = pNext;
+	}
+
+	schedulePending();
+}
+
+void IOWorker::schedulePending()
+{
+	if (m_vecPendingConnId.empty())
+		return;
+	//дϲʱдãȴڵںͬڵĵһд
+	if (NULL == m_pCorkEv)
+		flushPending();
+	else if (0 == evtimer_pending(m_pCorkEv, NULL))
+		evtimer_add(m_pCorkEv, &m_corkInterval);
+}
+
+void corkCallback(evutil_socket_t fd, short events, void *pArg)
+{
+	if (NULL == pArg)
+		return;
+
+	((IOWorker *)pArg)->flushPending();
+}
+
+void IOWorker::flushPending()
+{
+	for (auto it = m_vecPendingConnId.begin(); it != m_vecPendingConnId.end(); ++it)
+	{
+		auto itConn = m_mapConn.find(*it);
+		if (itConn == m_mapConn.end() || NULL == itConn->second)
+			continue;
+		Conn *pConn = itConn->second;
+		if (NULL == pConn->pBufEv || NULL == pConn->pPendingBuf)
+			continue;
+		evbuffer *pOutBuf = bufferevent_get_output(pConn->pBufEv);
+		if (NULL == pOutBuf)
+			continue;
+		//ֻƶڴ飬
+		evbuffer_add_buffer(pOutBuf, pConn->pPendingBuf);
 	}
+	m_vecPendingConnId.clear();
+}
+
+evbuffer *IOWorker::getOutputBuffer(Conn *pConn)
+{
+	if (NULL == pConn || NULL == pConn->pBufEv)
+		return NULL;
+	evbuffer *pOutBuf = bufferevent_get_output(pConn->pBufEv);
+	//ڴдбУڵʱǿevbuffer޷
+	if (NULL != pOutBuf && NULL != pConn->pPendingBuf && evbuffer_get_length(pConn->pPendingBuf) > 0)
+		evbuffer_add_buffer(pOutBuf, pConn->pPendingBuf);
+	return pOutBuf;
 }
 
 void IOWorker::handleDisconnect(unsigned int connId)
@@ -120,9 +250,18 @@ void IOWorker::handleDisconnect(unsigned int connId)
 	{
 		//ͷ
 		freeConn(pConn);
+		failWaitingCalls(pConn);
 		delete pConn;
 	}
 	m_mapConn.erase(it);
+	backConnId(connId);
+}
+
+void IOWorker::backConnId(unsigned int connId)
+{
+	boost::lock_guard<boost::mutex> lock(m_connIdMutex);
+	m_connIdGen.back(connId);
+	--m_connNum;
 }
 
 void IOWorker::handleCall(Call *pCall)
@@ -132,79 +271,116 @@ void IOWorker::handleCall(Call *pCall)
 
 	//m_mapConn
 	auto it = m_mapConn.find(pCall->connId);
-	if (it == m_mapConn.end())
+	if (it == m_mapConn.end() || NULL == it->second)
 	{
-		m_connIdGen.back(pCall->connId);
-		SAFE_DELETE(pCall)
+		failCall(pCall, "connection does not exist");
 		return;
 	}
 	Conn *pConn = it->second;
-	if (NULL == pConn)
+
+	//нֹʱĵ÷ŵʱϣȴӽʱҲ룻ѵڵĵһtickʱ
+	if (pCall->deadlineMs > 0 && !pCall->timerNode.isLinked())
 	{
-		m_connIdGen.back(pCall->connId);
-		m_mapConn.erase(it);
-		SAFE_DELETE(pCall)
-		return;
+		m_callTimerWheel.add(&pCall->timerNode, (pCall->deadlineMs + CALL_TIMER_TICK_MS - 1) / CALL_TIMER_TICK_MS);
+		if (NULL != m_pCallTimerEv && 0 == evtimer_pending(m_pCallTimerEv, NULL))
+			evtimer_add(m_pCallTimerEv, &m_callTimerInterval);
 	}
+
+	//ȡĵüȡȡidRpcControllerûҪȡʱֱӽ
+	if (NULL != pCall->pCancelController && !pCall->bCancelBound && m_cancelTable.insert(pCall, pCall->cancelId))
+	{
+		pCall->bCancelBound = true;
+		if (pCall->pCancelController->bindCancelId(pCall->cancelId))
+		{
+			pCall->pCancelController->setCallCanceled();
+			rpcCallback(pCall);
+			SAFE_DELETE(pCall)
+			return;
+		}
+	}
+
+	//ҪԳԭ󣬶ԳӳٵδʱԳ
+	if (pCall->hedgeDelayMs > 0 && !pCall->bHedgeLeg && !pCall->hedgeNode.isLinked())
+	{
+		m_callTimerWheel.add(&pCall->hedgeNode, (getNowMs() + pCall->hedgeDelayMs + CALL_TIMER_TICK_MS - 1) / CALL_TIMER_TICK_MS);
+		if (NULL != m_pCallTimerEv && 0 == evtimer_pending(m_pCallTimerEv, NULL))
+			evtimer_add(m_pCallTimerEv, &m_callTimerInterval);
+	}
+
 	if (!pConn->bConnected)
 	{
-		//δѶϿ½ָŻIO
-		IOTask task;
-		task.type = IOTask::CALL;
-		task.pData = pCall;
-		m_queue.put(task);
+		//δѶϿ÷ӵĵȴУӽٷ
+		pCall->itWaiting = pConn->listWaitingCall.insert(pConn->listWaitingCall.end(), pCall);
+		pCall->bWaiting = true;
 		return;
 	}
 	if (NULL == pConn->pBufEv)
 	{
-		SAFE_DELETE(pCall)
+		failCall(pCall, "connection lost");
 		return;
 	}
-	evbuffer *pOutBuf = bufferevent_get_output(pConn->pBufEv);
+	//ض꣬еڵȴȣȴУֵϵ˳
+	if (pConn->bCreditLimited && (pConn->credit <= 0 || !pConn->listWaitingCall.empty()))
+	{
+		pCall->itWaiting = pConn->listWaitingCall.insert(pConn->listWaitingCall.end(), pCall);
+		pCall->bWaiting = true;
+		return;
+	}
+	//дӵĴдevbufferôһд
+	evbuffer *pOutBuf = pConn->pPendingBuf;
 	if (NULL == pOutBuf)
 	{
-		SAFE_DELETE(pCall)
+		failCall(pCall, "connection lost");
 		return;
 	}
+	//ڵñзλλ±ʹɵid
 	callId_t callId;
-	if (!pConn->idGen.generate(callId))
+	if (!pConn->callTable.insert(pCall, callId))
 	{
-		//ôϢidԴ㣬Ȼ󷵻û
-		pCall->pController->SetFailed("call id not enough");
-		rpcCallback(pCall->pClosure, pCall->sync_write_fd);
-		SAFE_DELETE(pCall)
+		//;ù࣬ñ
+		failCall(pCall, "call id not enough");
 		return;
 	}
+	pCall->callId = callId;
+	//ʽõ󷢳󣬿ͻܹ黹ȡϢ
+	if (NULL != pCall->pStream)
+		pCall->pStream->bind(pConn->connId, callId, pConn->version, streamCreditCallback, streamFrameCallback, this);
 	
-	//Эbody
-	ProtocolBodyRequest bodyReq;
-	bodyReq.set_callid(callId);
-	bodyReq.set_servicename(pCall->serviceName);
-	bodyReq.set_methodindex(pCall->methodIndex);
-	bodyReq.set_content(*pCall->pStrReq);
-	//лЭbody
-	string strBuf;
-	if (!bodyReq.SerializeToString(&strBuf))
-	{
-		//ôϢлʧܣȻ󷵻û
-		pCall->pController->SetFailed("request serialized failed");
-		rpcCallback(pCall->pClosure, pCall->sync_write_fd);
-		SAFE_DELETE(pCall)
-		return;
+	//ҷڱϵıţ״εø÷ʱţͬʱϷ÷˰󶨱
+	//˻صֻľɸʽ
+	uint32_t serviceId = 0;
+	bool bBind = false;
+	auto itServiceId = pConn->mapServiceId.find(pCall->pServiceDescriptor);
+	if (itServiceId != pConn->mapServiceId.end())
+		serviceId = itServiceId->second;
+	else if (pConn->mapServiceId.size() < MAX_SERVICE_ID)
+	{
+		serviceId = pConn->mapServiceId.size() + 1;
+		pConn->mapServiceId[pCall->pServiceDescriptor] = serviceId;
+		bBind = true;
 	}
-	bodySize_t bodyLen = strBuf.size();
-	unsigned char arr[HEAD_SIZE] = {0};
-	arr[0] = DATA_TYPE_REQUEST;
-	//Ҫעֽ򣬷ֹͨŶԶ˽δֽ
-	memcpy(arr + 1, &bodyLen, HEAD_SIZE - 1);
 
-	//Эheadevbuffer
-	evbuffer_add(pOutBuf, arr, HEAD_SIZE);
-	//лЭbodyevbuffer
-	evbuffer_add(pOutBuf, strBuf.c_str(), bodyLen);
+	//еһдʱ¼id
+	bool bFirstWrite = (0 == evbuffer_get_length(pOutBuf));
+	//ЭheadЭbodyֱӱ뵽дevbufferл룬мַ
+	//headЭ̵Э汾룬v2bodyΪvarintֽ޹
+	if (!ProtocolCodec::encodeRequest(pOutBuf, callId, (0 == serviceId || bBind) ? &pCall->pServiceDescriptor->full_name() : NULL,
+		serviceId, pCall->methodIndex, pCall->pReqBuf, pCall->streamWindow, pCall->clientStreamWindow, pConn->version))
+	{
+		//ʧܣûյ󶨣ηı
+		if (bBind)
+			pConn->mapServiceId.erase(pCall->pServiceDescriptor);
+		pConn->callTable.remove(callId);
+		failCall(pCall, "request serialized failed");
+		return;
+	}
+	if (bFirstWrite)
+		m_vecPendingConnId.push_back(pConn->connId);
+	--(pConn->credit);
 
-	SAFE_DELETE(pCall->pStrReq)
-	pConn->mapCall[callId] = pCall;
+	//¼ʱ䣬ԳԾݴͳӦӳ
+	if (NULL != pCall->pGroup)
+		pCall->sendMs = getNowMs();
 }
 
 void IOWorker::handleEnd()
@@ -221,10 +397,10 @@ void IOWorker::handleEnd()
 	//ͷ
 	for (auto it = m_mapConn.begin(); it != m_mapConn.end(); ++it)
 	{
-		unsigned int connId = it->first;
-		m_connIdGen.back(connId);
 		freeConn(it->second);
+		failWaitingCalls(it->second);
 		SAFE_DELETE(it->second)
+		backConnId(it->first);
 	}
 	m_mapConn.clear();
 }
@@ -259,70 +435,303 @@ void IOWorker::handleRead(Conn *pConn)
 	{
 		if (PROTOCOL_HEAD == pConn->inState)
 		{
-			//ȡevbuffer
-			if (evbuffer_get_length(pInBuf) < HEAD_SIZE)
+			//Эheadܷɢڲڴ飬ջϽ룬evbuffer_pullup()ԻҲδָת
+			FrameHead head;
+			HEAD_DECODE_RESULT result = ProtocolCodec::peekHead(pInBuf, head);
+			if (HEAD_DECODE_MORE == result)
 				break;
-			//evbufferеݿܷɢڲڴ飬Ҫȡֽ飬evbuffer_pullup()СԻ
-			//ȡЭheadֽ
-			unsigned char *pArr = evbuffer_pullup(pInBuf, HEAD_SIZE);
-			if (NULL == pArr)
+			//headЧʱ޷磬ֻ
+			if (HEAD_DECODE_INVALID == result)
+			{
+				connect(pConn);
+				return;
+			}
+			//չheadһƳݲʹе
+			size_t prefixSize = head.headSize + head.extSize;
+			if (evbuffer_get_length(pInBuf) < prefixSize)
 				break;
-			//Эhead2-5ֽתЭbody
-			pConn->inBodySize = *((bodySize_t *)(pArr + 1));
-			//ͨЭhead1ֽж
-			//ΪPONGevbufferƳЭ
-			if (DATA_TYPE_HEARTBEAT_PONG == pArr[0])
-				evbuffer_drain(pInBuf, HEAD_SIZE + pConn->inBodySize);
-			//Ϊͣһ󣩣ȡЭbody
+			pConn->inBodySize = head.bodySize;
+			//ΪPONGЭݵ󣬴evbufferƳЭ
+			if (DATA_TYPE_HEARTBEAT_PONG == head.dataType)
+			{
+				if (evbuffer_get_length(pInBuf) < prefixSize + pConn->inBodySize)
+					break;
+				evbuffer_drain(pInBuf, prefixSize + pConn->inBodySize);
+			}
+			//ΪضȣЭݵۼӶȣ˺ܶ
+			else if (DATA_TYPE_CREDIT == head.dataType)
+			{
+				if (evbuffer_get_length(pInBuf) < prefixSize + pConn->inBodySize)
+					break;
+				evbuffer_drain(pInBuf, prefixSize);
+				credit_t credit = 0;
+				if (pConn->inBodySize >= sizeof(credit))
+				{
+					unsigned char arr[sizeof(credit)];
+					evbuffer_copyout(pInBuf, arr, sizeof(arr));
+					google::protobuf::io::CodedInputStream::ReadLittleEndian32FromArray(arr, &credit);
+				}
+				evbuffer_drain(pInBuf, pConn->inBodySize);
+				pConn->credit += credit;
+				pConn->bCreditLimited = true;
+			}
+			//Ϊ汾Э̣Эݵ󣬴˺Էѡİ汾
+			else if (DATA_TYPE_VERSION == head.dataType)
+			{
+				if (evbuffer_get_length(pInBuf) < prefixSize + pConn->inBodySize)
+					break;
+				evbuffer_drain(pInBuf, prefixSize);
+				unsigned char version = PROTOCOL_V1;
+				if (pConn->inBodySize >= 1)
+					evbuffer_remove(pInBuf, &version, 1);
+				evbuffer_drain(pInBuf, (pConn->inBodySize >= 1) ? pConn->inBodySize - 1 : 0);
+				pConn->version = std::max((unsigned char)PROTOCOL_V1, std::min(version, (unsigned char)PROTOCOL_MAX_VERSION));
+			}
+			//ΪȣЭݵ󣬰ѷĶȽͻʽõ
+			else if (DATA_TYPE_STREAM_CREDIT == head.dataType)
+			{
+				if (evbuffer_get_length(pInBuf) < prefixSize + pConn->inBodySize)
+					break;
+				evbuffer_drain(pInBuf, prefixSize);
+				if (pConn->inBodySize >= sizeof(callId_t) + sizeof(credit_t))
+				{
+					unsigned char arr[sizeof(callId_t) + sizeof(credit_t)];
+					evbuffer_copyout(pInBuf, arr, sizeof(arr));
+					callId_t callId;
+					credit_t credit;
+					google::protobuf::io::CodedInputStream::ReadLittleEndian32FromArray(arr, &callId);
+					google::protobuf::io::CodedInputStream::ReadLittleEndian32FromArray(arr + sizeof(callId), &credit);
+					//ѽʱҲãֱӶ
+					Call *pCall = pConn->callTable.find(callId);
+					if (NULL != pCall && NULL != pCall->pStream)
+						pCall->pStream->grant(credit);
+				}
+				evbuffer_drain(pInBuf, pConn->inBodySize);
+			}
+			//ΪͣӦʽӦ֡ƬȡЭbody4λΪbodyѹ㷨
 			else
 			{
-				evbuffer_drain(pInBuf, HEAD_SIZE);
+				pConn->inDataType = head.dataType;
+				pConn->inCompressType = head.compressType;
+				pConn->bInFragmentHead = false;
+				//bodyӦȣѹbodyԭĶ̣ѹ󳬹ĽѹȻbody
+				pConn->bInOversize = (DATA_TYPE_FRAGMENT != head.dataType && head.bodySize > m_maxResponseSize);
+				pConn->bInOversizeFailed = false;
+				evbuffer_drain(pInBuf, prefixSize);
 				pConn->inState = PROTOCOL_BODY;
 			}
 		}
 		else if (PROTOCOL_BODY == pConn->inState)
 		{
-			//ȡevbuffer
-			if (evbuffer_get_length(pInBuf) < pConn->inBodySize)
-				break;
-
-			unsigned char *pArr = evbuffer_pullup(pInBuf, HEAD_SIZE);
-			if (NULL != pArr)
+			//ƬݵＴevbufferӦǰ󵽴СӦճ
+			if (DATA_TYPE_FRAGMENT == pConn->inDataType)
 			{
-				//лӦЭbody
-				ProtocolBodyResponse bodyResp;
-				if (!bodyResp.ParseFromArray(pArr, pConn->inBodySize))
+				bool bDone = handleFragment(pConn, pInBuf);
+				//ͬʱδķƬid࣬쳣ֻ
+				if (pConn->mapFragment.size() > MAX_OPEN_FRAGMENT)
 				{
-					evbuffer_drain(pInBuf, pConn->inBodySize);
-					pConn->inState = PROTOCOL_HEAD;
-					continue;
+					connect(pConn);
+					return;
 				}
-				//ͨidҵָ
-				auto it = pConn->mapCall.find(bodyResp.callid());
-				if (it != pConn->mapCall.end())
+				if (!bDone)
+					break;
+			}
+			//Ӧȵbody棬ͷʧܽãಿֵＴſ
+			else if (pConn->bInOversize)
+			{
+				size_t len = evbuffer_get_length(pInBuf);
+				if (!pConn->bInOversizeFailed)
 				{
-					Call *pCall = it->second;
-					if (NULL != pCall)
-					{
-						google::protobuf::Message *pRespMessage = pCall->pRespMessage;
-						if (NULL != pRespMessage)
-						{
-							//лӦû
-							if (pRespMessage->ParseFromString(bodyResp.content()))
-								rpcCallback(pCall->pClosure, pCall->sync_write_fd);
-						}
-						pConn->idGen.back(pCall->callId);
-						pConn->mapCall.erase(it);
-						SAFE_DELETE(pCall)
-					}
+					if (len < oversizePeekSize(pConn->inCompressType, pConn->inBodySize))
+						break;
+					failOversizeCall(pConn, pInBuf, pConn->inDataType, pConn->inCompressType, pConn->inBodySize);
+					pConn->bInOversizeFailed = true;
 				}
+				size_t size = std::min(len, (size_t)pConn->inBodySize);
+				evbuffer_drain(pInBuf, size);
+				pConn->inBodySize -= size;
+				if (pConn->inBodySize > 0)
+					break;
+			}
+			else
+			{
+				//ȡevbuffer
+				if (evbuffer_get_length(pInBuf) < pConn->inBodySize)
+					break;
+				handleFrame(pConn, pInBuf, pConn->inDataType, pConn->inCompressType, pConn->inBodySize);
 			}
-			evbuffer_drain(pInBuf, pConn->inBodySize);
 			pConn->inState = PROTOCOL_HEAD;
 		}
 		else
 			break;
 	}
+
+	//˶ȣȴȵĵ
+	if (pConn->bCreditLimited && pConn->credit > 0 && !pConn->listWaitingCall.empty() && pConn->bConnected)
+	{
+		sendWaitingCalls(pConn);
+		schedulePending();
+	}
+}
+
+void IOWorker::handleFrame(Conn *pConn, evbuffer *pBuf, unsigned char dataType, unsigned char compressType, size_t bodySize)
+{
+	//Эbodyܷɢڶڴ飬Իbody
+	//ѹbodyevbufferڴʽѹõevbufferУѹһλһڴ棬Իٿ
+	unsigned char *pArr = NULL;
+	//ѹЭbody
+	size_t plainSize = 0;
+	//Ӧȵbodyɵǰ
+	if (COMPRESS_NONE == compressType)
+	{
+		pArr = evbuffer_pullup(pBuf, bodySize);
+		plainSize = bodySize;
+	}
+	else if (NULL != m_pInflateBuf)
+	{
+		if (Compressor::decompress(compressType, pBuf, 0, bodySize, m_pInflateBuf, m_maxResponseSize))
+		{
+			plainSize = evbuffer_get_length(m_pInflateBuf);
+			pArr = evbuffer_pullup(m_pInflateBuf, -1);
+		}
+		//ѹĿͷֺеid
+		else
+			failUndecodedCall(pConn, m_pInflateBuf, "response too large or decompressed failed");
+	}
+	//ʽӦֻ֡ENDERROR൱Ӧ黹Ӷ
+	bool bReturnCredit = true;
+	if (DATA_TYPE_STREAM == dataType)
+		bReturnCredit = (NULL != pArr) && handleStreamFrame(pConn, pArr, plainSize);
+	//лӦЭbody
+	ProtocolBodyResponse bodyResp;
+	if (DATA_TYPE_STREAM != dataType && NULL != pArr && bodyResp.ParseFromArray(pArr, (int)plainSize))
+	{
+		//ͨidҵָ벢ͷŲλλĹӦҲãֱӶ
+		Call *pCall = pConn->callTable.remove(bodyResp.callid());
+		//Գ󷵻ʱӦдûӦMessage
+		if (NULL != pCall && !claimCall(pCall, true))
+			dropCall(pCall);
+		//ʵ˴󣬷ش𣬵Ըôʧܣ
+		else if (NULL != pCall && bodyResp.has_error())
+		{
+			if (NULL != pCall->pController)
+				pCall->pController->SetFailed(bodyResp.error());
+			rpcCallback(pCall);
+			SAFE_DELETE(pCall)
+		}
+		//֧ʽõķظ˷ʽõͨӦΪΨһϢ
+		else if (NULL != pCall && NULL != pCall->pStream && pCall->streamWindow > 0)
+		{
+			pCall->pStream->push(bodyResp.mutable_content());
+			rpcCallback(pCall);
+			SAFE_DELETE(pCall)
+		}
+		else if (NULL != pCall)
+		{
+			//лӦûãͻʽõӦҲһ
+			google::protobuf::Message *pRespMessage = pCall->pRespMessage;
+			if (NULL != pRespMessage && pRespMessage->ParseFromString(bodyResp.content()))
+			{
+				rpcCallback(pCall);
+				SAFE_DELETE(pCall)
+			}
+			else
+			{
+				//Գɱ죬پfailCall()
+				if (NULL != pCall->pController)
+					pCall->pController->SetFailed("response parsed failed");
+				rpcCallback(pCall);
+				SAFE_DELETE(pCall)
+			}
+		}
+	}
+	if (NULL != m_pInflateBuf)
+		evbuffer_drain(m_pInflateBuf, evbuffer_get_length(m_pInflateBuf));
+	evbuffer_drain(pBuf, bodySize);
+	//ÿӦ黹1ȣѳʱȡĹӦҲһ
+	if (bReturnCredit)
+		++(pConn->credit);
+}
+
+bool IOWorker::handleFragment(Conn *pConn, evbuffer *pBuf)
+{
+	//ȶƬͷƬid + 
+	if (!pConn->bInFragmentHead)
+	{
+		if (pConn->inBodySize < FRAGMENT_HEAD_SIZE)
+		{
+			if (evbuffer_get_length(pBuf) < pConn->inBodySize)
+				return false;
+			evbuffer_drain(pBuf, pConn->inBodySize);
+			return true;
+		}
+		if (evbuffer_get_length(pBuf) < FRAGMENT_HEAD_SIZE)
+			return false;
+		unsigned char arr[FRAGMENT_HEAD_SIZE];
+		evbuffer_remove(pBuf, arr, FRAGMENT_HEAD_SIZE);
+		google::protobuf::io::CodedInputStream::ReadLittleEndian32FromArray(arr, &pConn->inFragmentId);
+		pConn->bInFragmentLast = (0 != arr[sizeof(fragmentId_t)]);
+		pConn->inBodySize -= FRAGMENT_HEAD_SIZE;
+		pConn->bInFragmentHead = true;
+	}
+
+	//ѵķƬݵڴevbufferӵevbuffer漴ԴЭ
+	size_t size = std::min(evbuffer_get_length(pBuf), (size_t)pConn->inBodySize);
+	auto it = pConn->mapFragment.find(pConn->inFragmentId);
+	if (it == pConn->mapFragment.end())
+		it = pConn->mapFragment.insert(std::make_pair(pConn->inFragmentId, evbuffer_new())).first;
+	//ѶķƬidevbufferʧܵģƬݵＴſ
+	if (NULL == it->second)
+		evbuffer_drain(pBuf, size);
+	else
+	{
+		evbuffer *pFrames = it->second;
+		evbuffer_remove_buffer(pBuf, pFrames, size);
+		//evbufferͬһõһЭݣһһֻδһ
+		bool bDrop = false;
+		FrameHead head;
+		HEAD_DECODE_RESULT result;
+		while (HEAD_DECODE_OK == (result = ProtocolCodec::peekHead(pFrames, head)))
+		{
+			size_t prefixSize = head.headSize + head.extSize;
+			size_t len = evbuffer_get_length(pFrames);
+			//bodyӦȣѹbodyԭĶ̣ѹ󳬹ĽѹȻ룬
+			//ͷʧܽã÷Ƭid
+			if (head.bodySize > m_maxResponseSize)
+			{
+				if (len >= prefixSize + oversizePeekSize(head.compressType, head.bodySize))
+				{
+					evbuffer_drain(pFrames, prefixSize);
+					failOversizeCall(pConn, pFrames, head.dataType, head.compressType, head.bodySize);
+					bDrop = true;
+				}
+				break;
+			}
+			if (len < prefixSize + head.bodySize)
+				break;
+			evbuffer_drain(pFrames, prefixSize);
+			handleFrame(pConn, pFrames, head.dataType, head.compressType, head.bodySize);
+		}
+		//޷磬ķƬҲ޷
+		if (bDrop || HEAD_DECODE_INVALID == result)
+		{
+			evbuffer_free(pFrames);
+			it->second = NULL;
+		}
+	}
+	pConn->inBodySize -= size;
+	if (pConn->inBodySize > 0)
+		return false;
+
+	//һƬѴ꣬δЭݲк
+	pConn->bInFragmentHead = false;
+	if (pConn->bInFragmentLast)
+	{
+		if (NULL != it->second)
+			evbuffer_free(it->second);
+		pConn->mapFragment.erase(it);
+	}
+	return true;
 }
 
 void eventCallback(bufferevent *pBufEv, short events, void *pArg)
@@ -336,8 +745,10 @@ void eventCallback(bufferevent *pBufEv, short events, void *pArg)
 			bufferevent_free(pConn->pBufEv);
 			pConn->pBufEv = NULL;
 		}
-		for (auto it = pConn->mapCall.begin(); it != pConn->mapCall.end(); ++it)
-			SAFE_DELETE(it->second)
+		vector<Call *> vecCall;
+		pConn->callTable.removeAll(vecCall);
+		for (auto it = vecCall.begin(); it != vecCall.end(); ++it)
+			SAFE_DELETE(*it)
 		delete pConn;
 	};
 
@@ -373,7 +784,36 @@ void IOWorker::handleConnected(Conn *pConn)
 	if (NULL != pConn->pBufEv && m_heartbeatInterval.tv_sec >= 0)
 		bufferevent_set_timeouts(pConn->pBufEv, &m_heartbeatInterval, NULL);
 
-	//֮ǰδIO
+	//߷ͻ֧أظǰ
+	evbuffer *pOutBuf = getOutputBuffer(pConn);
+	if (NULL != pOutBuf)
+	{
+		//Э̳汾֮ǰv1 head
+		unsigned char arr[HEAD_MAX_SIZE + 1];
+		evbuffer_add(pOutBuf, arr, ProtocolCodec::encodeHead(arr, pConn->version, DATA_TYPE_CREDIT, COMPRESS_NONE, 0));
+
+		//߷ͻƬݴ˷ƬʹӦ
+		evbuffer_add(pOutBuf, arr, ProtocolCodec::encodeHead(arr, pConn->version, DATA_TYPE_FRAGMENT, COMPRESS_NONE, 0));
+
+		//߷ͻֵ֧Э汾ظǰv1
+		size_t headSize = ProtocolCodec::encodeHead(arr, pConn->version, DATA_TYPE_VERSION, COMPRESS_NONE, 1);
+		arr[headSize] = PROTOCOL_MAX_VERSION;
+		evbuffer_add(pOutBuf, arr, headSize + 1);
+
+		//߷ͻܽѹ㷨ݴѹӦ
+		unsigned char arrType[MAX_COMPRESS_TYPE_NUM];
+		bodySize_t typeNum = Compressor::getSupportedTypes(arrType);
+		if (typeNum > 0)
+		{
+			evbuffer_add(pOutBuf, arr, ProtocolCodec::encodeHead(arr, pConn->version, DATA_TYPE_COMPRESS, COMPRESS_NONE, typeNum));
+			evbuffer_add(pOutBuf, arrType, typeNum);
+		}
+	}
+
+	//˳򷢳ȴӽĵ
+	sendWaitingCalls(pConn);
+
+	//֮ǰδIO񣬲дϵĵ
 	handleIOTask();
 }
 
@@ -387,15 +827,15 @@ void IOWorker::handleTimeout(Conn *pConn)
 	
 	if (pConn->bConnected && !pConn->bConnectionMightLost)
 	{
-		//ȡbuffereventеevbufferָ
-		evbuffer *pOutBuf = bufferevent_get_output(pBufEv);
+		//ȡevbufferָ
+		evbuffer *pOutBuf = getOutputBuffer(pConn);
 		if (NULL != pOutBuf)
 		{
 			//PINGЭheadЭbodyΪ0
-			unsigned char arr[HEAD_SIZE] = {0};
-			arr[0] = DATA_TYPE_HEARTBEAT_PING;
+			unsigned char arr[HEAD_MAX_SIZE];
+			size_t headSize = ProtocolCodec::encodeHead(arr, pConn->version, DATA_TYPE_HEARTBEAT_PING, COMPRESS_NONE, 0);
 			//ЭݷŽevbuffer
-			evbuffer_add(pOutBuf, arr, sizeof(arr));
+			evbuffer_add(pOutBuf, arr, headSize);
 
 			cout << "IO thread " << boost::this_thread::get_id() << " finishes sending PING heartbeat." << endl;
 		}
@@ -448,46 +888,440 @@ void IOWorker::freeConn(Conn *pConn)
 		bufferevent_free(pConn->pBufEv);
 		pConn->pBufEv = NULL;
 	}
-	//ϵе
-	for (auto it = pConn->mapCall.begin(); it != pConn->mapCall.end(); ++it)
+	//δдЩʧܽ
+	if (NULL != pConn->pPendingBuf)
+		evbuffer_drain(pConn->pPendingBuf, evbuffer_get_length(pConn->pPendingBuf));
+	//ʧܽϵеãͬõ߳һֱȴ
+	vector<Call *> vecCall;
+	pConn->callTable.removeAll(vecCall);
+	for (auto it = vecCall.begin(); it != vecCall.end(); ++it)
+		failCall(*it, "connection lost");
+	//ϷûаϢҪ°
+	pConn->mapServiceId.clear();
+	//ϵضɷ
+	pConn->credit = 0;
+	pConn->bCreditLimited = false;
+	//δķƬͶһЭݲк
+	for (auto it = pConn->mapFragment.begin(); it != pConn->mapFragment.end(); ++it)
 	{
-		callId_t callId = it->first;
-		pConn->idGen.back(callId);
-		SAFE_DELETE(it->second)
+		if (NULL != it->second)
+			evbuffer_free(it->second);
 	}
-	pConn->mapCall.clear();
+	pConn->mapFragment.clear();
+	pConn->inState = PROTOCOL_HEAD;
+	//ЭЭ汾
+	pConn->version = PROTOCOL_V1;
 }
 
 unsigned int IOWorker::getBusyLevel()
 {
-	return m_mapConn.size();
+	return m_connNum.load();
 }
 
 Conn *IOWorker::genConn()
 {
 	unsigned int connId;
-	if (!m_connIdGen.generate(connId))
-		return NULL;
+	{
+		boost::lock_guard<boost::mutex> lock(m_connIdMutex);
+		if (!m_connIdGen.generate(connId))
+			return NULL;
+		++m_connNum;
+	}
 	Conn *pConn = new Conn();
 	pConn->connId = connId;
-	m_mapConn[connId] = pConn;
 	return pConn;
 }
 
-evutil_socket_t IOWorker::getNotify_fd()
+void IOWorker::notify()
 {
-	return m_notify_fd;
+	m_notifier.notify();
 }
 
-void IOWorker::rpcCallback(google::protobuf::Closure *pClosure, evutil_socket_t sync_write_fd)
+void IOWorker::rpcCallback(Call *pCall)
 {
-	if (NULL != pClosure)
+	//ȼ;û̱߳Ѻһεܿ׼ȷֵ
+	if (NULL != pCall->pOutstanding)
+		--(*pCall->pOutstanding);
+	//ѽҪʱͶԳ
+	m_callTimerWheel.remove(&pCall->timerNode);
+	m_callTimerWheel.remove(&pCall->hedgeNode);
+	//ܱȡڷû֮ǰ֮RpcControllerܱ
+	if (pCall->bCancelBound)
+	{
+		m_cancelTable.remove(pCall->cancelId);
+		pCall->pCancelController->unbindCancelId();
+		pCall->bCancelBound = false;
+	}
+
+	if (NULL != pCall->pClosure)
 		//첽صû
-		pClosure->Run();
-	else
+		pCall->pClosure->Run();
+	else if (NULL != pCall->pWaiter)
+		//ֻѷ𱾴εõụ̂߳Ѻȴ߿٣ٷ
+		pCall->pWaiter->wake();
+
+	if (NULL != pCall->pGroup)
+	{
+		pCall->pGroup->release();
+		pCall->pGroup = NULL;
+	}
+}
+
+void IOWorker::failCall(Call *pCall, const string &reason)
+{
+	if (NULL == pCall)
+		return;
+	if (!claimCall(pCall, false))
+	{
+		dropCall(pCall);
+		return;
+	}
+	if (NULL != pCall->pController)
+		pCall->pController->SetFailed(reason);
+	rpcCallback(pCall);
+	SAFE_DELETE(pCall)
+}
+
+void IOWorker::failUndecodedCall(Conn *pConn, evbuffer *pBuf, const string &reason)
+{
+	callId_t callId;
+	if (!ProtocolCodec::peekCallId(pBuf, callId))
+		return;
+
+	Call *pCall = pConn->callTable.remove(callId);
+	if (NULL == pCall)
+		return;
+	if (NULL != pCall->pStream)
+		sendStreamCredit(pConn, callId, 0);
+	failCall(pCall, reason);
+}
+
+size_t IOWorker::oversizePeekSize(unsigned char compressType, size_t bodySize)
+{
+	//δѹbodyֻidֶΣѹbodyҪһѹܽѹid
+	return std::min(bodySize, (size_t)((COMPRESS_NONE == compressType) ? CALL_ID_MAX_PREFIX_SIZE : COMPRESS_BLOCK_SIZE));
+}
+
+void IOWorker::failOversizeCall(Conn *pConn, evbuffer *pBuf, unsigned char dataType, unsigned char compressType, size_t bodySize)
+{
+	if (COMPRESS_NONE == compressType)
+		failUndecodedCall(pConn, pBuf, "response too large");
+	else if (NULL != m_pInflateBuf)
+	{
+		//ֻѹѵĿͷ֣ѹĿͷֺеid
+		Compressor::decompress(compressType, pBuf, 0, std::min(evbuffer_get_length(pBuf), bodySize), m_pInflateBuf, COMPRESS_BLOCK_SIZE);
+		failUndecodedCall(pConn, m_pInflateBuf, "response too large");
+		evbuffer_drain(m_pInflateBuf, evbuffer_get_length(m_pInflateBuf));
+	}
+	//handleFrame()һ£Ӧ黹1ȣʽӦ֡黹
+	if (DATA_TYPE_STREAM != dataType)
+		++(pConn->credit);
+}
+
+void IOWorker::detachCall(Call *pCall)
+{
+	auto it = m_mapConn.find(pCall->connId);
+	if (it != m_mapConn.end() && NULL != it->second)
+	{
+		Conn *pConn = it->second;
+		if (pCall->bWaiting)
+		{
+			pConn->listWaitingCall.erase(pCall->itWaiting);
+			pCall->bWaiting = false;
+		}
+		else
+		{
+			//ͷŵid֮󵽴Ӧλ
+			pConn->callTable.remove(pCall->callId);
+			//ʽǰʱȡֹ֪ͨͣ
+			if (NULL != pCall->pStream)
+				sendStreamCredit(pConn, pCall->callId, 0);
+		}
+	}
+}
+
+void IOWorker::timeoutCall(Call *pCall)
+{
+	detachCall(pCall);
+
+	if (!claimCall(pCall, false))
+	{
+		dropCall(pCall);
+		return;
+	}
+
+	//óʱRpcControllerʵֻͨϢ
+	RpcController *pController = dynamic_cast<RpcController *>(pCall->pController);
+	if (NULL != pController)
+		pController->setTimedOut();
+	else if (NULL != pCall->pController)
+		pCall->pController->SetFailed(RPC_ERROR_TIMEOUT);
+	rpcCallback(pCall);
+	SAFE_DELETE(pCall)
+}
+
+void IOWorker::failWaitingCalls(Conn *pConn)
+{
+	list<Call *> listWaitingCall;
+	listWaitingCall.swap(pConn->listWaitingCall);
+	for (auto it = listWaitingCall.begin(); it != listWaitingCall.end(); ++it)
 	{
-		//ͬȴеû߳
-		char buf[1];
-		send(sync_write_fd, buf, 1, 0);
+		(*it)->bWaiting = false;
+		failCall(*it, "connection lost");
 	}
-}
\ No newline at end of file
+}
+
+void IOWorker::sendWaitingCalls(Conn *pConn)
+{
+	list<Call *> listWaitingCall;
+	listWaitingCall.swap(pConn->listWaitingCall);
+	for (auto it = listWaitingCall.begin(); it != listWaitingCall.end(); ++it)
+	{
+		(*it)->bWaiting = false;
+		handleCall(*it);
+	}
+}
+
+void callTimerCallback(evutil_socket_t fd, short events, void *pArg)
+{
+	if (NULL == pArg)
+		return;
+
+	((IOWorker *)pArg)->handleCallTimer();
+}
+
+void IOWorker::handleCallTimer()
+{
+	m_callTimerWheel.advance(getNowMs() / CALL_TIMER_TICK_MS, [this](TimerNode *pNode) {
+		Call *pCall = (Call *)pNode->pOwner;
+		if (pNode == &pCall->hedgeNode)
+			handleHedgeTimer(pCall);
+		else
+			timeoutCall(pCall);
+	});
+	//ûдĵʱֹͣʱ¼
+	if (0 == m_callTimerWheel.size() && NULL != m_pCallTimerEv)
+		evtimer_del(m_pCallTimerEv);
+}
+
+uint64_t IOWorker::getNowMs()
+{
+	return boost::chrono::duration_cast<boost::chrono::milliseconds>(
+		boost::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+bool IOWorker::claimCall(Call *pCall, bool bSuccess)
+{
+	HedgeGroup *pGroup = pCall->pGroup;
+	if (NULL == pGroup)
+		return true;
+
+	if (bSuccess && pCall->sendMs > 0)
+		pGroup->pPolicy->recordLatency(getNowMs() - pCall->sendMs);
+
+	bool bRetry;
+	if (pGroup->claim(bSuccess, pCall->bHedgeLeg, bRetry))
+		return true;
+	if (!bRetry)
+		return false;
+	//IOWorkerڽͨ٣¼ѭҲ˳ԣԷȥ
+	if (m_bEnded)
+		return pGroup->abortLeg();
+
+	//ԣܿʧܵ
+	RpcChannel *pChannel = pGroup->pPolicy->getHedgeChannel();
+	if (NULL == pChannel)
+		pChannel = pGroup->pChannel;
+	if (pChannel->issueLeg(pGroup, pCall->pOutstanding, false))
+		return false;
+	//󷢲ȥʱû;ɱ󷵻ʧ
+	return pGroup->abortLeg();
+}
+
+void IOWorker::dropCall(Call *pCall)
+{
+	if (NULL != pCall->pOutstanding)
+		--(*pCall->pOutstanding);
+	m_callTimerWheel.remove(&pCall->timerNode);
+	m_callTimerWheel.remove(&pCall->hedgeNode);
+	if (NULL != pCall->pGroup)
+		pCall->pGroup->release();
+	SAFE_DELETE(pCall)
+}
+
+void IOWorker::handleHedgeTimer(Call *pCall)
+{
+	HedgeGroup *pGroup = pCall->pGroup;
+	//IOWorkerڽʱٶԳ
+	if (NULL == pGroup || m_bEnded || !pGroup->startHedge())
+		return;
+
+	RpcChannel *pChannel = pGroup->pPolicy->getHedgeChannel();
+	if (NULL == pChannel)
+		pChannel = pGroup->pChannel;
+	//ûӿʱԳ壬ԭ;Ҫ
+	if (!pChannel->issueLeg(pGroup, pCall->pOutstanding, true))
+		pGroup->abortLeg();
+}
+
+void cancelCallback(void *pArg, uint32_t cancelId)
+{
+	if (NULL == pArg)
+		return;
+
+	((IOWorker *)pArg)->postCancel(cancelId);
+}
+
+void IOWorker::postCancel(uint32_t cancelId)
+{
+	IOTask task;
+	task.type = IOTask::CANCEL;
+	task.pData = new uint32_t(cancelId);
+	if (!m_queue.put(task))
+	{
+		delete (uint32_t *)task.pData;
+		return;
+	}
+	notify();
+}
+
+void IOWorker::handleCancel(uint32_t cancelId)
+{
+	//ڼȡ֮λӵĵȴлñ
+	Call *pCall = m_cancelTable.find(cancelId);
+	if (NULL == pCall)
+		return;
+
+	detachCall(pCall);
+	pCall->pCancelController->setCallCanceled();
+	rpcCallback(pCall);
+	SAFE_DELETE(pCall)
+}
+
+void streamCreditCallback(void *pArg, unsigned int connId, uint32_t callId, uint32_t credit)
+{
+	if (NULL == pArg)
+		return;
+
+	((IOWorker *)pArg)->postStreamCredit(connId, callId, credit);
+}
+
+void IOWorker::postStreamCredit(unsigned int connId, callId_t callId, credit_t credit)
+{
+	StreamCredit *pCredit = new StreamCredit();
+	pCredit->connId = connId;
+	pCredit->callId = callId;
+	pCredit->credit = credit;
+	IOTask task;
+	task.type = IOTask::STREAM_CREDIT;
+	task.pData = pCredit;
+	if (!m_queue.put(task))
+	{
+		delete pCredit;
+		return;
+	}
+	notify();
+}
+
+void IOWorker::handleStreamCredit(const StreamCredit &credit)
+{
+	auto it = m_mapConn.find(credit.connId);
+	if (it == m_mapConn.end() || NULL == it->second)
+		return;
+	//ѽʱidѹڣҲ
+	Conn *pConn = it->second;
+	Call *pCall = pConn->callTable.find(credit.callId);
+	if (NULL == pCall || NULL == pCall->pStream)
+		return;
+	sendStreamCredit(pConn, credit.callId, credit.credit);
+}
+
+void IOWorker::sendStreamCredit(Conn *pConn, callId_t callId, credit_t credit)
+{
+	if (!pConn->bConnected)
+		return;
+	evbuffer *pOutBuf = getOutputBuffer(pConn);
+	if (NULL == pOutBuf)
+		return;
+
+	ProtocolCodec::encodeStreamCredit(pOutBuf, callId, credit, pConn->version);
+}
+
+bool streamFrameCallback(void *pArg, unsigned int connId, uint32_t callId, evbuffer *pBuf)
+{
+	if (NULL == pArg)
+	{
+		evbuffer_free(pBuf);
+		return false;
+	}
+
+	return ((IOWorker *)pArg)->postStreamFrame(connId, callId, pBuf);
+}
+
+bool IOWorker::postStreamFrame(unsigned int connId, callId_t callId, evbuffer *pBuf)
+{
+	StreamFrame *pFrame = new StreamFrame();
+	pFrame->connId = connId;
+	pFrame->callId = callId;
+	pFrame->pBuf = pBuf;
+	IOTask task;
+	task.type = IOTask::STREAM_FRAME;
+	task.pData = pFrame;
+	if (!m_queue.put(task))
+	{
+		evbuffer_free(pBuf);
+		delete pFrame;
+		return false;
+	}
+	notify();
+	return true;
+}
+
+void IOWorker::handleStreamFrameTask(const StreamFrame &frame)
+{
+	auto it = m_mapConn.find(frame.connId);
+	if (it == m_mapConn.end() || NULL == it->second)
+		return;
+	//ѽʱidѹڣҲãؽʧܣͬҲ
+	Conn *pConn = it->second;
+	Call *pCall = pConn->callTable.find(frame.callId);
+	if (NULL == pCall || NULL == pCall->pStream || !pConn->bConnected)
+		return;
+	//дʽ֡ڱõ֮
+	evbuffer *pOutBuf = getOutputBuffer(pConn);
+	if (NULL != pOutBuf)
+		evbuffer_add_buffer(pOutBuf, frame.pBuf);
+}
+
+bool IOWorker::handleStreamFrame(Conn *pConn, const unsigned char *pArr, size_t bodySize)
+{
+	ProtocolBodyStream bodyStream;
+	if (!bodyStream.ParseFromArray(pArr, (int)bodySize))
+		return false;
+
+	bool bTerminal = (STREAM_END == bodyStream.frame() || STREAM_ERROR == bodyStream.frame());
+	//ENDERRORòͷŲλֻ֡ҵãѳʱȡʱҲã֡
+	Call *pCall = bTerminal ? pConn->callTable.remove(bodyStream.callid()) : pConn->callTable.find(bodyStream.callid());
+	if (NULL == pCall)
+		return bTerminal;
+	if (NULL == pCall->pStream)
+	{
+		//ͨյʽӦ֡Э鲻ʧܽ
+		if (bTerminal)
+			failCall(pCall, "unexpected stream response");
+		return bTerminal;
+	}
+
+	//END֡еĳΪһϢ
+	if (STREAM_MESSAGE == bodyStream.frame() || (STREAM_END == bodyStream.frame() && bodyStream.has_content()))
+		pCall->pStream->push(bodyStream.mutable_content());
+	if (bTerminal)
+	{
+		if (STREAM_ERROR == bodyStream.frame() && NULL != pCall->pController)
+			pCall->pController->SetFailed(bodyStream.error());
+		rpcCallback(pCall);
+		SAFE_DELETE(pCall)
+	}
+	//BEGINʾѽʽã账
+	return bTerminal;
+}
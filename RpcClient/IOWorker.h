@@ -10,6 +10,41 @@
 ************************************************************************/
 void notifiedCallback(evutil_socket_t fd, short events, void *pArg);
 
+/************************************************************************
+  ܣlibevent дϲڵںص˺
+  libevent event_callback_fn
+ֵ
+************************************************************************/
+void corkCallback(evutil_socket_t fd, short events, void *pArg);
+
+/************************************************************************
+  ܣlibevent óʱtickںص˺
+  libevent event_callback_fn
+ֵ
+************************************************************************/
+void callTimerCallback(evutil_socket_t fd, short events, void *pArg);
+
+/************************************************************************
+  ܣûRpcController::StartCancel()ص˺̵߳
+  RpcController::CancelFnpArgΪIOWorkerָ
+ֵ
+************************************************************************/
+void cancelCallback(void *pArg, uint32_t cancelId);
+
+/************************************************************************
+  ܣͻȡϢҪ黹ʱص˺̵߳
+  ClientStream CreditFn
+ֵ
+************************************************************************/
+void streamCreditCallback(void *pArg, unsigned int connId, uint32_t callId, uint32_t credit);
+
+/************************************************************************
+  ܣͻʽдϢд롢Ҫʽ֡ʱص˺̵߳
+  ClientStream FrameFn
+ֵClientStream FrameFn
+************************************************************************/
+bool streamFrameCallback(void *pArg, unsigned int connId, uint32_t callId, evbuffer *pBuf);
+
 /************************************************************************
   ܣlibevent bufferevent뻺ɶص˺
   libevent bufferevent_data_cb
@@ -31,12 +66,13 @@ public:
 	/************************************************************************
 	  ܣ췽
 	  
-		fds룬IOWorkerӦsocketpair
 		queueMaxSize룬󳤶
 		heartbeatInterval룬PINGķ
+		corkUsec룬дϲĵȴڣλΪ΢룬Ϊ0ʾÿôд
+		maxResponseSize룬ӦЭbodyѹİѹ󣩵󳤶ȣλΪֽڣΪ0ʾ
 	ֵ
 	************************************************************************/
-	IOWorker(evutil_socket_t *fds, unsigned int queueMaxSize, timeval heartbeatInterval);
+	IOWorker(unsigned int queueMaxSize, timeval heartbeatInterval, unsigned int corkUsec, unsigned int maxResponseSize);
 
 	/************************************************************************
 	  ܣ
@@ -52,6 +88,13 @@ public:
 	************************************************************************/
 	void start();
 
+	/************************************************************************
+	  ܣ֪֪ͨͨǺϲģÿζеIO񲢼
+	  
+	ֵ
+	************************************************************************/
+	void handleNotified();
+
 	/************************************************************************
 	  ܣIO֪ͨIOIOWorker
 	  
@@ -59,6 +102,44 @@ public:
 	************************************************************************/
 	void handleIOTask();
 
+	/************************************************************************
+	  ܣϴдһbuffereventevbuffer
+		ÿֻһд¼libeventͨһwritev()д
+	  
+	ֵ
+	************************************************************************/
+	void flushPending();
+
+	/************************************************************************
+	  ܣȡӵevbufferȰдϲŵУ
+		֮дĿ֡ȡȡԽõȵ
+	  
+		pConn룬ָ
+	ֵevbufferָ룬ΪNULLʾûbufferevent
+	************************************************************************/
+	evbuffer *getOutputBuffer(Conn *pConn);
+
+	/************************************************************************
+	  ܣôддϲʱдȴڵ
+	  
+	ֵ
+	************************************************************************/
+	void schedulePending();
+
+	/************************************************************************
+	  ܣƽóʱʱ֣Գʱʧܽеڵĵ
+	  
+	ֵ
+	************************************************************************/
+	void handleCallTimer();
+
+	/************************************************************************
+	  ܣȡʱӵĵǰʱ䣬õĽֹʱԴΪ׼̵߳
+	  
+	ֵǰʱ䣬λΪ
+	************************************************************************/
+	static uint64_t getNowMs();
+
 	/************************************************************************
 	  ܣ֪ͨ
 	  
@@ -109,28 +190,60 @@ public:
 	void freeConn(Conn *pConn);
 
 	/************************************************************************
-	  ܣȡIOWorkerķæ̶ȣԵǰIOWorker m_mapConnsizeʾæ̶
+	  ܣȡIOWorkerķæ̶ȣԵǰIOWorkerϵʾæ̶ȣ̵߳
 	  
 	ֵIOWorkerķæ̶
 	************************************************************************/
 	unsigned int getBusyLevel();
 
 	/************************************************************************
-	  ܣȡIOWorkersocketpairд
+	  ܣ֪ͨIOWorkerµIO̵߳
 	  
-	ֵIOWorkersocketpairд
+	ֵ
 	************************************************************************/
-	evutil_socket_t getNotify_fd();
+	void notify();
 
 	/************************************************************************
-	  ܣ
+	  ܣӣ̵߳ãIOWorker̴߳CONNECTʱżm_mapConn
 	  
 	ֵConnָ룬ʧܣidNULL
 	************************************************************************/
 	Conn *genConn();
 
-	//УڷIO
+	/************************************************************************
+	  ܣȡã̵߳ãѽʱʲôҲ
+	  
+		cancelId룬õȡid
+	ֵ
+	************************************************************************/
+	void postCancel(uint32_t cancelId);
+
+	/************************************************************************
+	  ܣ黹ȣ̵߳
+	  
+		connId룬ڵid
+		callId룬id
+		credit룬
+	ֵ
+	************************************************************************/
+	void postStreamCredit(unsigned int connId, callId_t callId, credit_t credit);
+
+	/************************************************************************
+	  ܣͿͻʽõʽ̵֡߳
+	  
+		connId룬ڵid
+		callId룬id
+		pBuf룬Эݣ֮IOWorkerͷ
+	ֵ
+		trueѷ
+		falsepBufͷ
+	************************************************************************/
+	bool postStreamFrame(unsigned int connId, callId_t callId, evbuffer *pBuf);
+
+	//УڷӡϿӵIO
 	SyncQueue<IOTask> m_queue;
+	//ύУû߳ύãֻIOWorker߳ȡ
+	MpscQueue<Call, &Call::pNextSubmit> m_callQueue;
 
 private:
 	/************************************************************************
@@ -138,7 +251,7 @@ private:
 	  
 	ֵ
 	************************************************************************/
-	void threadMain(evutil_socket_t notified_fd);
+	void threadMain();
 
 	/************************************************************************
 	  ܣϿӵ
@@ -148,6 +261,14 @@ private:
 	************************************************************************/
 	void handleDisconnect(unsigned int connId);
 
+	/************************************************************************
+	  ܣ黹id1
+	  
+		connId룬id
+	ֵ
+	************************************************************************/
+	void backConnId(unsigned int connId);
+
 	/************************************************************************
 	  ܣõ
 	  
@@ -157,28 +278,219 @@ private:
 	void handleCall(Call *pCall);
 
 	/************************************************************************
-	  ܣrpcص
+	  ܣrpcص첽ʱصûͬʱѵ߳
+	  
+		pCall룬ָ
+	ֵ
+	************************************************************************/
+	void rpcCallback(Call *pCall);
+
+	/************************************************************************
+	  ܣԳʱʧܽãӵȴлñƳãͷŵidȻ󷵻û
 	  
-		pClosure룬ڻصûClosureָ
-		sync_write_fd룬ͬõsocketpairд
+		pCall룬ָ
+	ֵ
+	************************************************************************/
+	void timeoutCall(Call *pCall);
+
+	/************************************************************************
+	  ܣȡõȡʧܽ
+	  
+		cancelId룬õȡidѽʱidѹڣʲôҲ
+	ֵ
+	************************************************************************/
+	void handleCancel(uint32_t cancelId);
+
+	/************************************************************************
+	  ܣôӵĵȴлñƳͷŵid֮󵽴Ӧ
+	  
+		pCall룬ָ
+	ֵ
+	************************************************************************/
+	void detachCall(Call *pCall);
+
+	/************************************************************************
+	  ܣʧܽӵȴееãӱǰ
+	  
+		pConn룬ָ
+	ֵ
+	************************************************************************/
+	void failWaitingCalls(Conn *pConn);
+
+	/************************************************************************
+	  ܣ˳򷢳ӵȴеĵãӽյضȺãٴĵڶ
+	  
+		pConn룬ָ
+	ֵ
+	************************************************************************/
+	void sendWaitingCalls(Conn *pConn);
+
+	/************************************************************************
+	  ܣʧܽãôϢûãȻٵ
+	  
+		pCall룬ָ
+		reason룬ԭ
+	ֵ
+	************************************************************************/
+	void failCall(Call *pCall, const string &reason);
+
+	/************************************************************************
+	  ܣӦ󳤶ȻѹʧʱЭbodyĿͷֶidʧܽõã
+		ʽͬʱֹ֪ͨͣͣidʱֻܶӦɳʱ
+	  
+		pConn룬ָ
+		pBuf룬ͷЭbodyѹĿͷ֣evbuffer޸
+		reason룬ԭ
+	ֵ
+	************************************************************************/
+	void failUndecodedCall(Conn *pConn, evbuffer *pBuf, const string &reason);
+
+	/************************************************************************
+	  ܣԳõһʱǷûãҪʱIOWorkerʱ
+	  
+		pCall룬ָ
+		bSuccess룬Ƿɹ
+	ֵ
+		trueɱ󷵻ûãǶԳǷtrue
+		falseԱĽҪͨdropCall()ٵ
+	************************************************************************/
+	bool claimCall(Call *pCall, bool bSuccess);
+
+	/************************************************************************
+	  ܣٽԵĶԳ󣬲û
+	  
+		pCall룬ָ
+	ֵ
+	************************************************************************/
+	void dropCall(Call *pCall);
+
+	/************************************************************************
+	  ܣԳӳٵҵδʱԳ
+	  
+		pCall룬ָ
+	ֵ
+	************************************************************************/
+	void handleHedgeTimer(Call *pCall);
+
+	/************************************************************************
+	  ܣһӦʽӦ֡ЭbodyevbufferƳ
+	  
+		pConn룬ָ
+		pBuf룬ЭbodyλڿͷevbufferӵevbufferƬevbuffer
+		dataType룬
+		compressType룬Эbodyѹ㷨
+		bodySize룬ЭbodyȣӦ
+	ֵ
+	************************************************************************/
+	void handleFrame(Conn *pConn, evbuffer *pBuf, unsigned char dataType, unsigned char compressType, size_t bodySize);
+
+	/************************************************************************
+	  ܣķƬѵĲ֣evbufferЭݣevbufferƳ
+		ЭbodyӦʱʧܽõã÷Ƭid
+	  
+		pConn룬ָ룬Ƭʣ೤ΪpConn->inBodySize
+		pBuf룬ƬЭbodyʣಿ֣λڿͷevbuffer
+	ֵ
+		trueƬѴ
+		falseƬδȫ
+	************************************************************************/
+	bool handleFragment(Conn *pConn, evbuffer *pBuf);
+
+	/************************************************************************
+	  ܣЭbodyӦʱҪٿͷֲܶid
+	  
+		compressType룬Эbodyѹ㷨
+		bodySize룬Эbody
+	ֵͷֵĳ
+	************************************************************************/
+	static size_t oversizePeekSize(unsigned char compressType, size_t bodySize);
+
+	/************************************************************************
+	  ܣЭbodyӦʱѵĿͷֶidʧܽõãbody
+	  
+		pConn룬ָ
+		pBuf룬ЭbodyĿͷλڿͷevbuffer޸
+		dataType룬
+		compressType룬Эbodyѹ㷨
+		bodySize룬Эbody
+	ֵ
+	************************************************************************/
+	void failOversizeCall(Conn *pConn, evbuffer *pBuf, unsigned char dataType, unsigned char compressType, size_t bodySize);
+
+	/************************************************************************
+	  ܣʽӦ֡
+	  
+		pConn룬ָ
+		pArr룬Эbody
+		bodySize룬Эbody
+	ֵ
+		trueENDERROR֡൱Ӧ黹1Ӷ
+		falseBEGINMESSAGE֡ЭbodyЧ
+	************************************************************************/
+	bool handleStreamFrame(Conn *pConn, const unsigned char *pArr, size_t bodySize);
+
+	/************************************************************************
+	  ܣ黹ȵ񣬵ѽʱʲôҲ
+	  
+		credit룬黹ȵ
+	ֵ
+	************************************************************************/
+	void handleStreamCredit(const StreamCredit &credit);
+
+	/************************************************************************
+	  ܣʽ֡񣬵ѽʱʽ֡
+	  
+		frame룬ʽ֡
+	ֵ
+	************************************************************************/
+	void handleStreamFrameTask(const StreamFrame &frame);
+
+	/************************************************************************
+	  ܣ
+	  
+		pConn룬ָ
+		callId룬id
+		credit룬Ϊ0ʾȡ
 	ֵ
 	************************************************************************/
-	void rpcCallback(google::protobuf::Closure *pClosure, evutil_socket_t sync_write_fd);
+	void sendStreamCredit(Conn *pConn, callId_t callId, credit_t credit);
 
 	//߳
 	boost::thread m_thd;
-	//socketpair
-	evutil_socket_t m_notified_fd;
-	//socketpairд
-	evutil_socket_t m_notify_fd;
-	//Ψһid
+	//֪ͨڽRpcChannel֪ͨ
+	Notifier m_notifier;
+	//Ƿյ֪ͨ
+	std::atomic<bool> m_bEndNotified;
+	//Ψһidɵ̺߳IOWorker̹߳ͬʣ
 	UniqueIdGenerator<unsigned int> m_connIdGen;
+	//m_connIdGen
+	boost::mutex m_connIdMutex;
+	//ɡδm_mapConn
+	std::atomic<unsigned int> m_connNum;
 	//ӣmap<id, ָ>
 	map<unsigned int, Conn *> m_mapConn;
 	//event_baseָ
 	event_base *m_pEvBase;
 	//PINGķ
 	timeval m_heartbeatInterval;
+	//дϲĵȴ
+	timeval m_corkInterval;
+	//дϲڵĶʱ¼Ϊ0ʱΪNULL
+	event *m_pCorkEv;
+	//ддidӿдǰͷţԲָ
+	vector<unsigned int> m_vecPendingConnId;
+	//óʱʱ֣tickΪCALL_TIMER_TICK_MSеùһʱ¼
+	TimerWheel m_callTimerWheel;
+	//óʱĶʱ¼ʱеʱδ
+	event *m_pCallTimerEv;
+	//óʱ
+	timeval m_callTimerInterval;
+	//ȡ;ãȡidλidڵȡλҲ
+	SlabTable<Call> m_cancelTable;
+	//ѹӦõevbufferÿӦգڴlibeventͷ
+	evbuffer *m_pInflateBuf;
+	//ӦЭbodyѹİѹ󣩵󳤶
+	size_t m_maxResponseSize;
 	//IOWorkerǷѾʼ
 	bool m_bStarted;
 	//IOWorkerǷѾʼ
@@ -4,6 +4,7 @@
 #include <string>
 #include <google/protobuf/service.h>
 #include "IRpcClient.h"
+#include "ClientStream.h"
 
 #ifdef WIN32
 #ifdef RPCCLIENT_EXPORTS
@@ -15,6 +16,30 @@
 #define RPCCLIENT_DLL_EXPORTS
 #endif
 
+//ĶԳͳ
+struct HedgeStat
+{
+	//ʹöԳԵĵ
+	unsigned long long callCount;
+	//ĶԳ
+	unsigned long long hedgeCount;
+	//ԳԭɹصĴ
+	unsigned long long hedgeWinCount;
+	//ʧܺ󷢳
+	unsigned long long retryCount;
+	//ǰĶԳӳ٣λΪ룬Ϊ0ʾݲԳ
+	unsigned int hedgeDelayMs;
+
+	HedgeStat()
+	{
+		callCount = 0;
+		hedgeCount = 0;
+		hedgeWinCount = 0;
+		retryCount = 0;
+		hedgeDelayMs = 0;
+	}
+};
+
 //RpcChannelӿ
 class RPCCLIENT_DLL_EXPORTS IRpcChannel : public google::protobuf::RpcChannel
 {
@@ -27,12 +52,14 @@ public:
 		pIClient룬IRpcClientָ
 		ip룬ipַ
 		port룬Ķ˿ں
+		maxConnNum룬ͨޣĬΪ11ʱ;ӣ
+			ӷֲͬIOWorkerϣÿεѡ;ٵ
 	ֵIRpcChannelָ
 	************************************************************************/
-	static IRpcChannel *createRpcChannel(IRpcClient *pIClient, const std::string &ip, int port);
+	static IRpcChannel *createRpcChannel(IRpcClient *pIClient, const std::string &ip, int port, unsigned int maxConnNum = 1);
 
 	/************************************************************************
-	  ܣRpcChannelʵ
+	  ܣRpcChannelʵͨϷĵñ붼ѽ
 	  
 		pIRpcChannelpIRpcChannelָ
 	ֵ
@@ -49,6 +76,71 @@ public:
 		const google::protobuf::Message* request,
 		google::protobuf::Message* response,
 		google::protobuf::Closure* done) = 0;
+
+	/************************************************************************
+	  ܣʽãأصϢͨͻȡ̵߳
+		֧ʽõķظͨӦΪΨһϢ
+	  
+		method룬Service::descriptor()->FindMethodByName("export")
+		controller룬RpcControllerָ룬ڻȡʧԭóʱȡãǰ
+		request룬Σغ󼴿
+		pStreamͻǰ٣ʧʱʧԭcontroller
+		window룬Ĵڣͻ໺δȡϢĬΪ0ʾʹSTREAM_DEFAULT_WINDOW
+	ֵ
+	************************************************************************/
+	virtual void startStream(const google::protobuf::MethodDescriptor *method, RpcController *controller,
+		const google::protobuf::Message *request, ClientStream *pStream, unsigned int window = 0) = 0;
+
+	/************************************************************************
+	  ܣͻʽãأ֮ͨͻдϢдClientStream::finish()ȴӦ̵߳
+		ʵڷͨServerStream::read()ȡϢΪգֿ֧ͻʽõķֱӻظд漴ʧ
+	  
+		method룬Service::descriptor()->FindMethodByName("import")
+		controller룬RpcControllerָ룬ڻȡʧԭóʱȡãǰ
+		responseΣǰ
+		pStreamͻǰ٣ʧʱʧԭcontroller
+		window룬Ĵڣ໺δȡϢĬΪ0ʾʹSTREAM_DEFAULT_WINDOW
+			ĶȿܸС
+	ֵ
+	************************************************************************/
+	virtual void startClientStream(const google::protobuf::MethodDescriptor *method, RpcController *controller,
+		google::protobuf::Message *response, ClientStream *pStream, unsigned int window = 0) = 0;
+
+	/************************************************************************
+	  ܣͨϵõĬϳʱʱ䣬RpcControllerδóʱʱʱʹã̵߳
+		ʱĵʧܽRpcController::isTimedOut()ΪtrueϢΪRPC_ERROR_TIMEOUT
+	  
+		timeoutMs룬ʱʱ䣬λΪ룬Ϊ0ʾʱǳʼֵ
+	ֵ
+	************************************************************************/
+	virtual void setDefaultTimeout(unsigned int timeoutMs) = 0;
+
+	/************************************************************************
+	  ܣΪݵȵķöԳԣ̵߳ãظʱ޸ԭ
+		1÷󳬹ԳӳδأһӣԳͨȳɹصĽû
+		   һĽԣԳͨΪNULLʱͨҪ2ӣcreateRpcChannelmaxConnNum
+		2ʧʱûзδʱһΣ
+		3ֻݵȵķյͬһ2Ρ
+	  
+		methodFullName룬ȫ"testNamespace.NumService.add"
+		hedgeDelayMs룬Գӳ٣λΪ룬Ϊ0ʾ÷Ӧӳٵp95Ӧ
+		pHedgeChannel룬ʹõͨһΪNULLʾʹñͨ
+	ֵ
+		trueóɹ
+		false
+	************************************************************************/
+	virtual bool setHedgePolicy(const std::string &methodFullName, unsigned int hedgeDelayMs, IRpcChannel *pHedgeChannel = NULL) = 0;
+
+	/************************************************************************
+	  ܣȡĶԳͳ
+	  
+		methodFullName룬ȫ
+		statԳͳ
+	ֵ
+		trueȡɹ
+		falseûöԳ
+	************************************************************************/
+	virtual bool getHedgeStat(const std::string &methodFullName, HedgeStat &stat) = 0;
 };
 
 #endif
\ No newline at end of file
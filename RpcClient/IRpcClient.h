@@ -13,6 +13,8 @@
 
 #ifdef WIN32
 #include <winsock2.h>
+#else
+#include <sys/time.h>
 #endif
 
 //RpcClientӿ
@@ -27,9 +29,15 @@ public:
 		IOWorkerNum룬IOWorkerWorker
 		IOWorkerQueueMaxSize룬IOWorkerе󳤶
 		heartbeatInterval룬PINGķ
+		corkUsec룬дϲĵȴڣλΪ΢
+			0IOWorkerÿһãѱһдĬֵʺϵӳ
+			0һд뻺ٵȴôãѴڵĵúϲдӳٻ
+		maxResponseSize룬ӦЭbodyѹİѹ󣩵󳤶ȣλΪֽڣĬΪ64MBΪ0ʾƣ
+			ʱʧֹܽСѹݽѹ޴Ľľڴ
 	ֵIRpcClientָ
 	************************************************************************/
-	static IRpcClient *createRpcClient(unsigned int IOWorkerNum, unsigned int IOWorkerQueueMaxSize, timeval heartbeatInterval);
+	static IRpcClient *createRpcClient(unsigned int IOWorkerNum, unsigned int IOWorkerQueueMaxSize, timeval heartbeatInterval, unsigned int corkUsec = 0,
+		unsigned int maxResponseSize = 64 * 1024 * 1024);
 
 	/************************************************************************
 	  ܣRpcClientʵ
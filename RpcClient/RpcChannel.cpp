@@ -2,9 +2,9 @@
 
 IRpcChannel::~IRpcChannel() {}
 
-IRpcChannel *IRpcChannel::createRpcChannel(IRpcClient *pIClient, const string &ip, int port)
+IRpcChannel *IRpcChannel::createRpcChannel(IRpcClient *pIClient, const string &ip, int port, unsigned int maxConnNum)
 {
-	return new ::RpcChannel((RpcClient *)pIClient, ip, port);
+	return new ::RpcChannel((RpcClient *)pIClient, ip, port, maxConnNum);
 }
 
 void IRpcChannel::releaseRpcChannel(IRpcChannel *pIRpcChannel)
@@ -12,46 +12,33 @@ void IRpcChannel::releaseRpcChannel(IRpcChannel *pIRpcChannel)
 	SAFE_DELETE(pIRpcChannel)
 }
 
-RpcChannel::RpcChannel(RpcClient *pClient, const string &ip, int port)
+RpcChannel::RpcChannel(RpcClient *pClient, const string &ip, int port, unsigned int maxConnNum)
+	: m_vecConn((maxConnNum > 0) ? maxConnNum : 1)
 {
 	m_pClient = pClient;
-	m_pWorker = NULL;
 	m_ip = ip;
 	m_port = port;
-	m_bConnected = false;
-	m_bSyncValid = false;
-
-	//ͬõsocketpair
-	evutil_socket_t fds[2];
-	if (evutil_socketpair(AF_INET, SOCK_STREAM, 0, fds) >= 0)
-	{
-		//socketpair2Ĭ
-		m_sync_read_fd = fds[0];
-		m_sync_write_fd = fds[1];
-		m_bSyncValid = true;
-	}
+	m_connNum.store(0);
+	m_defaultTimeoutMs.store(0);
+	m_hedgePolicyNum.store(0);
 }
 
 RpcChannel::~RpcChannel()
 {
-	//رͬõsocketpair
-	if (m_bSyncValid)
-	{
-		evutil_closesocket(m_sync_read_fd);
-		evutil_closesocket(m_sync_write_fd);
-	}
-
 	//֪ͨIOWorkerϿ
-	if (m_bConnected && NULL != m_pWorker)
+	unsigned int connNum = m_connNum.load();
+	for (unsigned int i = 0; i < connNum; ++i)
 	{
 		IOTask task;
 		task.type = IOTask::DISCONNECT;
-		task.pData = new unsigned int(m_connId);
+		task.pData = new unsigned int(m_vecConn[i].connId);
 
-		m_pWorker->m_queue.put(task);
-		char buf[1] = { NOTIFY_IOWORKER_IOTASK };
-		send(m_pWorker->getNotify_fd(), buf, 1, 0);
+		m_vecConn[i].pWorker->m_queue.put(task);
+		m_vecConn[i].pWorker->notify();
 	}
+
+	for (auto it = m_mapHedgePolicy.begin(); it != m_mapHedgePolicy.end(); ++it)
+		SAFE_DELETE(it->second)
 }
 
 void RpcChannel::CallMethod(const google::protobuf::MethodDescriptor* method,
@@ -63,10 +50,13 @@ void RpcChannel::CallMethod(const google::protobuf::MethodDescriptor* method,
 	if (NULL != controller)
 		controller->Reset();
 
-	if (NULL == method || NULL == request || NULL == response || !m_bSyncValid)
+	if (NULL == method || NULL == request || NULL == response)
 	{
 		if (NULL != controller)
-			controller->SetFailed("method == NULL or request == NULL or response == NULL or sync socketpair created failed");
+			controller->SetFailed("method == NULL or request == NULL or response == NULL");
+		//첽ڷʧʱҲҪصȴصûЭ̣һֱ
+		if (NULL != done)
+			done->Run();
 		return;
 	}
 
@@ -74,73 +64,432 @@ void RpcChannel::CallMethod(const google::protobuf::MethodDescriptor* method,
 	{
 		if (NULL != controller)
 			controller->SetFailed("RpcClient object does not exist");
+		if (NULL != done)
+			done->Run();
 		return;
 	}
 
-	//δ
-	if (!m_bConnected)
+	//ѡӣδʱ
+	ChannelConn *pChannelConn = selectConn(controller);
+	if (NULL == pChannelConn)
 	{
-		//RpcClientIOWorkerزѡеIOWorkerϷ
-		Conn *pConn = NULL;
-		m_pWorker = m_pClient->schedule(pConn);
-		if (NULL == m_pWorker)
-		{
-			//ʧ
-			if (NULL != controller)
-				controller->SetFailed("connection refused");
-			return;
-		}
-		m_connId = pConn->connId;
-		//֪ͨIOWorker
-		pConn->pWorker = m_pWorker;
-		//ַ
-		pConn->serverAddr.sin_family = AF_INET;
-		if (0 == evutil_inet_pton(AF_INET, m_ip.c_str(), &(pConn->serverAddr.sin_addr)))
-			return;
-		pConn->serverAddr.sin_port = htons(m_port);
+		if (NULL != done)
+			done->Run();
+		return;
+	}
+	//ڵ߳нֱлevbufferIOWorkerʱٿ
+	evbuffer *pReqBuf = evbuffer_new();
+	if (NULL == pReqBuf || !ProtocolCodec::serializeToEvbuffer(pReqBuf, *request))
+	{
+		if (NULL != controller)
+			controller->SetFailed("request serialized failed");
+		if (NULL != pReqBuf)
+			evbuffer_free(pReqBuf);
+		if (NULL != done)
+			done->Run();
+		return;
+	}
+	//֪ͨIOWorker
+	Call *pCall = new Call();
+	pCall->connId = pChannelConn->connId;
+	pCall->pOutstanding = &pChannelConn->outstanding;
+	pCall->pReqBuf = pReqBuf;
+	pCall->pRespMessage = response;
+	pCall->pClosure = done;
+	pCall->pController = controller;
+	pCall->pServiceDescriptor = method->service();
+	pCall->methodIndex = method->index();
+	//RpcControllerϵĳʱʱͨĬϳʱʱ䣬ֹʱӷʱ
+	unsigned int timeoutMs = 0;
+	RpcController *pController = dynamic_cast<RpcController *>(controller);
+	if (NULL != pController)
+		timeoutMs = pController->getTimeout();
+	if (0 == timeoutMs)
+		timeoutMs = m_defaultTimeoutMs.load(std::memory_order_relaxed);
+	if (timeoutMs > 0)
+		pCall->deadlineMs = IOWorker::getNowMs() + timeoutMs;
 
-		IOTask task;
-		task.type = IOTask::CONNECT;
-		task.pData = pConn;
+	//Ϊͬãڱ߳ջϴȴߣ÷ʱIOWorkerֻѱ߳
+	//Ϊ첽ãֱӷأ÷ʱûص
+	SyncWaiter waiter;
+	if (NULL == done)
+		pCall->pWaiter = &waiter;
+
+	//жԳʱԳõĹ״̬ڶʹ
+	HedgePolicy *pPolicy = findHedgePolicy(method);
+	if (NULL != pPolicy)
+	{
+		HedgeGroup *pGroup = new HedgeGroup();
+		pGroup->pPolicy = pPolicy;
+		pGroup->pChannel = this;
+		pGroup->strReq.resize(evbuffer_get_length(pReqBuf));
+		if (!pGroup->strReq.empty())
+			evbuffer_copyout(pReqBuf, &pGroup->strReq[0], pGroup->strReq.size());
+		pGroup->pServiceDescriptor = pCall->pServiceDescriptor;
+		pGroup->methodIndex = pCall->methodIndex;
+		pGroup->deadlineMs = pCall->deadlineMs;
+		pGroup->pRespMessage = response;
+		pGroup->pClosure = done;
+		pGroup->pController = controller;
+		pGroup->pWaiter = pCall->pWaiter;
+		pCall->pGroup = pGroup;
+		pCall->hedgeDelayMs = pPolicy->getHedgeDelay();
+		++pPolicy->m_callCount;
+	}
+	//RpcControllerĵÿͨStartCancel()ȡԳж󣬲֧ȡ
+	else if (NULL != pController)
+	{
+		pController->setCancelHandler(cancelCallback, pChannelConn->pWorker);
+		pCall->pCancelController = pController;
+	}
+
+	//;ڷǰӣIOWorkerʱ
+	++pChannelConn->outstanding;
+	//ύãû̲߳ڶϾ
+	if (!pChannelConn->pWorker->m_callQueue.put(pCall))
+	{
+		//òᱻܵȴ
+		--pChannelConn->outstanding;
+		if (NULL != controller)
+			controller->SetFailed("IOWorker queue is full");
+		if (NULL != pCall->pGroup)
+			pCall->pGroup->release();
+		SAFE_DELETE(pCall)
+		if (NULL != done)
+			done->Run();
+		return;
+	}
+	//֪ͨIOWorkerIOWorkerл;ϵͳ
+	pChannelConn->pWorker->notify();
+
+	if (NULL == done)
+		waiter.wait();
+}
+
+void RpcChannel::startStream(const google::protobuf::MethodDescriptor *method, RpcController *controller,
+	const google::protobuf::Message *request, ClientStream *pStream, unsigned int window)
+{
+	if (NULL == pStream)
+		return;
+	if (NULL != controller)
+		controller->Reset();
+	//Ľصκηʽʱ
+	google::protobuf::Closure *done = pStream->start(controller, (0 == window) ? STREAM_DEFAULT_WINDOW : window);
 
-		m_pWorker->m_queue.put(task);
-		char buf[1] = { NOTIFY_IOWORKER_IOTASK };
-		send(m_pWorker->getNotify_fd(), buf, 1, 0);
-		m_bConnected = true;
+	if (NULL == method || NULL == request)
+	{
+		if (NULL != controller)
+			controller->SetFailed("method == NULL or request == NULL");
+		done->Run();
+		return;
 	}
-	//л
-	string *pStr = new string();
-	if (!request->SerializeToString(pStr))
+	evbuffer *pReqBuf = evbuffer_new();
+	if (NULL == pReqBuf || !ProtocolCodec::serializeToEvbuffer(pReqBuf, *request))
 	{
 		if (NULL != controller)
 			controller->SetFailed("request serialized failed");
-		SAFE_DELETE(pStr)
+		if (NULL != pReqBuf)
+			evbuffer_free(pReqBuf);
+		done->Run();
 		return;
 	}
-	//֪ͨIOWorker
+	//ʽûӦMessageϢIOWorkerͻ
+	issueStream(method, controller, pReqBuf, NULL, pStream, done, (0 == window) ? STREAM_DEFAULT_WINDOW : window, 0);
+}
+
+void RpcChannel::startClientStream(const google::protobuf::MethodDescriptor *method, RpcController *controller,
+	google::protobuf::Message *response, ClientStream *pStream, unsigned int window)
+{
+	if (NULL == pStream)
+		return;
+	if (NULL != controller)
+		controller->Reset();
+	//Ľصκηʽʱ
+	google::protobuf::Closure *done = pStream->startWrite(controller);
+
+	if (NULL == method || NULL == response)
+	{
+		if (NULL != controller)
+			controller->SetFailed("method == NULL or response == NULL");
+		done->Run();
+		return;
+	}
+	//ΪգϢ֮ɿͻ
+	evbuffer *pReqBuf = evbuffer_new();
+	if (NULL == pReqBuf)
+	{
+		if (NULL != controller)
+			controller->SetFailed("request serialized failed");
+		done->Run();
+		return;
+	}
+	issueStream(method, controller, pReqBuf, response, pStream, done, 0, (0 == window) ? STREAM_DEFAULT_WINDOW : window);
+}
+
+void RpcChannel::issueStream(const google::protobuf::MethodDescriptor *method, RpcController *controller, evbuffer *pReqBuf,
+	google::protobuf::Message *response, ClientStream *pStream, google::protobuf::Closure *done, uint32_t streamWindow, uint32_t clientStreamWindow)
+{
+	if (NULL == m_pClient)
+	{
+		if (NULL != controller)
+			controller->SetFailed("RpcClient object does not exist");
+		evbuffer_free(pReqBuf);
+		done->Run();
+		return;
+	}
+
+	//ѡӣδʱ
+	ChannelConn *pChannelConn = selectConn(controller);
+	if (NULL == pChannelConn)
+	{
+		evbuffer_free(pReqBuf);
+		done->Run();
+		return;
+	}
+	//ʽòֶ֧Գ
 	Call *pCall = new Call();
-	pCall->connId = m_connId;
-	pCall->sync_write_fd = m_sync_write_fd;
-	pCall->pStrReq = pStr;
+	pCall->connId = pChannelConn->connId;
+	pCall->pOutstanding = &pChannelConn->outstanding;
+	pCall->pReqBuf = pReqBuf;
 	pCall->pRespMessage = response;
 	pCall->pClosure = done;
 	pCall->pController = controller;
-	pCall->serviceName = method->service()->full_name();
+	pCall->pServiceDescriptor = method->service();
 	pCall->methodIndex = method->index();
+	pCall->pStream = pStream;
+	pCall->streamWindow = streamWindow;
+	pCall->clientStreamWindow = clientStreamWindow;
+	unsigned int timeoutMs = (NULL == controller) ? 0 : controller->getTimeout();
+	if (0 == timeoutMs)
+		timeoutMs = m_defaultTimeoutMs.load(std::memory_order_relaxed);
+	if (timeoutMs > 0)
+		pCall->deadlineMs = IOWorker::getNowMs() + timeoutMs;
+	//ȡʱIOWorkerֹ֪ͨͣ
+	if (NULL != controller)
+	{
+		controller->setCancelHandler(cancelCallback, pChannelConn->pWorker);
+		pCall->pCancelController = controller;
+	}
+
+	++pChannelConn->outstanding;
+	if (!pChannelConn->pWorker->m_callQueue.put(pCall))
+	{
+		--pChannelConn->outstanding;
+		if (NULL != controller)
+			controller->SetFailed("IOWorker queue is full");
+		SAFE_DELETE(pCall)
+		done->Run();
+		return;
+	}
+	pChannelConn->pWorker->notify();
+}
+
+ChannelConn *RpcChannel::selectConn(google::protobuf::RpcController* controller)
+{
+	unsigned int connNum = m_connNum.load(std::memory_order_acquire);
+	//δ
+	if (0 == connNum)
+	{
+		if (!addConn(connNum, controller))
+			return NULL;
+		return &m_vecConn[0];
+	}
+
+	//ѡ;ٵӣ٣ֱӱ
+	ChannelConn *pSelected = &m_vecConn[0];
+	unsigned int minOutstanding = pSelected->outstanding.load(std::memory_order_relaxed);
+	for (unsigned int i = 1; i < connNum && minOutstanding > 0; ++i)
+	{
+		unsigned int outstanding = m_vecConn[i].outstanding.load(std::memory_order_relaxed);
+		if (outstanding < minOutstanding)
+		{
+			pSelected = &m_vecConn[i];
+			minOutstanding = outstanding;
+		}
+	}
+
+	//Ӷѽæٷһӣʧʱʹѡе
+	if (minOutstanding >= CHANNEL_CONN_GROW_OUTSTANDING && connNum < m_vecConn.size()
+		&& addConn(connNum, NULL))
+	{
+		//ӣ̸߳շӣû;
+		return &m_vecConn[m_connNum.load(std::memory_order_acquire) - 1];
+	}
+	return pSelected;
+}
+
+bool RpcChannel::addConn(unsigned int knownConnNum, google::protobuf::RpcController* controller)
+{
+	boost::lock_guard<boost::mutex> lock(m_connectMutex);
+	//߳̿ڳڼ䷢
+	unsigned int connNum = m_connNum.load();
+	if (connNum != knownConnNum)
+		return true;
+	if (connNum >= m_vecConn.size())
+		return false;
+
+	//ַ
+	sockaddr_in serverAddr;
+	memset(&serverAddr, 0, sizeof(serverAddr));
+	serverAddr.sin_family = AF_INET;
+	if (0 == evutil_inet_pton(AF_INET, m_ip.c_str(), &(serverAddr.sin_addr)))
+	{
+		if (NULL != controller)
+			controller->SetFailed("invalid server ip address");
+		return false;
+	}
+	serverAddr.sin_port = htons(m_port);
+
+	//RpcClientIOWorkerزѡеIOWorkerϷ
+	Conn *pConn = NULL;
+	IOWorker *pWorker = m_pClient->schedule(pConn);
+	if (NULL == pWorker)
+	{
+		//ʧ
+		if (NULL != controller)
+			controller->SetFailed("connection refused");
+		return false;
+	}
+	pConn->pWorker = pWorker;
+	pConn->serverAddr = serverAddr;
+
+	ChannelConn &channelConn = m_vecConn[connNum];
+	channelConn.pWorker = pWorker;
+	channelConn.connId = pConn->connId;
 
+	//֪ͨIOWorker
 	IOTask task;
-	task.type = IOTask::CALL;
-	task.pData = pCall;
+	task.type = IOTask::CONNECT;
+	task.pData = pConn;
 
-	m_pWorker->m_queue.put(task);
-	char buf[1] = { NOTIFY_IOWORKER_IOTASK };
-	send(m_pWorker->getNotify_fd(), buf, 1, 0);
+	pWorker->m_queue.put(task);
+	pWorker->notify();
+	m_connNum.store(connNum + 1, std::memory_order_release);
+	return true;
+}
 
-	//ΪͬãͨĶʹֱ߳÷ʱдд
-	//Ϊ첽ãֱӷأ÷ʱûص
-	if (NULL == done)
+void RpcChannel::setDefaultTimeout(unsigned int timeoutMs)
+{
+	m_defaultTimeoutMs.store(timeoutMs);
+}
+
+bool RpcChannel::setHedgePolicy(const std::string &methodFullName, unsigned int hedgeDelayMs, IRpcChannel *pHedgeChannel)
+{
+	const google::protobuf::MethodDescriptor *pMethodDescriptor =
+		google::protobuf::DescriptorPool::generated_pool()->FindMethodByName(methodFullName);
+	if (NULL == pMethodDescriptor)
+		return false;
+
+	boost::lock_guard<boost::mutex> lock(m_hedgeMutex);
+	auto it = m_mapHedgePolicy.find(pMethodDescriptor);
+	//ÿԭԣֻ޸ģ滻
+	if (it != m_mapHedgePolicy.end())
+		it->second->set(hedgeDelayMs, (RpcChannel *)pHedgeChannel);
+	else
 	{
-		char buf[1];
-		recv(m_sync_read_fd, buf, 1, 0);
+		m_mapHedgePolicy[pMethodDescriptor] = new HedgePolicy(hedgeDelayMs, (RpcChannel *)pHedgeChannel);
+		m_hedgePolicyNum.store(m_mapHedgePolicy.size());
 	}
+	return true;
+}
+
+bool RpcChannel::getHedgeStat(const std::string &methodFullName, HedgeStat &stat)
+{
+	const google::protobuf::MethodDescriptor *pMethodDescriptor =
+		google::protobuf::DescriptorPool::generated_pool()->FindMethodByName(methodFullName);
+	if (NULL == pMethodDescriptor)
+		return false;
+
+	boost::lock_guard<boost::mutex> lock(m_hedgeMutex);
+	auto it = m_mapHedgePolicy.find(pMethodDescriptor);
+	if (it == m_mapHedgePolicy.end())
+		return false;
+	it->second->getStat(stat);
+	return true;
+}
+
+HedgePolicy *RpcChannel::findHedgePolicy(const google::protobuf::MethodDescriptor *method)
+{
+	//ûùԳʱ
+	if (0 == m_hedgePolicyNum.load(std::memory_order_acquire))
+		return NULL;
+
+	boost::lock_guard<boost::mutex> lock(m_hedgeMutex);
+	auto it = m_mapHedgePolicy.find(method);
+	return (it != m_mapHedgePolicy.end()) ? it->second : NULL;
+}
+
+ChannelConn *RpcChannel::selectOtherConn(std::atomic<unsigned int> *pExcludeOutstanding)
+{
+	unsigned int connNum = m_connNum.load(std::memory_order_acquire);
+	ChannelConn *pSelected = NULL;
+	unsigned int minOutstanding = 0;
+	for (unsigned int i = 0; i < connNum; ++i)
+	{
+		if (&m_vecConn[i].outstanding == pExcludeOutstanding)
+			continue;
+		unsigned int outstanding = m_vecConn[i].outstanding.load(std::memory_order_relaxed);
+		if (NULL == pSelected || outstanding < minOutstanding)
+		{
+			pSelected = &m_vecConn[i];
+			minOutstanding = outstanding;
+		}
+	}
+	if (NULL != pSelected)
+		return pSelected;
+
+	//ûӣδʱ
+	if (connNum < m_vecConn.size() && addConn(connNum, NULL))
+	{
+		ChannelConn *pLast = &m_vecConn[m_connNum.load(std::memory_order_acquire) - 1];
+		if (&pLast->outstanding != pExcludeOutstanding)
+			return pLast;
+	}
+	return NULL;
+}
+
+bool RpcChannel::issueLeg(HedgeGroup *pGroup, std::atomic<unsigned int> *pExcludeOutstanding, bool bHedge)
+{
+	ChannelConn *pChannelConn = selectOtherConn(pExcludeOutstanding);
+	//ûʱ
+	if (NULL == pChannelConn && !bHedge)
+		pChannelConn = selectConn(NULL);
+	if (NULL == pChannelConn)
+		return false;
+
+	Call *pCall = new Call();
+	pCall->connId = pChannelConn->connId;
+	pCall->pOutstanding = &pChannelConn->outstanding;
+	pCall->pReqBuf = evbuffer_new();
+	if (NULL == pCall->pReqBuf || 0 != evbuffer_add(pCall->pReqBuf, pGroup->strReq.data(), pGroup->strReq.size()))
+	{
+		SAFE_DELETE(pCall)
+		return false;
+	}
+	pCall->pRespMessage = pGroup->pRespMessage;
+	pCall->pClosure = pGroup->pClosure;
+	pCall->pController = pGroup->pController;
+	pCall->pWaiter = pGroup->pWaiter;
+	pCall->pServiceDescriptor = pGroup->pServiceDescriptor;
+	pCall->methodIndex = pGroup->methodIndex;
+	pCall->deadlineMs = pGroup->deadlineMs;
+	pCall->pGroup = pGroup;
+	pCall->bHedgeLeg = bHedge;
+	++pGroup->refCount;
+
+	++pChannelConn->outstanding;
+	if (!pChannelConn->pWorker->m_callQueue.put(pCall))
+	{
+		--pChannelConn->outstanding;
+		pGroup->release();
+		SAFE_DELETE(pCall)
+		return false;
+	}
+	pChannelConn->pWorker->notify();
+
+	if (bHedge)
+		++pGroup->pPolicy->m_hedgeCount;
+	else
+		++pGroup->pPolicy->m_retryCount;
+	return true;
 }
\ No newline at end of file
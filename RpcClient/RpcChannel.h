@@ -4,8 +4,32 @@
 #include "RpcClientGlobal.h"
 #include "IRpcChannel.h"
 #include "RpcClient.h"
+#include "Hedge.h"
 
-//Rpcͨһͨһ
+//ͨϵһ
+struct ChannelConn
+{
+	//IOWorker
+	IOWorker *pWorker;
+	//id
+	unsigned int connId;
+	//ӵ;ʱ1IOWorkerʱ1ѡӣ
+	//ͨӵУǷIOWorkerConnУIOWorkerʱӺԿܼ
+	std::atomic<unsigned int> outstanding;
+
+	ChannelConn()
+	{
+		pWorker = NULL;
+		connId = 0;
+		outstanding.store(0);
+	}
+};
+
+//Rpcͨͬһ1~maxConnNumӣɱ̹߳
+//1״εʱһӣ
+//2ÿεѡ;ٵӣ
+//3ӵ;ﵽCHANNEL_CONN_GROW_OUTSTANDINGδʱٷһӣ
+//   RpcClientȣֲͬIOWorkerϡ
 class RpcChannel : public IRpcChannel
 {
 public:
@@ -15,9 +39,10 @@ public:
 		pClient룬RpcClientָ
 		ip룬ipַ
 		port룬Ķ˿ں
+		maxConnNum룬ޣΪ0ʱ1
 	ֵ
 	************************************************************************/
-	RpcChannel(RpcClient *pClient, const string &ip, int port);
+	RpcChannel(RpcClient *pClient, const string &ip, int port, unsigned int maxConnNum);
 
 	/************************************************************************
 	  ܣ
@@ -37,25 +62,128 @@ public:
 		google::protobuf::Message* response,
 		google::protobuf::Closure* done);
 
+	/************************************************************************
+	  ܣʽ
+	  IRpcChannel startStream()
+	ֵ
+	************************************************************************/
+	virtual void startStream(const google::protobuf::MethodDescriptor *method, RpcController *controller,
+		const google::protobuf::Message *request, ClientStream *pStream, unsigned int window = 0);
+
+	/************************************************************************
+	  ܣͻʽ
+	  IRpcChannel startClientStream()
+	ֵ
+	************************************************************************/
+	virtual void startClientStream(const google::protobuf::MethodDescriptor *method, RpcController *controller,
+		google::protobuf::Message *response, ClientStream *pStream, unsigned int window = 0);
+
+	/************************************************************************
+	  ܣͨϵõĬϳʱʱ
+	  
+		timeoutMs룬ʱʱ䣬λΪ룬Ϊ0ʾʱ
+	ֵ
+	************************************************************************/
+	virtual void setDefaultTimeout(unsigned int timeoutMs);
+
+	/************************************************************************
+	  ܣΪݵȵķöԳ
+	  IRpcChannel setHedgePolicy()
+	ֵIRpcChannel setHedgePolicy()
+	************************************************************************/
+	virtual bool setHedgePolicy(const std::string &methodFullName, unsigned int hedgeDelayMs, IRpcChannel *pHedgeChannel = NULL);
+
+	/************************************************************************
+	  ܣȡĶԳͳ
+	  IRpcChannel getHedgeStat()
+	ֵIRpcChannel getHedgeStat()
+	************************************************************************/
+	virtual bool getHedgeStat(const std::string &methodFullName, HedgeStat &stat);
+
+	/************************************************************************
+	  ܣΪԳ÷ڶ󣨶Գ󣩣IOWorker̵߳
+	  
+		pGroup룬ԳõĹ״̬
+		pExcludeOutstanding룬һӵ;ָ룬ڱܿ
+		bHedge룬ǷǶԳ󣻶ԳֻӣûʱԿɷԭ
+	ֵ
+		trueɹ
+		falseʧ
+	************************************************************************/
+	bool issueLeg(HedgeGroup *pGroup, std::atomic<unsigned int> *pExcludeOutstanding, bool bHedge);
+
 private:
+	/************************************************************************
+	  ܣѡ;ٵӣҪʱ
+	  
+		controller룬ôϢRpcControllerָ
+	ֵָ룬ΪNULLʾûпõ
+	************************************************************************/
+	ChannelConn *selectConn(google::protobuf::RpcController* controller);
+
+	/************************************************************************
+	  ܣʽãʧʱôϢִdone
+	  
+		method룬ָ
+		controller룬RpcControllerָ
+		pReqBuf룬лķΣ֮ɱͷ
+		responseͻʽõķΣʽʱΪNULL
+		pStream룬ͻ
+		done룬Ľص
+		streamWindow룬ʽõĴڣΪ0ʾǷʽ
+		clientStreamWindow룬ͻʽĴڣΪ0ʾǿͻʽ
+	ֵ
+	************************************************************************/
+	void issueStream(const google::protobuf::MethodDescriptor *method, RpcController *controller, evbuffer *pReqBuf,
+		google::protobuf::Message *response, ClientStream *pStream, google::protobuf::Closure *done, uint32_t streamWindow, uint32_t clientStreamWindow);
+
+	/************************************************************************
+	  ܣRpcClientIOWorkerһӣ߳ͬʱʱֻһЧ
+	  
+		knownConnNum룬߿߳ѷӣٷ
+		controller룬ôϢRpcControllerָ
+	ֵ
+		trueѷӣ߳ѷ
+		falseʧ
+	************************************************************************/
+	bool addConn(unsigned int knownConnNum, google::protobuf::RpcController* controller);
+
+	/************************************************************************
+	  ܣѡָ;ٵӣûδʱ
+	  
+		pExcludeOutstanding룬Ҫܿӵ;ָ
+	ֵָ룬ΪNULLʾû
+	************************************************************************/
+	ChannelConn *selectOtherConn(std::atomic<unsigned int> *pExcludeOutstanding);
+
+	/************************************************************************
+	  ܣҷĶԳ
+	  
+		method룬ָ
+	ֵԳָ룬ΪNULLʾûжԳ
+	************************************************************************/
+	HedgePolicy *findHedgePolicy(const google::protobuf::MethodDescriptor *method);
+
 	//RpcClientָ
 	RpcClient *m_pClient;
-	//IOWorkerָ
-	IOWorker *m_pWorker;
-	//Ƿ
-	bool m_bConnected;
-	//ͬõsocketpairǷЧ
-	bool m_bSyncValid;
-	//id
-	unsigned int m_connId;
+	//ӣʱ޷䣬ٸıС±Сm_connNumԪؿɱ߳ȡ
+	vector<ChannelConn> m_vecConn;
+	//ѷú
+	std::atomic<unsigned int> m_connNum;
+	//ӵ
+	boost::mutex m_connectMutex;
 	//ipַ
 	string m_ip;
 	//Ķ˿ں
 	int m_port;
-	//ͬõsocketpair
-	evutil_socket_t m_sync_read_fd;
-	//ͬõsocketpairд
-	evutil_socket_t m_sync_write_fd;
+	//õĬϳʱʱ䣬λΪ룬Ϊ0ʾʱ
+	std::atomic<unsigned int> m_defaultTimeoutMs;
+	//ĶԳԣmap<ָ, Գָ>ͨʱ
+	map<const google::protobuf::MethodDescriptor *, HedgePolicy *> m_mapHedgePolicy;
+	//ԳΪ0ʱòҪҲ
+	std::atomic<unsigned int> m_hedgePolicyNum;
+	//m_mapHedgePolicy
+	boost::mutex m_hedgeMutex;
 };
 
 #endif
\ No newline at end of file
@@ -2,9 +2,10 @@
 
 IRpcClient::~IRpcClient() {}
 
-IRpcClient *IRpcClient::createRpcClient(unsigned int IOWorkerNum, unsigned int IOWorkerQueueMaxSize, timeval heartbeatInterval)
+IRpcClient *IRpcClient::createRpcClient(unsigned int IOWorkerNum, unsigned int IOWorkerQueueMaxSize, timeval heartbeatInterval, unsigned int corkUsec,
+	unsigned int maxResponseSize)
 {
-	return new RpcClient(IOWorkerNum, IOWorkerQueueMaxSize, heartbeatInterval);
+	return new RpcClient(IOWorkerNum, IOWorkerQueueMaxSize, heartbeatInterval, corkUsec, maxResponseSize);
 }
 
 void IRpcClient::releaseRpcClient(IRpcClient *pIRpcClient)
@@ -12,7 +13,7 @@ void IRpcClient::releaseRpcClient(IRpcClient *pIRpcClient)
 	SAFE_DELETE(pIRpcClient)
 }
 
-RpcClient::RpcClient(unsigned int IOWorkerNum, unsigned int IOWorkerQueueMaxSize, timeval heartbeatInterval)
+RpcClient::RpcClient(unsigned int IOWorkerNum, unsigned int IOWorkerQueueMaxSize, timeval heartbeatInterval, unsigned int corkUsec, unsigned int maxResponseSize)
 {
 	m_bStarted = false;
 	m_bEnded = false;
@@ -24,15 +25,7 @@ RpcClient::RpcClient(unsigned int IOWorkerNum, unsigned int IOWorkerQueueMaxSize
 
 	//IOWorker
 	for (unsigned int i = 0; i < IOWorkerNum; ++i)
-	{
-		evutil_socket_t fds[2];
-		if (evutil_socketpair(AF_INET, SOCK_STREAM, 0, fds) < 0)
-			continue;
-		//socketpair2óɷ
-		evutil_make_socket_nonblocking(fds[0]);
-		evutil_make_socket_nonblocking(fds[1]);
-		m_mapWorker[fds[1]] = new IOWorker(fds, IOWorkerQueueMaxSize, heartbeatInterval);
-	}
+		m_vecWorker.push_back(new IOWorker(IOWorkerQueueMaxSize, heartbeatInterval, corkUsec, maxResponseSize));
 }
 
 RpcClient::~RpcClient()
@@ -47,9 +40,9 @@ void RpcClient::start()
 		return;
 	m_bStarted = true;
 	//IOWorker
-	for (auto it = m_mapWorker.begin(); it != m_mapWorker.end(); ++it)
+	for (auto it = m_vecWorker.begin(); it != m_vecWorker.end(); ++it)
 	{
-		IOWorker *pWorker = it->second;
+		IOWorker *pWorker = *it;
 		if (NULL == pWorker)
 			continue;
 		pWorker->start();
@@ -64,12 +57,10 @@ void RpcClient::end()
 	m_bEnded = true;
 
 	//IOWorker
-	for (auto it = m_mapWorker.begin(); it != m_mapWorker.end(); ++it)
+	for (auto it = m_vecWorker.begin(); it != m_vecWorker.end(); ++it)
 	{
-		if (NULL != it->second)
-			SAFE_DELETE(it->second)
-		//رsocketpairд
-		evutil_closesocket(it->first);
+		if (NULL != *it)
+			SAFE_DELETE(*it)
 	}
 }
 
@@ -78,10 +69,10 @@ IOWorker *RpcClient::schedule(Conn *&pConn)
 	IOWorker *pSelectedWorker = NULL;
 	unsigned int minBusyLevel;
 
-	auto it = m_mapWorker.begin();
-	for ( ; it != m_mapWorker.end(); ++it)
+	auto it = m_vecWorker.begin();
+	for ( ; it != m_vecWorker.end(); ++it)
 	{
-		IOWorker *pWorker = it->second;
+		IOWorker *pWorker = *it;
 		if (NULL != pWorker)
 		{
 			pSelectedWorker = pWorker;
@@ -95,9 +86,9 @@ IOWorker *RpcClient::schedule(Conn *&pConn)
 
 	if (minBusyLevel > 0)
 	{
-		for (++it; it != m_mapWorker.end(); ++it)
+		for (++it; it != m_vecWorker.end(); ++it)
 		{
-			IOWorker *pWorker = it->second;
+			IOWorker *pWorker = *it;
 			if (NULL != pWorker)
 			{
 				unsigned int busyLevel = pWorker->getBusyLevel();
@@ -14,9 +14,13 @@ public:
 		IOWorkerNum룬IOWorkerWorker
 		IOWorkerQueueMaxSize룬IOWorkerе󳤶
 		heartbeatInterval룬PINGķ
+		corkUsec룬дϲĵȴڣλΪ΢
+			0IOWorkerÿһãѱһдĬֵʺϵӳ
+			0һд뻺ٵȴôãѴڵĵúϲдӳٻ
+		maxResponseSize룬ӦЭbodyѹİѹ󣩵󳤶ȣλΪֽڣΪ0ʾ
 	ֵ
 	************************************************************************/
-	RpcClient(unsigned int IOWorkerNum, unsigned int IOWorkerQueueMaxSize, timeval heartbeatInterval);
+	RpcClient(unsigned int IOWorkerNum, unsigned int IOWorkerQueueMaxSize, timeval heartbeatInterval, unsigned int corkUsec, unsigned int maxResponseSize);
 
 	/************************************************************************
 	  ܣ
@@ -48,8 +52,8 @@ public:
 	IOWorker *schedule(Conn *&pConn);
 
 private:
-	//IOWorkerأmap<IOWorkerӦsocketpairд, IOWorkerָ>
-	map<evutil_socket_t, IOWorker *> m_mapWorker;
+	//IOWorkerأvector<IOWorkerָ>
+	vector<IOWorker *> m_vecWorker;
 	//RpcServerǷѾʼ
 	bool m_bStarted;
 	//RpcServerǷѾʼ
@@ -4,7 +4,10 @@
 #include <iostream>
 #include <string>
 #include <map>
+#include <vector>
+#include <list>
 #include <functional>
+#include <atomic>
 #include <boost/thread/thread.hpp>
 #include <google/protobuf/service.h>
 #include <google/protobuf/descriptor.h>
@@ -13,52 +16,122 @@
 #include <event2/bufferevent.h>
 #include <event2/buffer.h>
 #include "SyncQueue.h"
+#include "MpscQueue.h"
 #include "UniqueIdGenerator.h"
+#include "SlabTable.h"
+#include "TimerWheel.h"
+#include "Notifier.h"
 #include "Global.h"
 #include "ProtocolBody.pb.h"
+#include "ProtocolCodec.h"
+#include "SyncWaiter.h"
+#include "RpcController.h"
+#include "ClientStream.h"
 #ifdef WIN32
 #include <winsock2.h>
 #endif
 
 using namespace std;
 
-//IOWorker͵֪ͨ
-enum NOTIFY_IOWORKER_TYPE
-{
-	//IO֪ͨIOWorkerIOͰӡϿӡ
-	NOTIFY_IOWORKER_IOTASK = 0, 
-	//֪ͨIOWorkerŽ
-	NOTIFY_IOWORKER_END = 1
-};
+//ÿϵ;ޣidĵ18λΪñλ±꣬14λΪλ
+#define MAX_PENDING_CALL 262144
+//RpcChannel;ٵӴﵽֵʱ
+#define CHANNEL_CONN_GROW_OUTSTANDING 4
+//óʱtickȣλΪ룬ôñжʱ
+#define CALL_TIMER_TICK_MS 5
+//ʽõĬϴڣͻ໺δȡϢ
+#define STREAM_DEFAULT_WINDOW 64
+//ÿͬʱδķƬidޣĬϵ;󴰿ͬʱΪ쳣
+#define MAX_OPEN_FRAGMENT 1024
 
+struct HedgeGroup;
 //ͻ˵
 struct Call
 {
 	//id
 	callId_t callId;
+	//IOWorkerύеһ
+	Call *pNextSubmit;
 	//id
 	unsigned int connId;
-	//ͬõsocketpairд
-	evutil_socket_t sync_write_fd;
-	//лڴָ
-	string *pStrReq;
+	//ͬõĵȴָ룬λڵ̵߳ջϣ첽ʱΪNULL
+	SyncWaiter *pWaiter;
+	//ӵ;λRpcChannelУýʱ1
+	std::atomic<unsigned int> *pOutstanding;
+	//õĽֹʱ䣬ȡIOWorker::getNowMs()Ϊ0ʾʱ
+	uint64_t deadlineMs;
+	//ʱʱڵ㣬ֹʱ䲻Ϊ0ʱIOWorkerڴʱŵʱ
+	TimerNode timerNode;
+	//ǷӵĵȴУδض꣩
+	bool bWaiting;
+	//ӵĵȴеλ
+	list<Call *>::iterator itWaiting;
+	//ԳõĹ״̬ûжԳʱΪNULL
+	HedgeGroup *pGroup;
+	//ǷǶԳԭ
+	bool bHedgeLeg;
+	//Գӳ٣λΪ룬Ϊ0ʾԳ
+	unsigned int hedgeDelayMs;
+	//Գ嶨ʱڵ
+	TimerNode hedgeNode;
+	//дʱ䣬ͳӦӳ
+	uint64_t sendMs;
+	//ȡõRpcControllerָ룬ûĲRpcControllerжԳʱΪNULL
+	RpcController *pCancelController;
+	//õȡidIOWorkerȡеĲλid
+	uint32_t cancelId;
+	//ǷѼIOWorkerȡ
+	bool bCancelBound;
+	//лevbufferɵ̰߳ԤĳһлIOWorkerʱдevbuffer
+	evbuffer *pReqBuf;
 	//ӦMessageָ
 	google::protobuf::Message *pRespMessage;
 	//첽صClosureָ
 	google::protobuf::Closure *pClosure;
 	//ڱʾɹ񼰴ԭRpcControllerָ
 	google::protobuf::RpcController *pController;
-	//õķ
-	string serviceName;
+	//õķָ
+	const google::protobuf::ServiceDescriptor *pServiceDescriptor;
 	//õķ±
 	uint32_t methodIndex;
+	//ʽõĿͻͨʱΪNULLĽصpClosure
+	ClientStream *pStream;
+	//ʽõĴڣΪ0ʾǷʽ
+	uint32_t streamWindow;
+	//ͻʽĴڣΪ0ʾǿͻʽ
+	uint32_t clientStreamWindow;
 
 	Call()
 	{
-		pStrReq = NULL;
+		callId = 0;
+		pNextSubmit = NULL;
+		pWaiter = NULL;
+		pOutstanding = NULL;
+		deadlineMs = 0;
+		timerNode.pOwner = this;
+		bWaiting = false;
+		pGroup = NULL;
+		bHedgeLeg = false;
+		hedgeDelayMs = 0;
+		hedgeNode.pOwner = this;
+		sendMs = 0;
+		pCancelController = NULL;
+		cancelId = 0;
+		bCancelBound = false;
+		pReqBuf = NULL;
+		pServiceDescriptor = NULL;
 		pRespMessage = NULL;
 		pClosure = NULL;
 		pController = NULL;
+		pStream = NULL;
+		streamWindow = 0;
+		clientStreamWindow = 0;
+	}
+
+	~Call()
+	{
+		if (NULL != pReqBuf)
+			evbuffer_free(pReqBuf);
 	}
 };
 
@@ -70,6 +143,22 @@ struct Conn
 	PROTOCOL_PART inState;
 	//ǰϵݵbody
 	bodySize_t inBodySize;
+	//ǰϵݵbodyѹ㷨
+	unsigned char inCompressType;
+	//ǰϵݵ
+	unsigned char inDataType;
+	//ǰbodyǷ񳬹ӦȣĲ棬ͷĵidʧ֮ܽ󵽴Ｔſ
+	bool bInOversize;
+	//ӦȵbodyĵǷѽ
+	bool bInOversizeFailed;
+	//ǰƬķƬͷǷѶƬݵＴevbufferƬ
+	bool bInFragmentHead;
+	//ǰƬķƬid
+	fragmentId_t inFragmentId;
+	//ǰƬǷΪ÷ƬidһƬ
+	bool bInFragmentLast;
+	//˷ʱʹõЭ汾յİ汾Э̻ظȷؽΪv1
+	unsigned char version;
 
 	//Ƿӳɹ
 	bool bConnected;
@@ -81,27 +170,60 @@ struct Conn
 	evutil_socket_t fd;
 	//ӶӦbuffer¼
 	bufferevent *pBufEv;
-	//Ψһid
-	UniqueIdGenerator<callId_t> idGen;
-	//е
-	map<callId_t, Call *> mapCall;
+	//дIOWorkerһô꣨дϲڵڣһbuffereventevbuffer
+	evbuffer *pPendingBuf;
+	//;ñidλid
+	SlabTable<Call> callTable;
+	//ȴӽضȵĵãӽյȺ˳򷢳
+	list<Call *> listWaitingCall;
+	//ʣضȣʱ1յӦ黹ʱӣδʱΪ
+	int credit;
+	//ǷضƣյĶȺΪtrueؽ
+	bool bCreditLimited;
+	//Ѱ󶨱ŵķmap<ָ, >ؽ
+	map<const google::protobuf::ServiceDescriptor *, uint32_t> mapServiceId;
 	//IOWorker
 	IOWorker *pWorker;
 	//ĵַ
 	sockaddr_in serverAddr;
+	//δķƬmap<Ƭid, evbuffer>ؽգ
+	//evbufferΪNULLʾ÷ƬidѶӦ󳤶ȣ֮ķƬＴſգһƬƳ
+	map<fragmentId_t, evbuffer *> mapFragment;
 
-	Conn()
+	Conn() : callTable(MAX_PENDING_CALL)
 	{
 		inState = PROTOCOL_HEAD;
 		inBodySize = 0;
+		inCompressType = COMPRESS_NONE;
+		inDataType = DATA_TYPE_RESPONSE;
+		bInOversize = false;
+		bInOversizeFailed = false;
+		bInFragmentHead = false;
+		inFragmentId = 0;
+		bInFragmentLast = false;
+		version = PROTOCOL_V1;
 		bConnected = false;
 		bConnectionMightLost = false;
+		credit = 0;
+		bCreditLimited = false;
 		pBufEv = NULL;
+		pPendingBuf = evbuffer_new();
 		pWorker = NULL;
 	}
+
+	~Conn()
+	{
+		if (NULL != pPendingBuf)
+			evbuffer_free(pPendingBuf);
+		for (auto it = mapFragment.begin(); it != mapFragment.end(); ++it)
+		{
+			if (NULL != it->second)
+				evbuffer_free(it->second);
+		}
+	}
 };
 
-//IO
+//IO񣬵òIO񣬶ͨIOWorkerύ
 struct IOTask
 {
 	//IOͶ
@@ -111,8 +233,12 @@ struct IOTask
 		CONNECT = 0, 
 		//Ͽ
 		DISCONNECT = 1, 
-		//
-		CALL = 2
+		//ȡ
+		CANCEL = 2, 
+		//黹
+		STREAM_CREDIT = 3, 
+		//Ϳͻʽõʽ֡
+		STREAM_FRAME = 4
 	};
 	//IO
 	IOTask::TYPE type;
@@ -125,4 +251,26 @@ struct IOTask
 	}
 };
 
+//黹ȵIO
+struct StreamCredit
+{
+	//ڵid
+	unsigned int connId;
+	//id
+	callId_t callId;
+	//
+	credit_t credit;
+};
+
+//ʽ֡IO
+struct StreamFrame
+{
+	//ڵid
+	unsigned int connId;
+	//id
+	callId_t callId;
+	//Эݣhead + bodyIOӵ
+	evbuffer *pBuf;
+};
+
 #endif
\ No newline at end of file
@@ -0,0 +1,184 @@
+#ifndef _RPCCOROUTINE_H_
+#define _RPCCOROUTINE_H_
+
+//C++20Э̿ͻ˽ӿڣֻͷļʹ÷C++20ʱſãRpcClientⱾҪC++20
+#if defined(__cpp_impl_coroutine) && defined(__has_include)
+#if __cpp_impl_coroutine >= 201902L && __has_include(<coroutine>)
+#define RPC_HAS_COROUTINE 1
+#endif
+#endif
+
+#ifdef RPC_HAS_COROUTINE
+
+#include <atomic>
+#include <coroutine>
+#include <exception>
+#include <google/protobuf/service.h>
+#include <google/protobuf/descriptor.h>
+#include "RpcController.h"
+
+//Э̵ִ÷غָȴõЭ
+class IRpcExecutor
+{
+public:
+	virtual ~IRpcExecutor() {}
+
+	/************************************************************************
+	  ܣЭִִ̽Լ߳еhandle.resume()IOWorker̵߳ã
+	  
+		handle룬ȴõЭ
+	ֵ
+	************************************************************************/
+	virtual void post(std::coroutine_handle<> handle) = 0;
+};
+
+//ȴһrpcõawaitablerpcCall()ֻco_awaitһ
+//1ǴCallMethod()ClosureλЭ֡УҪΪÿε÷Closure
+//2÷غִָЭִ̣ΪNULLʱֱIOWorker߳лָ
+//3CallMethod()ǰѽ緢ʧܣʱЭֱ̲ӼִУ
+//4ʱȡRpcControllerʱʱRpcController::setTimeout()
+//   ̵߳RpcController::StartCancel()ȡãЭ漴RPC_ERROR_CANCELEDʧָܻ
+class RpcCallAwaitable : private google::protobuf::Closure
+{
+public:
+	/************************************************************************
+	  ܣ췽rpcCall()
+	ֵ
+	************************************************************************/
+	RpcCallAwaitable(google::protobuf::RpcChannel *pChannel, const google::protobuf::MethodDescriptor *method,
+		RpcController *pController, const google::protobuf::Message *pRequest, google::protobuf::Message *pResponse,
+		IRpcExecutor *pExecutor, unsigned int timeoutMs)
+	{
+		m_pChannel = pChannel;
+		m_method = method;
+		m_pController = pController;
+		m_pRequest = pRequest;
+		m_pResponse = pResponse;
+		m_pExecutor = pExecutor;
+		m_timeoutMs = timeoutMs;
+		m_bArrived.store(false, std::memory_order_relaxed);
+	}
+
+	bool await_ready() const
+	{
+		return false;
+	}
+
+	/************************************************************************
+	  ܣòЭ
+	  
+		handle룬ǰЭ
+	ֵ
+		true𣬵÷غָ
+		falseѽ
+	************************************************************************/
+	bool await_suspend(std::coroutine_handle<> handle)
+	{
+		m_handle = handle;
+		//ʱʱֻڱεãCallMethod()ڵ߳оͰɽֹʱ䣬غָRpcControllerԭֵ
+		//ʱЭδָ÷RpcController
+		unsigned int prevTimeoutMs = m_pController->getTimeout();
+		if (m_timeoutMs > 0)
+			m_pController->setTimeout(m_timeoutMs);
+		m_pChannel->CallMethod(m_method, m_pController, m_pRequest, m_pResponse, this);
+		if (m_timeoutMs > 0)
+			m_pController->setTimeout(prevTimeoutMs);
+		//Run()󵽵һָЭ
+		return !m_bArrived.exchange(true, std::memory_order_acq_rel);
+	}
+
+	/************************************************************************
+	  ܣЭָ̻ȡýʧԭRpcController
+	  
+	ֵ
+		trueóɹ
+		falseʧ
+	************************************************************************/
+	bool await_resume() const
+	{
+		return !m_pController->Failed();
+	}
+
+private:
+	//÷أIOWorkeṛ߳ʧʱڵִ̣߳
+	void Run()
+	{
+		//await_suspend()δأЭִ̼
+		if (!m_bArrived.exchange(true, std::memory_order_acq_rel))
+			return;
+		//ָЭ֡󣩿٣֮ٷʳԱ
+		std::coroutine_handle<> handle = m_handle;
+		IRpcExecutor *pExecutor = m_pExecutor;
+		if (NULL != pExecutor)
+			pExecutor->post(handle);
+		else
+			handle.resume();
+	}
+
+	google::protobuf::RpcChannel *m_pChannel;
+	const google::protobuf::MethodDescriptor *m_method;
+	RpcController *m_pController;
+	const google::protobuf::Message *m_pRequest;
+	google::protobuf::Message *m_pResponse;
+	IRpcExecutor *m_pExecutor;
+	unsigned int m_timeoutMs;
+	//ȴõЭ
+	std::coroutine_handle<> m_handle;
+	//await_suspend()Run()ȵһλ
+	std::atomic<bool> m_bArrived;
+};
+
+/************************************************************************
+  ܣȴrpcõawaitable÷bool bOk = co_await rpcCall(pChannel, pMethod, &controller, &req, &resp);
+  
+	pChannel룬ͨһΪIRpcChannelָ
+	method룬Service::descriptor()->FindMethodByName("add")
+	pController룬RpcControllerָ룬ڻȡʧԭóʱȡã÷ǰ
+	pRequest룬󣬵÷ǰ
+	pResponseӦ÷ǰ
+	pExecutor룬ָЭ̵ִĬΪNULLʾIOWorker߳лָʱЭ̲ӦִкʱĲ
+	timeoutMs룬εõĳʱʱ䣬λΪ룬RpcControllerϣĬΪ0ʾʹRpcControllerõĻͨĬϳʱʱ
+ֵawaitable
+************************************************************************/
+inline RpcCallAwaitable rpcCall(google::protobuf::RpcChannel *pChannel, const google::protobuf::MethodDescriptor *method,
+	RpcController *pController, const google::protobuf::Message *pRequest, google::protobuf::Message *pResponse,
+	IRpcExecutor *pExecutor = NULL, unsigned int timeoutMs = 0)
+{
+	return RpcCallAwaitable(pChannel, method, pController, pRequest, pResponse, pExecutor, timeoutMs);
+}
+
+//򵥵Э̷ͣЭʼִУ٣߲ȴ
+//ҪȴЭ̽ʱЭԼڽǰִ֪ͨϵĻص
+struct RpcTask
+{
+	struct promise_type
+	{
+		RpcTask get_return_object()
+		{
+			return RpcTask();
+		}
+
+		std::suspend_never initial_suspend() noexcept
+		{
+			return std::suspend_never();
+		}
+
+		std::suspend_never final_suspend() noexcept
+		{
+			return std::suspend_never();
+		}
+
+		void return_void()
+		{
+		}
+
+		void unhandled_exception()
+		{
+			std::terminate();
+		}
+	};
+};
+
+#endif
+
+#endif
@@ -0,0 +1,153 @@
+#include "RpcFuture.h"
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/locks.hpp>
+#include <boost/thread/condition_variable.hpp>
+#include <boost/thread/thread.hpp>
+
+//future״̬δ˵ȴ
+#define FUTURE_PENDING ((uintptr_t)0)
+//future״̬ѷ
+#define FUTURE_READY ((uintptr_t)1)
+
+//futureõĵȴߣλڵȴ̵߳ջ
+//1÷ʱfutureϵǼ˵ȴߣIOWorker߳ڳڼ֪ͨ
+//2ȴ̷߳ǰȡһ˷ʱIOWorker߳Ѳٷʱ
+struct RpcFutureWaiter
+{
+	boost::mutex mutex;
+	boost::condition_variable cond;
+	//ѷصĵǼǹĵ
+	unsigned int arrived;
+	//ﵽʱѵȴ߳
+	unsigned int target;
+
+	RpcFutureWaiter()
+	{
+		arrived = 0;
+		target = 0;
+	}
+
+	//Ǽǹĵ÷أIOWorker̵߳
+	void arrive()
+	{
+		boost::lock_guard<boost::mutex> lock(mutex);
+		//ֻڴﵽĿʱ֪ͨһΣȴ̲߳ᱻÿøһ
+		if (++arrived == target)
+			cond.notify_one();
+	}
+
+	//ȴѷصĵǼǹĵﵽcount
+	void waitFor(unsigned int count)
+	{
+		boost::unique_lock<boost::mutex> lock(mutex);
+		target = count;
+		while (arrived < count)
+			cond.wait(lock);
+	}
+};
+
+RpcFuture::RpcFuture()
+{
+	m_state.store(FUTURE_READY);
+}
+
+RpcFuture::~RpcFuture()
+{
+	wait();
+}
+
+google::protobuf::Closure *RpcFuture::start()
+{
+	m_state.store(FUTURE_PENDING, std::memory_order_relaxed);
+	return this;
+}
+
+bool RpcFuture::isReady() const
+{
+	return FUTURE_READY == m_state.load(std::memory_order_acquire);
+}
+
+void RpcFuture::wait()
+{
+	RpcFuture *pThis = this;
+	waitAll(&pThis, 1);
+}
+
+void RpcFuture::Run()
+{
+	//Ϊѷغûfuture֮ٷʳԱ
+	uintptr_t state = m_state.exchange(FUTURE_READY, std::memory_order_acq_rel);
+	if (FUTURE_PENDING != state && FUTURE_READY != state)
+		((RpcFutureWaiter *)state)->arrive();
+}
+
+void RpcFuture::waitAll(RpcFuture *const *ppFuture, unsigned int num)
+{
+	RpcFutureWaiter waiter;
+	unsigned int registered = 0;
+	for (unsigned int i = 0; i < num; ++i)
+	{
+		//δصfutureϵǼǵȴߣѷصĲҪȴ
+		uintptr_t expected = FUTURE_PENDING;
+		if (ppFuture[i]->m_state.compare_exchange_strong(expected, (uintptr_t)&waiter, std::memory_order_acq_rel))
+			++registered;
+	}
+	if (registered > 0)
+		waiter.waitFor(registered);
+}
+
+unsigned int RpcFuture::waitAny(RpcFuture *const *ppFuture, unsigned int num)
+{
+	for (unsigned int i = 0; i < num; ++i)
+	{
+		if (ppFuture[i]->isReady())
+			return i;
+	}
+	if (0 == num)
+		return num;
+
+	RpcFutureWaiter waiter;
+	unsigned int registered = 0;
+	bool bReady = false;
+	for (unsigned int i = 0; i < num && !bReady; ++i)
+	{
+		uintptr_t expected = FUTURE_PENDING;
+		if (ppFuture[i]->m_state.compare_exchange_strong(expected, (uintptr_t)&waiter, std::memory_order_acq_rel))
+			++registered;
+		else
+			//Ǽڼе÷أٵȴ
+			bReady = true;
+	}
+	if (!bReady)
+		waiter.waitFor(1);
+
+	//ǼǣǼֻڵһʧʱֹͣԵǼǹǰregisteredfuture
+	//ʧܵfutureѷأIOWorker̻߳ᣨѾʵȴߣ
+	unsigned int mustArrive = 0;
+	for (unsigned int i = 0; i < registered; ++i)
+	{
+		uintptr_t expected = (uintptr_t)&waiter;
+		if (!ppFuture[i]->m_state.compare_exchange_strong(expected, FUTURE_PENDING, std::memory_order_acq_rel)
+			&& FUTURE_READY == expected)
+			++mustArrive;
+	}
+	waiter.waitFor(mustArrive);
+
+	for (unsigned int i = 0; i < num; ++i)
+	{
+		if (ppFuture[i]->isReady())
+			return i;
+	}
+	return num;
+}
+
+void RpcFuture::waitAll(const std::vector<RpcFuture *> &vecFuture)
+{
+	if (!vecFuture.empty())
+		waitAll(&vecFuture[0], vecFuture.size());
+}
+
+unsigned int RpcFuture::waitAny(const std::vector<RpcFuture *> &vecFuture)
+{
+	return vecFuture.empty() ? 0 : waitAny(&vecFuture[0], vecFuture.size());
+}
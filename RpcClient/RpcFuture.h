@@ -0,0 +1,102 @@
+#ifndef _RPCFUTURE_H_
+#define _RPCFUTURE_H_
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+#include <google/protobuf/service.h>
+
+#ifdef WIN32
+#ifdef RPCCLIENT_EXPORTS
+#define RPCCLIENT_DLL_EXPORTS __declspec(dllexport)
+#else
+#define RPCCLIENT_DLL_EXPORTS __declspec(dllimport)
+#endif
+#else
+#define RPCCLIENT_DLL_EXPORTS
+#endif
+
+struct RpcFutureWaiter;
+
+//첽õfutureûջϻУΪÿε÷ڴ
+//1start()شCallMethod()stubClosure÷ʱIOWorkerͨɣ첽ͬһص㣻
+//2ýûRpcControllerӦУfutureֻʾǷѷأ
+//3waitAll()waitAny()Ϊfutureֻһȴߣֻ߳ȫһ÷ʱһΣ
+//   ÿøһΣ
+//4ͬһʱֻһ̵߳ȴͬһfuturefutureڵ÷ǰʱȴ÷ء
+class RPCCLIENT_DLL_EXPORTS RpcFuture : private google::protobuf::Closure
+{
+public:
+	/************************************************************************
+	  ܣ췽½future״̬
+	  
+	ֵ
+	************************************************************************/
+	RpcFuture();
+
+	/************************************************************************
+	  ܣδʱȴ䷵
+	  
+	ֵ
+	************************************************************************/
+	~RpcFuture();
+
+	/************************************************************************
+	  ܣʼһεã÷stub.add(&controller, &req, &resp, future.start());
+	  
+	ֵCallMethod()done÷ǰfutureٴstart()
+	************************************************************************/
+	google::protobuf::Closure *start();
+
+	/************************************************************************
+	  ܣǷѷأ̵߳
+	  
+	ֵ
+		trueѷ
+		falseδ
+	************************************************************************/
+	bool isReady() const;
+
+	/************************************************************************
+	  ܣȴ÷
+	  
+	ֵ
+	************************************************************************/
+	void wait();
+
+	/************************************************************************
+	  ܣȴе÷أ߳౻һ
+	  
+		ppFuture룬futureָ
+		num룬鳤
+	ֵ
+	************************************************************************/
+	static void waitAll(RpcFuture *const *ppFuture, unsigned int num);
+
+	/************************************************************************
+	  ܣȴһ÷أ߳౻һ
+	  
+		ppFuture룬futureָ
+		num룬鳤
+	ֵѷصfuture±꣬Ϊʱnum
+	************************************************************************/
+	static unsigned int waitAny(RpcFuture *const *ppFuture, unsigned int num);
+
+	/************************************************************************
+	  ܣwaitAll()waitAny()vector汾
+	************************************************************************/
+	static void waitAll(const std::vector<RpcFuture *> &vecFuture);
+	static unsigned int waitAny(const std::vector<RpcFuture *> &vecFuture);
+
+private:
+	RpcFuture(const RpcFuture &);
+	RpcFuture &operator=(const RpcFuture &);
+
+	//÷أIOWorkeṛ߳ʧʱڵִ̣߳
+	void Run();
+
+	//״̬FUTURE_PENDINGʾδ˵ȴFUTURE_READYʾѷأֵΪȴָ
+	std::atomic<uintptr_t> m_state;
+};
+
+#endif
@@ -0,0 +1,72 @@
+#ifndef _SYNCWAITER_H_
+#define _SYNCWAITER_H_
+
+#include <atomic>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/locks.hpp>
+#include <boost/thread/condition_variable.hpp>
+
+//ͬȴǰɱǵĴͬڵĵóڼѷأʡȥһ˯ߺͻ
+#define SYNC_WAITER_SPIN_COUNT 4000
+
+//ͬõĵȴߣÿͬһڵ̵߳ջ
+//1߳ͨwait()ֱIOWorker̵߳wake()
+//2ÿֻԼĵȴߣ߳̿ͬһRpcChannelϲͬã
+//3wake()ڳڼλ֪ͨwait()ǰȡһ
+//   wait()ʱwake()Ѳٷʱ󣬵߳̿ٵȴߡ
+class SyncWaiter
+{
+public:
+	/************************************************************************
+	  ܣ췽
+	  
+	ֵ
+	************************************************************************/
+	SyncWaiter()
+	{
+		m_bDone.store(false);
+	}
+
+	/************************************************************************
+	  ܣȴֱwake()ãȶ˯
+	  
+	ֵ
+	************************************************************************/
+	void wait()
+	{
+		for (unsigned int i = 0; i < SYNC_WAITER_SPIN_COUNT; ++i)
+		{
+			if (m_bDone.load(std::memory_order_acquire))
+				break;
+		}
+
+		boost::unique_lock<boost::mutex> lock(m_mutex);
+		while (!m_bDone.load(std::memory_order_acquire))
+			m_cond.wait(lock);
+	}
+
+	/************************************************************************
+	  ܣѵȴߣ̵߳
+	  
+	ֵ
+	************************************************************************/
+	void wake()
+	{
+		boost::lock_guard<boost::mutex> lock(m_mutex);
+		m_bDone.store(true, std::memory_order_release);
+		m_cond.notify_one();
+	}
+
+private:
+	SyncWaiter(const SyncWaiter &);
+	SyncWaiter &operator=(const SyncWaiter &);
+
+	//Ƿ
+	std::atomic<bool> m_bDone;
+	//
+	boost::mutex m_mutex;
+	//ȴɵ
+	boost::condition_variable m_cond;
+};
+
+#endif
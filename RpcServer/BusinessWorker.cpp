@@ -1,25 +1,80 @@
 #include "BusinessWorker.h"
+#include "BusinessWorkerPool.h"
 #include "IOWorker.h"
+#include "ProtocolCodec.h"
 
-BusinessWorker::BusinessWorker(unsigned int queueMaxSize)
+//ʵֵdoneҵArena
+//غdone£˭˭Ӧ
+//1doneڷǰãͬɣɵ÷̱߳Ӧ
+//2doneڷغ󱻵ã첽ɣɵdone̱߳Ӧ黹Arenaҵ񽻸IOWorker
+class TaskDone : public google::protobuf::Closure
 {
-	m_bEnded = false;
-	m_pMapRegisteredService = NULL;
-	m_queue.setMaxSize(queueMaxSize);
-	m_queue.setWait(true);
-}
+public:
+	TaskDone(BusinessTask *pTask, google::protobuf::Message *pResp, TaskArena *pTaskArena, BusinessWorkerPool *pPool)
+	{
+		m_pTask = pTask;
+		m_pResp = pResp;
+		m_pTaskArena = pTaskArena;
+		m_pPool = pPool;
+		m_bOneSide.store(false);
+	}
 
-BusinessWorker::~BusinessWorker()
+	TaskController *getController()
+	{
+		return &m_controller;
+	}
+
+	/************************************************************************
+	  ܣǷѷأɵ÷̵߳
+	  
+	ֵ
+		truedoneѱã÷̸߳Ӧ
+		falsedoneδãӦ֮done̸߳
+	************************************************************************/
+	bool markReturned()
+	{
+		return m_bOneSide.exchange(true);
+	}
+
+	virtual void Run()
+	{
+		//δأɵ÷̱߳Ӧ
+		if (!m_bOneSide.exchange(true))
+			return;
+
+		//Arenaϣ黹ArenaٷʳԱȡֲ
+		BusinessTask *pTask = m_pTask;
+		TaskArena *pTaskArena = m_pTaskArena;
+		BusinessWorkerPool *pPool = m_pPool;
+		BusinessWorker::encodeTask(pTask, *m_pResp, m_controller);
+		//עҵWorkerؿ漴٣֮ٷ
+		pPool->completePending(pTaskArena);
+		BusinessWorker::completeTask(pTask);
+	}
+
+private:
+	//ҵָ
+	BusinessTask *m_pTask;
+	//Σm_pTaskArena
+	google::protobuf::Message *m_pResp;
+	//ҵArena첽ʱɱ黹
+	TaskArena *m_pTaskArena;
+	//ҵWorkerָ
+	BusinessWorkerPool *m_pPool;
+	//ʵֵRpcControllerʽʱз
+	TaskController m_controller;
+	//ءdoneǷһ
+	std::atomic<bool> m_bOneSide;
+};
+
+BusinessWorker::BusinessWorker(unsigned int queueMaxSize, BusinessWorkerPool *pPool) : m_queue(queueMaxSize)
 {
-	m_bEnded = true;
-	m_queue.stop();
-	//ȴ߳̽
-	m_thd.join();
+	m_pPool = pPool;
 }
 
-void BusinessWorker::setRegisteredServices(const map<string, pair<google::protobuf::Service *, vector<const google::protobuf::MethodDescriptor *> > > *pMapRegisteredService)
+BusinessWorker::~BusinessWorker()
 {
-	m_pMapRegisteredService = pMapRegisteredService;
+	join();
 }
 
 void BusinessWorker::start()
@@ -28,149 +83,178 @@ void BusinessWorker::start()
 	m_thd = std::move(boost::thread(&BusinessWorker::threadMain, this));
 }
 
-unsigned int BusinessWorker::getBusyLevel()
+void BusinessWorker::join()
 {
-	return m_queue.getSize();
+	//ȴ߳̽
+	if (m_thd.joinable())
+		m_thd.join();
 }
 
 void BusinessWorker::threadMain()
 {
-	while (!m_bEnded)
+	if (NULL == m_pPool)
+		return;
+
+	BusinessTask *arrTask[TASK_BATCH_SIZE];
+	//ÿķΡζҵWorkerǰArenaϷ䣬һǰͷ
+	TaskArena *pTaskArena = m_pPool->acquireArena();
+	//ҵWorkerؽʱ˳߳
+	while (!m_pPool->isStopped())
 	{
-		//ΪһԴӶȡҵָ
-		list<BusinessTask *> queue;
-		m_queue.takeAll(queue);
+		//ȴԼĶȡҵָ
+		unsigned int count = m_queue.takeBatch(arrTask, TASK_BATCH_SIZE);
+		//ԼĶΪգȡҵWorker
+		if (0 == count)
+			count = m_pPool->steal(this, arrTask, TASK_BATCH_SIZE);
+		//жжΪգ˯ߵȴµ
+		if (0 == count)
+		{
+			m_pPool->waitForTask();
+			continue;
+		}
 
-		for (auto it = queue.begin(); it != queue.end(); ++it)
+		for (unsigned int i = 0; i < count; ++i)
 		{
 			cout << "business thread " << boost::this_thread::get_id() << " begins handling task..." << endl;
 
-			BusinessTask *pTask = *it;
-			//ҵָָ󶨣֪ͨIOWorkerԶִ
-			unique_ptr<BusinessTask, function<void(BusinessTask *)> > ptrMonitor(pTask, [](BusinessTask *pTask) {
-				if (NULL == pTask)
-					return;
-				if (NULL == pTask->pWorker)
-					return;
-				//ҵָӦIOWorkerwriteУҷŲɹһֱȴ
-				while (!pTask->pWorker->m_writeQueue.put(pTask)) {}
-				//֪ͨӦIOWorker
-				char buf[1] = { NOTIFY_IOWORKER_WRITE };
-				send(pTask->pWorker->getNotify_fd(), buf, 1, 0);
-			});
-
-			if (NULL == pTask)
-				continue;
-			if (NULL == pTask->pBuf)
+			BusinessTask *pTask = arrTask[i];
+			//ͷһArenaϷMessage
+			pTaskArena->arena.Reset();
+			TASK_STATE state = handleTask(pTask, pTaskArena, m_pPool);
+			//δɣdoneڱʱҵ񽻸IOWorker
+			if (TASK_STATE_PENDING == state)
 				continue;
+			if (TASK_STATE_DONE == state)
+				cout << "business thread " << boost::this_thread::get_id() << " finishes handling task." << endl;
+			completeTask(pTask);
+		}
+	}
+	m_pPool->releaseArena(pTaskArena);
+}
 
-			if (NULL == m_pMapRegisteredService)
-			{
-				//ͷevbuffer
-				evbuffer_free(pTask->pBuf);
-				pTask->pBuf = NULL;
-				continue;
-			}
-
-			//ȡЭbody
-			bodySize_t len = evbuffer_get_length(pTask->pBuf);
-			//лЭbody
-			ProtocolBodyRequest bodyReq;
-			if (!bodyReq.ParseFromArray(evbuffer_pullup(pTask->pBuf, len), len))
-			{
-				evbuffer_free(pTask->pBuf);
-				pTask->pBuf = NULL;
-				continue;
-			}
-			//ͨҷϢ
-			auto itFind = m_pMapRegisteredService->find(bodyReq.servicename());
-			if (itFind == m_pMapRegisteredService->end())
-			{
-				evbuffer_free(pTask->pBuf);
-				pTask->pBuf = NULL;
-				continue;
-			}
-			//ȡָ
-			google::protobuf::Service *pService = itFind->second.first;
-			uint32_t index = bodyReq.methodindex();
-			if (NULL == pService || index >= itFind->second.second.size())
-			{
-				evbuffer_free(pTask->pBuf);
-				pTask->pBuf = NULL;
-				continue;
-			}
-			//ȡָ
-			const google::protobuf::MethodDescriptor *pMethodDescriptor = itFind->second.second[index];
-			if (NULL == pMethodDescriptor)
-			{
-				evbuffer_free(pTask->pBuf);
-				pTask->pBuf = NULL;
-				continue;
-			}
-			//Message
-			google::protobuf::Message *pReq = pService->GetRequestPrototype(pMethodDescriptor).New();
-			if (NULL == pReq)
-			{
-				evbuffer_free(pTask->pBuf);
-				pTask->pBuf = NULL;
-				continue;
-			}
-			//ķMessageָ󶨣ôķMessageԶ
-			unique_ptr<google::protobuf::Message> ptrReq(pReq);
-			//Message
-			google::protobuf::Message *pResp = pService->GetResponsePrototype(pMethodDescriptor).New();
-			if (NULL == pResp)
-			{
-				evbuffer_free(pTask->pBuf);
-				pTask->pBuf = NULL;
-				continue;
-			}
-			//ķMessageָ󶨣ôķMessageԶ
-			unique_ptr<google::protobuf::Message> ptrResp(pResp);
-			//ηл
-			if (!pReq->ParseFromString(bodyReq.content()))
-			{
-				evbuffer_free(pTask->pBuf);
-				pTask->pBuf = NULL;
-				continue;
-			}
-
-			//
-			RpcController controller;
-			pService->CallMethod(pMethodDescriptor, &controller, pReq, pResp, NULL);
-
-			//ӦЭbody
-			ProtocolBodyResponse bodyResp;
-			//õid˵idɿͻ˴άֻԭ
-			bodyResp.set_callid(bodyReq.callid());
-			//л
-			string content;
-			if (!pResp->SerializeToString(&content))
-			{
-				evbuffer_free(pTask->pBuf);
-				pTask->pBuf = NULL;
-				continue;
-			}
-			//лĳ
-			bodyResp.set_content(content);
-			//лӦЭbody
-			string strRet;
-			if (!bodyResp.SerializeToString(&strRet))
-			{
-				evbuffer_free(pTask->pBuf);
-				pTask->pBuf = NULL;
-				continue;
-			}
+TASK_STATE BusinessWorker::handleTask(BusinessTask *pTask, TaskArena *&pTaskArena, BusinessWorkerPool *pPool)
+{
+	if (NULL == pTaskArena || NULL == pPool)
+		return TASK_STATE_FAILED;
+	if (NULL == pTask)
+		return TASK_STATE_FAILED;
+	if (NULL == pTask->pBuf)
+		return TASK_STATE_FAILED;
 
-			evbuffer_free(pTask->pBuf);
-			//evbuffer
-			pTask->pBuf = evbuffer_new();
-			if (NULL == pTask->pBuf)
-				continue;
-			//лӦЭbodyevbuffer
-			evbuffer_add(pTask->pBuf, strRet.c_str(), strRet.size());
+	//IOWorkerŻҵ
+	const RequestView &view = pTask->view;
+	const RegisteredService *pRegisteredService = pTask->pService;
+	if (NULL == pRegisteredService || NULL == pRegisteredService->pService || view.methodIndex >= pRegisteredService->vecMethod.size())
+	{
+		evbuffer_free(pTask->pBuf);
+		pTask->pBuf = NULL;
+		return TASK_STATE_FAILED;
+	}
+	google::protobuf::Arena &arena = pTaskArena->arena;
+	//ȡָ
+	google::protobuf::Service *pService = pRegisteredService->pService;
+	//ȡָ
+	const google::protobuf::MethodDescriptor *pMethodDescriptor = pRegisteredService->vecMethod[view.methodIndex];
+	if (NULL == pMethodDescriptor)
+	{
+		evbuffer_free(pTask->pBuf);
+		pTask->pBuf = NULL;
+		return TASK_STATE_FAILED;
+	}
+	//ArenaϴMessageArena
+	google::protobuf::Message *pReq = pService->GetRequestPrototype(pMethodDescriptor).New(&arena);
+	if (NULL == pReq)
+	{
+		evbuffer_free(pTask->pBuf);
+		pTask->pBuf = NULL;
+		return TASK_STATE_FAILED;
+	}
+	//ArenaϴMessageArena
+	google::protobuf::Message *pResp = pService->GetResponsePrototype(pMethodDescriptor).New(&arena);
+	if (NULL == pResp)
+	{
+		evbuffer_free(pTask->pBuf);
+		pTask->pBuf = NULL;
+		return TASK_STATE_FAILED;
+	}
+	//ֱӴevbuffercontentڵڴ鷴л
+	if (!ProtocolCodec::parseFromEvbuffer(pTask->pBuf, view.contentOffset, view.contentSize, pReq))
+	{
+		evbuffer_free(pTask->pBuf);
+		pTask->pBuf = NULL;
+		return TASK_STATE_FAILED;
+	}
 
-			cout << "business thread " << boost::this_thread::get_id() << " finishes handling task." << endl;
-		}
+	//Arenaϴdoneʵʱ
+	TaskDone *pDone = google::protobuf::Arena::Create<TaskDone>(&arena, pTask, pResp, pTaskArena, pPool);
+	pDone->getController()->pStream = pTask->pStream;
+	//
+	pService->CallMethod(pMethodDescriptor, pDone->getController(), pReq, pResp, pDone);
+	//ʱdoneδã򷽷첽ɣArenadone̻߳һµArena
+	if (!pDone->markReturned())
+	{
+		pPool->addPending();
+		pTaskArena = pPool->acquireArena();
+		return TASK_STATE_PENDING;
 	}
+
+	//doneѱãڱ̱߳Ӧ
+	return encodeTask(pTask, *pResp, *pDone->getController()) ? TASK_STATE_DONE : TASK_STATE_FAILED;
+}
+
+bool BusinessWorker::encodeTask(BusinessTask *pTask, const google::protobuf::Message &resp, const google::protobuf::RpcController &controller)
+{
+	if (NULL == pTask || NULL == pTask->pBuf)
+		return false;
+
+	//꣬evbufferӦ
+	evbuffer_drain(pTask->pBuf, evbuffer_get_length(pTask->pBuf));
+	//ЭheadӦЭbodyֱӱ뵽evbufferԤڴУidɿͻ˴άֻԭ
+	//ʵ˴ʱӦֻϢ
+	//ʽENDERROR֡ӦβΪʱEND֡ͣʹķʵҲܰѽͻ
+	//ͻʽͨһظӦ
+	bool bOk;
+	if (0 == pTask->view.streamWindow && controller.Failed())
+		bOk = ProtocolCodec::encodeErrorResponse(pTask->pBuf, pTask->view.callId, controller.ErrorText(), pTask->version);
+	else if (0 == pTask->view.streamWindow)
+		bOk = ProtocolCodec::encodeResponse(pTask->pBuf, pTask->view.callId, resp, pTask->version);
+	else if (controller.Failed())
+	{
+		string strError = controller.ErrorText();
+		bOk = ProtocolCodec::encodeStreamFrame(pTask->pBuf, pTask->view.callId, STREAM_ERROR, NULL, &strError, pTask->version);
+	}
+	else
+		bOk = ProtocolCodec::encodeStreamFrame(pTask->pBuf, pTask->view.callId, STREAM_END, (resp.ByteSizeLong() > 0) ? &resp : NULL, NULL, pTask->version);
+	if (!bOk)
+	{
+		evbuffer_free(pTask->pBuf);
+		pTask->pBuf = NULL;
+		return false;
+	}
+	compressTask(pTask);
+	return true;
+}
+
+void BusinessWorker::compressTask(BusinessTask *pTask)
+{
+	//ͻ֧ѹӦ㹻ʱڱ߳ѹЭbodyѹʧܻûбСʱԭ
+	if (COMPRESS_NONE != pTask->compressType && NULL != pTask->pWorker && NULL != pTask->pBuf)
+	{
+		unsigned int threshold = pTask->pWorker->getCompressThreshold();
+		//headbodyȵЭݲֵȵbodyӦЭݣbodyͲСֵ
+		if (threshold > 0 && evbuffer_get_length(pTask->pBuf) >= ProtocolCodec::getHeadSize(pTask->version, threshold) + threshold)
+			ProtocolCodec::compressBody(pTask->pBuf, pTask->compressType);
+	}
+}
+
+void BusinessWorker::completeTask(BusinessTask *pTask)
+{
+	if (NULL == pTask)
+		return;
+	if (NULL == pTask->pWorker)
+		return;
+	//ҵָӦIOWorkerwriteУҷŲɹһֱȴ
+	while (!pTask->pWorker->m_writeQueue.put(pTask)) {}
+	//֪ͨӦIOWorkerIOWorkerл;ϵͳ
+	pTask->pWorker->notify();
 }
\ No newline at end of file
@@ -3,6 +3,8 @@
 
 #include "RpcServerGlobal.h"
 
+class BusinessWorkerPool;
+
 //ҵWorkerһ̣߳ллõȶ߳н
 class BusinessWorker
 {
@@ -10,10 +12,11 @@ public:
 	/************************************************************************
 	  ܣ췽
 	  
-		queueMaxSize룬ҵWorkerҵе󳤶
+		queueMaxSize룬ҵWorkerҵе󳤶ȣȡΪ2
+		pPool룬ҵWorkerָ
 	ֵ
 	************************************************************************/
-	BusinessWorker(unsigned int queueMaxSize);
+	BusinessWorker(unsigned int queueMaxSize, BusinessWorkerPool *pPool);
 
 	/************************************************************************
 	  ܣ
@@ -22,14 +25,6 @@ public:
 	************************************************************************/
 	~BusinessWorker();
 
-	/************************************************************************
-	  ܣעķ
-	  
-		pMapRegisteredService룬עķָ
-	ֵ
-	************************************************************************/
-	void setRegisteredServices(const map<string, pair<google::protobuf::Service *, vector<const google::protobuf::MethodDescriptor *> > > *pMapRegisteredService);
-	
 	/************************************************************************
 	  ܣҵWorker
 	  
@@ -38,14 +33,54 @@ public:
 	void start();
 
 	/************************************************************************
-	  ܣȡҵWorkerķæ̶ȣҵеĵǰȱʾæ̶
+	  ܣȴ̻߳̽߳ҵWorkerؽ˳
 	  
-	ֵҵWorkerķæ̶
+	ֵ
+	************************************************************************/
+	void join();
+
+	/************************************************************************
+	  ܣһҵ񣺷лΡ÷Ӧ뵽ҵevbuffer
+		ҵWorker߳еãִеķҲIOWorker߳е
+		ʵֿڷǰdoneͬɣҲȷأ̵֮߳done첽ɣ
+	  
+		pTaskҵָ룬ʧʱevbufferᱻͷŲΪNULL
+		pTaskArenaڷ䷽ΡεArena첽ʱArenadoneɴpPoolȡArena
+		pPool룬ҵWorkerָ
+	ֵΪTASK_STATE_PENDINGʱdoneúԶҵ񽻸IOWorker
+	************************************************************************/
+	static TASK_STATE handleTask(BusinessTask *pTask, TaskArena *&pTaskArena, BusinessWorkerPool *pPool);
+
+	/************************************************************************
+	  ܣҵ뷢IOWorkerwriteУ֪ͨIOWorker̵߳
+	  
+		pTask룬ҵָ
+	ֵ
+	************************************************************************/
+	static void completeTask(BusinessTask *pTask);
+
+	/************************************************************************
+	  ܣαΪӦҵevbufferУʽʱΪENDERROR֡
+	  
+		pTaskҵָ룬ʧʱevbufferᱻͷŲΪNULL
+		resp룬
+		controller룬ʵֵRpcControllerʽʱݴ˾Ƿʧܽ
+	ֵ
+		trueɹ
+		falseʧ
+	************************************************************************/
+	static bool encodeTask(BusinessTask *pTask, const google::protobuf::Message &resp, const google::protobuf::RpcController &controller);
+
+	/************************************************************************
+	  ܣͻ֧ѹЭݴﵽѹֵʱѹҵevbufferеЭbody
+	  
+		pTaskҵָ룬evbufferΪһЭ
+	ֵ
 	************************************************************************/
-	unsigned int getBusyLevel();
+	static void compressTask(BusinessTask *pTask);
 
-	//ҵ
-	SyncQueue<BusinessTask *> m_queue;
+	//ҵУΪIOWorkerΪҵWorkerȡҵWorker
+	RingQueue<BusinessTask *> m_queue;
 
 private:
 	/************************************************************************
@@ -57,10 +92,8 @@ private:
 	
 	//߳
 	boost::thread m_thd;
-	//Ƿ߳
-	bool m_bEnded;
-	//עķָ
-	const map<string, pair<google::protobuf::Service *, vector<const google::protobuf::MethodDescriptor *> > > *m_pMapRegisteredService;
+	//ҵWorkerָ
+	BusinessWorkerPool *m_pPool;
 };
 
 #endif
\ No newline at end of file
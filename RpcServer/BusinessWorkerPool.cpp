@@ -0,0 +1,164 @@
+#include "BusinessWorkerPool.h"
+#include "BusinessWorker.h"
+
+BusinessWorkerPool::BusinessWorkerPool(unsigned int workerNum, unsigned int queueMaxSize)
+{
+	m_dispatchCount.store(0);
+	m_idleNum.store(0);
+	m_bStopped.store(false);
+	m_pendingNum = 0;
+
+	for (unsigned int i = 0; i < workerNum; ++i)
+		m_vecWorker.push_back(new BusinessWorker(queueMaxSize, this));
+}
+
+BusinessWorkerPool::~BusinessWorkerPool()
+{
+	//˯ߵҵWorker
+	{
+		boost::unique_lock<boost::mutex> lock(m_mutex);
+		m_bStopped.store(true);
+		m_hasTask.notify_all();
+	}
+
+	//ҵWorker֮ụȡԱ̶߳󣬲ҵWorker
+	for (auto it = m_vecWorker.begin(); it != m_vecWorker.end(); ++it)
+		(*it)->join();
+	//첽ɵķdone黹ArenaǶú󣬲ҵWorker
+	{
+		boost::unique_lock<boost::mutex> lock(m_arenaMutex);
+		while (m_pendingNum > 0)
+			m_pendingDone.wait(lock);
+	}
+	for (auto it = m_vecWorker.begin(); it != m_vecWorker.end(); ++it)
+		SAFE_DELETE(*it)
+	for (auto it = m_vecIdleArena.begin(); it != m_vecIdleArena.end(); ++it)
+		SAFE_DELETE(*it)
+}
+
+void BusinessWorkerPool::start()
+{
+	for (auto it = m_vecWorker.begin(); it != m_vecWorker.end(); ++it)
+		(*it)->start();
+}
+
+bool BusinessWorkerPool::dispatch(BusinessTask *pTask)
+{
+	unsigned int workerNum = m_vecWorker.size();
+	if (0 == workerNum)
+		return false;
+
+	//ѡҵWorkerγһ
+	unsigned int begin = m_dispatchCount.fetch_add(1, std::memory_order_relaxed);
+	bool bPut = false;
+	for (unsigned int i = 0; i < workerNum && !bPut; ++i)
+		bPut = m_vecWorker[(begin + i) % workerNum]->m_queue.put(pTask);
+	if (!bPut)
+		return false;
+
+	//ֻҵWorker˯ʱżѣѵҵWorkerҪôԼҪôȡ
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if (m_idleNum.load(std::memory_order_relaxed) > 0)
+	{
+		boost::unique_lock<boost::mutex> lock(m_mutex);
+		m_hasTask.notify_one();
+	}
+	return true;
+}
+
+unsigned int BusinessWorkerPool::steal(BusinessWorker *pThief, BusinessTask **pArr, unsigned int maxCount)
+{
+	unsigned int workerNum = m_vecWorker.size();
+	//ȡߵһҵWorkerʼңȡ߶ͬһҵWorker
+	unsigned int begin = 0;
+	for ( ; begin < workerNum; ++begin)
+	{
+		if (m_vecWorker[begin] == pThief)
+			break;
+	}
+	for (unsigned int i = 1; i <= workerNum; ++i)
+	{
+		BusinessWorker *pVictim = m_vecWorker[(begin + i) % workerNum];
+		if (pVictim == pThief)
+			continue;
+		//ÿȡԷһ
+		unsigned int size = pVictim->m_queue.getSize();
+		if (size <= 0)
+			continue;
+		unsigned int count = pVictim->m_queue.tryTakeBatch(pArr, min(maxCount, (size + 1) / 2));
+		if (count > 0)
+			return count;
+	}
+	return 0;
+}
+
+void BusinessWorkerPool::waitForTask()
+{
+	boost::unique_lock<boost::mutex> lock(m_mutex);
+	//˯ߣټһжУɷ֮䶪ʧ
+	m_idleNum.fetch_add(1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if (!m_bStopped.load() && !hasTask())
+		m_hasTask.wait(lock);
+	m_idleNum.fetch_sub(1, std::memory_order_relaxed);
+}
+
+bool BusinessWorkerPool::hasTask()
+{
+	for (auto it = m_vecWorker.begin(); it != m_vecWorker.end(); ++it)
+	{
+		if ((*it)->m_queue.getSize() > 0)
+			return true;
+	}
+	return false;
+}
+
+bool BusinessWorkerPool::isStopped()
+{
+	return m_bStopped.load();
+}
+
+TaskArena *BusinessWorkerPool::acquireArena()
+{
+	{
+		boost::unique_lock<boost::mutex> lock(m_arenaMutex);
+		if (!m_vecIdleArena.empty())
+		{
+			TaskArena *pTaskArena = m_vecIdleArena.back();
+			m_vecIdleArena.pop_back();
+			return pTaskArena;
+		}
+	}
+	return new TaskArena();
+}
+
+void BusinessWorkerPool::releaseArena(TaskArena *pTaskArena)
+{
+	if (NULL == pTaskArena)
+		return;
+	//ͷArenaϷMessage
+	pTaskArena->arena.Reset();
+	{
+		boost::unique_lock<boost::mutex> lock(m_arenaMutex);
+		if (m_vecIdleArena.size() < ARENA_POOL_MAX_IDLE)
+		{
+			m_vecIdleArena.push_back(pTaskArena);
+			return;
+		}
+	}
+	delete pTaskArena;
+}
+
+void BusinessWorkerPool::addPending()
+{
+	boost::unique_lock<boost::mutex> lock(m_arenaMutex);
+	++m_pendingNum;
+}
+
+void BusinessWorkerPool::completePending(TaskArena *pTaskArena)
+{
+	releaseArena(pTaskArena);
+	boost::unique_lock<boost::mutex> lock(m_arenaMutex);
+	if (0 == --m_pendingNum)
+		m_pendingDone.notify_all();
+}
\ No newline at end of file
@@ -0,0 +1,136 @@
+#ifndef _BUSINESSWORKERPOOL_H_
+#define _BUSINESSWORKERPOOL_H_
+
+#include "RpcServerGlobal.h"
+
+class BusinessWorker;
+
+//ҵWorkerأɷҵ񣬲ÿеҵWorkerӷæҵWorkerȡ
+//1ɷʱѡҵWorkerɨҵWorkerķæ̶ȣ
+//2ÿҵWorkerȴԼеԼΪʱȡҵWorkerе
+//3ҵWorkerҲʱ˯ߣɷֻҵWorker˯ʱżѡ
+class BusinessWorkerPool
+{
+public:
+	/************************************************************************
+	  ܣ췽
+	  
+		workerNum룬ҵWorker
+		queueMaxSize룬ÿҵWorkerҵе󳤶ȣȡΪ2
+	ֵ
+	************************************************************************/
+	BusinessWorkerPool(unsigned int workerNum, unsigned int queueMaxSize);
+
+	/************************************************************************
+	  ܣҵWorkeṛ߳ٵȴ첽ɵķdoneҵWorker
+	  
+	ֵ
+	************************************************************************/
+	~BusinessWorkerPool();
+
+	/************************************************************************
+	  ܣҵWorker
+	  
+	ֵ
+	************************************************************************/
+	void start();
+
+	/************************************************************************
+	  ܣɷҵ񣬿̵߳
+	  
+		pTask룬ҵָ
+	ֵ
+		trueɷɹ
+		falseҵWorkerĶжɷʧ
+	************************************************************************/
+	bool dispatch(BusinessTask *pTask);
+
+	/************************************************************************
+	  ܣҵWorkerĶȡҵ
+	  
+		pThief룬ȡҵWorkerָ
+		pArrȡҵָ
+		maxCount룬ȡĸ
+	ֵʵȡĸ
+	************************************************************************/
+	unsigned int steal(BusinessWorker *pThief, BusinessTask **pArr, unsigned int maxCount);
+
+	/************************************************************************
+	  ܣҵWorkerĶжΪʱ˯ߣֱµҵɷҵWorkerؽ
+	  
+	ֵ
+	************************************************************************/
+	void waitForTask();
+
+	/************************************************************************
+	  ܣҵWorkerǷѾ
+	  
+	ֵ
+		trueѾ
+		falseδ
+	************************************************************************/
+	bool isStopped();
+
+	/************************************************************************
+	  ܣȡһеArenaûпе½̵߳
+	  
+	ֵArenaָ
+	************************************************************************/
+	TaskArena *acquireArena();
+
+	/************************************************************************
+	  ܣ黹Arena̵߳ãеArenaʱֱ
+	  
+		pTaskArena룬Arenaָ
+	ֵ
+	************************************************************************/
+	void releaseArena(TaskArena *pTaskArena);
+
+	/************************************************************************
+	  ܣǼһ첽ɵķdoneArenaҵWorkerǰҪ黹̵߳
+	  
+	ֵ
+	************************************************************************/
+	void addPending();
+
+	/************************************************************************
+	  ܣ첽ɵķdone黹Arenaע̵߳
+	  
+		pTaskArena룬doneߵArenaָ
+	ֵ
+	************************************************************************/
+	void completePending(TaskArena *pTaskArena);
+
+private:
+	/************************************************************************
+	  ܣжǷҵWorkerĶзǿ
+	  
+	ֵ
+		trueҵ
+		falseûҵ
+	************************************************************************/
+	bool hasTask();
+
+	//ҵWorkervector<ҵWorkerָ>
+	vector<BusinessWorker *> m_vecWorker;
+	//ɷҵʱѡҵWorkerļ
+	std::atomic<unsigned int> m_dispatchCount;
+	//˯߻򼴽˯ߵҵWorker
+	std::atomic<unsigned int> m_idleNum;
+	//ҵWorkerǷѾ
+	std::atomic<bool> m_bStopped;
+	//ֻҵWorker˯ߡ
+	boost::mutex m_mutex;
+	//ҵ
+	boost::condition_variable m_hasTask;
+	//еArena첽ɵķҵWorkerArenaҵWorkerٴﻻһ
+	vector<TaskArena *> m_vecIdleArena;
+	//ֻڱеArenaδdoneķ
+	boost::mutex m_arenaMutex;
+	//첽ɡδdoneķdoneڵǼǱãԶΪ
+	int m_pendingNum;
+	//δdoneķdoneʱϱ
+	boost::condition_variable m_pendingDone;
+};
+
+#endif
\ No newline at end of file
@@ -1,68 +1,161 @@
 #include "IOWorker.h"
+#include "BusinessWorker.h"
+#include "Compressor.h"
+#include "ServerStream.h"
 
-IOWorker::IOWorker(evutil_socket_t *fds, unsigned int acceptQueueMaxSize, unsigned int completeQueueMaxSize, const vector<BusinessWorker *> *pVecBusinessWorker)
+IOWorker::IOWorker(unsigned int acceptQueueMaxSize, unsigned int completeQueueMaxSize, BusinessWorkerPool *pBusinessWorkerPool) : m_writeQueue(completeQueueMaxSize)
 {
-	m_notified_fd = fds[0];
-	m_notify_fd = fds[1];
-	m_pVecBusinessWorker = pVecBusinessWorker;
+	m_bEndNotified.store(false);
+	m_listen_fd = -1;
+	m_listenBacklog = -1;
+	m_pBusinessWorkerPool = pBusinessWorkerPool;
+	m_pMapRegisteredService = NULL;
+	m_pTaskArena = new TaskArena();
 	m_pEvBase = NULL;
 	m_connNum = 0;
+	m_connWindow = 0;
+	m_compressThreshold = 0;
+	m_fragmentSize = 0;
+	m_pRetryEv = NULL;
+	m_retryInterval.tv_sec = DISPATCH_RETRY_USEC / 1000000;
+	m_retryInterval.tv_usec = DISPATCH_RETRY_USEC % 1000000;
 	m_bStarted = false;
+	m_bStartDone = false;
+	m_bStartOk = false;
 	m_bEnded = false;
 	m_acceptQueue.setMaxSize(acceptQueueMaxSize);
-	m_writeQueue.setMaxSize(completeQueueMaxSize);
 }
 
 IOWorker::~IOWorker()
 {
 	//֪ͨIOWorker¼ѭ
-	char buf[1] = { NOTIFY_IOWORKER_END };
-	send(m_notify_fd, buf, 1, 0);
+	m_bEndNotified.store(true);
+	m_notifier.notify();
 	//ȴ߳̽
 	m_thd.join();
-	//رsocketpairĶ
-	evutil_closesocket(m_notified_fd);
+	//رδevconnlistenerļ׽
+	if (m_listen_fd >= 0)
+		evutil_closesocket(m_listen_fd);
+	SAFE_DELETE(m_pTaskArena)
 }
 
-void IOWorker::start()
+void IOWorker::setListenFd(evutil_socket_t listen_fd, int backlog)
+{
+	m_listen_fd = listen_fd;
+	m_listenBacklog = backlog;
+}
+
+void IOWorker::setRegisteredServices(const map<string, RegisteredService> *pMapRegisteredService)
+{
+	m_pMapRegisteredService = pMapRegisteredService;
+}
+
+void IOWorker::setConnWindow(unsigned int connWindow)
+{
+	m_connWindow = connWindow;
+}
+
+void IOWorker::setCompressThreshold(unsigned int compressThreshold)
+{
+	m_compressThreshold = compressThreshold;
+}
+
+unsigned int IOWorker::getCompressThreshold()
+{
+	return m_compressThreshold;
+}
+
+void IOWorker::setFragmentSize(unsigned int fragmentSize)
+{
+	m_fragmentSize = fragmentSize;
+}
+
+bool IOWorker::start()
 {
 	//IOWorkerظ
-	if (m_bStarted)
-		return;
-	m_bStarted = true;
+	if (!m_bStarted)
+	{
+		m_bStarted = true;
+		//߳
+		m_thd = std::move(boost::thread(&IOWorker::threadMain, this));
+	}
 
-	//߳
-	m_thd = std::move(boost::thread(&IOWorker::threadMain, this, m_notified_fd));
+	//ȴ߳ɳʼ
+	boost::unique_lock<boost::mutex> lock(m_startMutex);
+	while (!m_bStartDone)
+		m_startCond.wait(lock);
+	return m_bStartOk;
 }
 
-void IOWorker::threadMain(evutil_socket_t notified_fd)
+void IOWorker::reportStarted(bool bOk)
 {
+	boost::lock_guard<boost::mutex> lock(m_startMutex);
+	m_bStartDone = true;
+	m_bStartOk = bOk;
+	m_startCond.notify_all();
+}
+
+void IOWorker::threadMain()
+{
+	if (!m_notifier.isValid())
+	{
+		reportStarted(false);
+		return;
+	}
 	//event_base
 	event_base *pEvBase = event_base_new();
 	if (NULL == pEvBase)
 	{
-		evutil_closesocket(notified_fd);
+		reportStarted(false);
 		return;
 	}
-	//event_baseָ󶨣ôevent_baseԶٲͷԴ
-	unique_ptr<event_base, function<void(event_base *)> > ptrEvBase(pEvBase, [&notified_fd](event_base *p) {
-		event_base_free(p);
-		//رsocketpairĶ
-		evutil_closesocket(notified_fd);
-	});
+	//event_baseָ󶨣ôevent_baseԶ
+	unique_ptr<event_base, function<void(event_base *)> > ptrEvBase(pEvBase, event_base_free);
 
-	//socketpairĶϵĿɶ¼
-	event *pNotifiedEv = event_new(pEvBase, notified_fd, EV_READ | EV_PERSIST, notifiedCallback, this);
+	//֪ͨϵĿɶ¼
+	event *pNotifiedEv = event_new(pEvBase, m_notifier.getFd(), EV_READ | EV_PERSIST, notifiedCallback, this);
 	if (NULL == pNotifiedEv)
+	{
+		reportStarted(false);
 		return;
+	}
 	//¼ָ󶨣ô¼Զ
 	unique_ptr<event, function<void(event *)> > ptrNotifiedEv(pNotifiedEv, event_free);
 
-	//socketpairĶϵĿɶ¼Ϊδ
+	//֪ͨϵĿɶ¼Ϊδ
 	if (0 != event_add(pNotifiedEv, NULL))
+	{
+		reportStarted(false);
+		return;
+	}
+
+	//SO_REUSEPORTģʽ£ڱIOWorkerevent_baselistenacceptaccept󽫻صacceptCallback()
+	unique_ptr<evconnlistener, function<void(evconnlistener *)> > ptrListener(NULL, evconnlistener_free);
+	if (m_listen_fd >= 0)
+	{
+		evconnlistener *pListener = evconnlistener_new(pEvBase, acceptCallback, this, LEV_OPT_CLOSE_ON_FREE, m_listenBacklog, m_listen_fd);
+		if (NULL == pListener)
+		{
+			cerr << "IO thread " << boost::this_thread::get_id() << " fails to listen: " << evutil_socket_error_to_string(EVUTIL_SOCKET_ERROR()) << endl;
+			reportStarted(false);
+			return;
+		}
+		//׽ѽevconnlistener为ر
+		m_listen_fd = -1;
+		ptrListener.reset(pListener);
+	}
+
+	//ɷĶʱ¼ֻɷȥʱΪδ
+	m_pRetryEv = evtimer_new(pEvBase, retryCallback, this);
+	if (NULL == m_pRetryEv)
+	{
+		reportStarted(false);
 		return;
+	}
+	unique_ptr<event, function<void(event *)> > ptrRetryEv(m_pRetryEv, event_free);
 
 	m_pEvBase = pEvBase;
+	reportStarted(true);
 	//¼ѭ
 	event_base_dispatch(pEvBase);
 }
@@ -72,17 +165,18 @@ void notifiedCallback(evutil_socket_t fd, short events, void *pArg)
 	if (NULL == pArg)
 		return;
 
-	//ͨsocketpairĶȡ֪ͨ
-	char buf[1];
-	recv(fd, buf, 1, 0);
-	IOWorker *pWorker = (IOWorker *)pArg;
+	((IOWorker *)pArg)->handleNotified();
+}
 
-	if (NOTIFY_IOWORKER_ACCEPT == buf[0])
-		pWorker->handleAccept();
-	else if (NOTIFY_IOWORKER_WRITE == buf[0])
-		pWorker->handleWrite();
-	else if (NOTIFY_IOWORKER_END == buf[0])
-		pWorker->handleEnd();
+void IOWorker::handleNotified()
+{
+	//֪ͨٴдݣԱ֤©ϲ֪ͨ
+	m_notifier.consume();
+
+	handleAccept();
+	handleWrite();
+	if (m_bEndNotified.load())
+		handleEnd();
 }
 
 void IOWorker::handleAccept()
@@ -95,86 +189,132 @@ void IOWorker::handleAccept()
 	m_acceptQueue.takeAll(queue);
 
 	for (auto it = queue.begin(); it != queue.end(); ++it)
+		acceptConn(*it);
+}
+
+void acceptCallback(evconnlistener *pListener, evutil_socket_t fd, struct sockaddr *pAddr, int socklen, void *pArg)
+{
+	if (NULL == pArg)
 	{
-		//bufferevent
-		bufferevent *pBufEv = bufferevent_socket_new(m_pEvBase, *it, BEV_OPT_CLOSE_ON_FREE);
-		if (NULL == pBufEv)
-			continue;
-
-		//Ϣ
-		Conn *pConn = new Conn();
-		pConn->fd = *it;
-		pConn->pBufEv = pBufEv;
-		pConn->pWorker = this;
-
-		m_mapConn[*it] = pConn;
-		++m_connNum;
-
-		//buffereventĻص
-		bufferevent_setcb(pBufEv, readCallback, NULL, eventCallback, pConn);
-		//ʹbuffereventϵĿɶ¼
-		bufferevent_enable(pBufEv, EV_READ);
-
-		cout << "IO thread " << boost::this_thread::get_id() << " begins serving connnection " << pConn->fd << "..." <<endl;
+		evutil_closesocket(fd);
+		return;
 	}
+	//evconnlistener acceptǷ
+	((IOWorker *)pArg)->acceptConn(fd);
 }
 
-void IOWorker::handleWrite()
+void IOWorker::acceptConn(evutil_socket_t fd)
 {
-	//ΪһԴwriteȡҵָ
-	list<BusinessTask *> queue;
-	m_writeQueue.takeAll(queue);
+	if (NULL == m_pEvBase)
+	{
+		evutil_closesocket(fd);
+		return;
+	}
 
-	for (auto it = queue.begin(); it != queue.end(); ++it)
+	//bufferevent
+	bufferevent *pBufEv = bufferevent_socket_new(m_pEvBase, fd, BEV_OPT_CLOSE_ON_FREE);
+	if (NULL == pBufEv)
 	{
-		BusinessTask *pTask = *it;
-		Conn *pConn = NULL;
-		//ҵָָ󶨣ԶٺԴͷ
-		unique_ptr<BusinessTask, function<void(BusinessTask *)> > ptrTask(pTask, [this, &pConn](BusinessTask *pTask) {
-			if (NULL == pTask)
-				return;
-			if (NULL != pTask->pBuf)
-			{
-				evbuffer_free(pTask->pBuf);
-				pTask->pBuf = NULL;
-			}
-			SAFE_DELETE(pTask)
-			checkToFreeConn(pConn);
-		});
+		evutil_closesocket(fd);
+		return;
+	}
+
+	//Ϣ
+	Conn *pConn = new Conn();
+	pConn->fd = fd;
+	pConn->pBufEv = pBufEv;
+	pConn->pWorker = this;
+
+	m_mapConn[fd] = pConn;
+	++m_connNum;
+
+	//buffereventĻص
+	bufferevent_setcb(pBufEv, readCallback, NULL, eventCallback, pConn);
+	//ʹbuffereventϵĿɶ¼
+	bufferevent_enable(pBufEv, EV_READ);
+
+	cout << "IO thread " << boost::this_thread::get_id() << " begins serving connnection " << pConn->fd << "..." <<endl;
+}
 
+void IOWorker::handleWrite()
+{
+	//writeȡҵָ룬ֱΪ
+	BusinessTask *arrTask[TASK_BATCH_SIZE];
+	unsigned int count;
+	while ((count = m_writeQueue.takeBatch(arrTask, TASK_BATCH_SIZE)) > 0)
+	{
+		for (unsigned int i = 0; i < count; ++i)
+			writeTask(arrTask[i]);
+	}
+	//ҵWorker񣬶˿λɷ֮ǰɷȥ
+	retryStalled();
+}
+
+void IOWorker::writeTask(BusinessTask *pTask)
+{
+	Conn *pConn = NULL;
+	//ҵָָ󶨣ԶٺԴͷ
+	unique_ptr<BusinessTask, function<void(BusinessTask *)> > ptrTask(pTask, [this, &pConn](BusinessTask *pTask) {
 		if (NULL == pTask)
-			continue;
-		//
-		auto itFind = m_mapConn.find(pTask->conn_fd);
-		if (itFind == m_mapConn.end())
-			continue;
-		//ȡϢָ
-		pConn = itFind->second;
-		if (NULL == pConn)
-			continue;
-		if (NULL == pTask->pBuf || !pConn->bValid || NULL == pConn->pBufEv)
+			return;
+		if (NULL != pTask->pBuf)
 		{
-			--(pConn->todoCount);
-			continue;
+			evbuffer_free(pTask->pBuf);
+			pTask->pBuf = NULL;
 		}
-		//ȡbuffereventϵevbufferָ
-		evbuffer *pOutBuf = bufferevent_get_output(pConn->pBufEv);
-		if (NULL == pOutBuf)
+		//ʽѽ֮󵽴Ҳ
+		if (NULL != pTask->pStream)
 		{
-			--(pConn->todoCount);
-			continue;
+			if (NULL != pConn)
+			{
+				auto itStream = pConn->mapStream.find(pTask->view.callId);
+				if (itStream != pConn->mapStream.end() && itStream->second == pTask->pStream)
+					pConn->mapStream.erase(itStream);
+			}
+			SAFE_DELETE(pTask->pStream)
 		}
-		//Эhead
-		unsigned char arr[HEAD_SIZE] = {0};
-		arr[0] = DATA_TYPE_RESPONSE;
-		bodySize_t bodyLen = evbuffer_get_length(pTask->pBuf);
-		memcpy(arr + 1, &bodyLen, HEAD_SIZE - 1);
-		//ЭͷŽevbuffer
-		evbuffer_add(pOutBuf, arr, HEAD_SIZE);
-		//лЭbodyƶevbuffer
-		evbuffer_remove_buffer(pTask->pBuf, pOutBuf, evbuffer_get_length(pTask->pBuf));
+		SAFE_DELETE(pTask)
+		//;٣Ҫָȡ
+		if (NULL != pConn)
+			resumeRead(pConn);
+		checkToFreeConn(pConn);
+	});
+
+	if (NULL == pTask)
+		return;
+	//
+	auto itFind = m_mapConn.find(pTask->conn_fd);
+	if (itFind == m_mapConn.end())
+		return;
+	//ȡϢָ
+	pConn = itFind->second;
+	if (NULL == pConn)
+		return;
+	//еMESSAGE֡ȲĽӰ;ͶȣʧЧʱֱӶ
+	if (pTask->bStreamMessage)
+	{
+		if (NULL != pTask->pBuf && pConn->bValid && NULL != pConn->pBufEv)
+			writeFrame(pConn, pTask->pBuf, pTask->view.callId);
+		return;
+	}
+	if (NULL == pTask->pBuf || !pConn->bValid || NULL == pConn->pBufEv)
+	{
+		--(pConn->todoCount);
+		//ʧܣӦ黹
+		if (NULL == pTask->pBuf && pConn->bValid)
+			sendCredit(pConn, 1);
+		return;
+	}
+	//ȡbuffereventϵevbufferָ
+	evbuffer *pOutBuf = bufferevent_get_output(pConn->pBufEv);
+	if (NULL == pOutBuf)
+	{
 		--(pConn->todoCount);
+		return;
 	}
+	//ҵWorkerѱЭݣhead + bodyڴƶevbufferƬͶУ
+	writeFrame(pConn, pTask->pBuf, pTask->view.callId);
+	--(pConn->todoCount);
 }
 
 void IOWorker::handleEnd()
@@ -215,39 +355,148 @@ void IOWorker::handleRead(Conn *pConn)
 	{
 		if (PROTOCOL_HEAD == pConn->inState)
 		{
-			//ȡevbuffer
-			if (evbuffer_get_length(pInBuf) < HEAD_SIZE)
+			//Эheadܷɢڲڴ飬ջϽ룬evbuffer_pullup()evbuffer
+			FrameHead head;
+			HEAD_DECODE_RESULT result = ProtocolCodec::peekHead(pInBuf, head);
+			if (HEAD_DECODE_MORE == result)
 				break;
-			//evbufferеݿܷɢڲڴ飬Ҫȡֽ飬evbuffer_pullup()СԻ
-			//ȡЭheadֽ
-			unsigned char *pArr = evbuffer_pullup(pInBuf, HEAD_SIZE);
-			if (NULL == pArr)
+			//headЧʱ޷磬ֻܶϿ
+			if (HEAD_DECODE_INVALID == result)
+			{
+				bufferevent_disable(pBufEv, EV_READ);
+				handleEvent(pConn);
+				return;
+			}
+			//չheadһƳݲʹе
+			size_t prefixSize = head.headSize + head.extSize;
+			if (evbuffer_get_length(pInBuf) < prefixSize)
 				break;
-			//Эhead2-5ֽתЭbody
-			pConn->inBodySize = *((bodySize_t *)(pArr + 1));
-			//ͨЭhead1ֽж
-			//ΪPINGֱӻظͻPONG
-			if (DATA_TYPE_HEARTBEAT_PING == pArr[0])
+			pConn->inBodySize = head.bodySize;
+			//ͨЭheadеж
+			//ΪPINGЭݵֱӻظͻPONG
+			if (DATA_TYPE_HEARTBEAT_PING == head.dataType)
 			{
+				//bodyһΪգΪʱҲҪȫʣµĲֻᱻһhead
+				if (evbuffer_get_length(pInBuf) < prefixSize + pConn->inBodySize)
+					break;
 				//ȡbuffereventеevbufferָ
 				evbuffer *pOutBuf = bufferevent_get_output(pBufEv);
 				if (NULL != pOutBuf)
 				{
 					//PONGЭheadЭbodyΪ0
-					unsigned char arr[HEAD_SIZE] = {0};
-					arr[0] = DATA_TYPE_HEARTBEAT_PONG;
+					unsigned char arr[HEAD_MAX_SIZE];
+					size_t headSize = ProtocolCodec::encodeHead(arr, pConn->version, DATA_TYPE_HEARTBEAT_PONG, COMPRESS_NONE, 0);
 					//ЭݷŽevbuffer
-					evbuffer_add(pOutBuf, arr, sizeof(arr));
+					evbuffer_add(pOutBuf, arr, headSize);
 
 					cout << "IO thread " << boost::this_thread::get_id() << " finishes replying PONG heartbeat." << endl;
 				}
 				//evbufferƳЭ
-				evbuffer_drain(pInBuf, HEAD_SIZE + pConn->inBodySize);
+				evbuffer_drain(pInBuf, prefixSize + pConn->inBodySize);
+			}
+			//Ϊضȣʾͻ֧أЭݵ贰ڴСĶ
+			else if (DATA_TYPE_CREDIT == head.dataType)
+			{
+				if (evbuffer_get_length(pInBuf) < prefixSize + pConn->inBodySize)
+					break;
+				if (m_connWindow > 0 && !pConn->bCredit)
+				{
+					pConn->bCredit = true;
+					sendCredit(pConn, m_connWindow);
+				}
+				evbuffer_drain(pInBuf, prefixSize + pConn->inBodySize);
+			}
+			//ΪƬʾͻƬЭݵ󣬴˺ӦƬͣһƬʱ
+			else if (DATA_TYPE_FRAGMENT == head.dataType)
+			{
+				if (evbuffer_get_length(pInBuf) < prefixSize + pConn->inBodySize)
+					break;
+				if (m_fragmentSize > 0 && !pConn->bFragment)
+				{
+					pConn->bFragment = true;
+					bufferevent_setcb(pBufEv, readCallback, writeCallback, eventCallback, pConn);
+					bufferevent_setwatermark(pBufEv, EV_WRITE, m_fragmentSize, 0);
+				}
+				evbuffer_drain(pInBuf, prefixSize + pConn->inBodySize);
+			}
+			//Ϊ汾Э̣Эݵѡ˫ֵ֧߰汾ظͻˣ˺Ըð汾
+			else if (DATA_TYPE_VERSION == head.dataType)
+			{
+				if (evbuffer_get_length(pInBuf) < prefixSize + pConn->inBodySize)
+					break;
+				evbuffer_drain(pInBuf, prefixSize);
+				unsigned char version = PROTOCOL_V1;
+				if (pConn->inBodySize >= 1)
+					evbuffer_remove(pInBuf, &version, 1);
+				evbuffer_drain(pInBuf, (pConn->inBodySize >= 1) ? pConn->inBodySize - 1 : 0);
+				pConn->version = std::max((unsigned char)PROTOCOL_V1, std::min(version, (unsigned char)PROTOCOL_MAX_VERSION));
+				sendVersion(pConn);
+			}
+			//ΪѹЭ̣Эݵ󣬴ӿͻֵ֧ѹ㷨ѡҲֵ֧ĵһ
+			else if (DATA_TYPE_COMPRESS == head.dataType)
+			{
+				if (evbuffer_get_length(pInBuf) < prefixSize + pConn->inBodySize)
+					break;
+				evbuffer_drain(pInBuf, prefixSize);
+				unsigned char arrType[MAX_COMPRESS_TYPE_NUM];
+				unsigned int num = (unsigned int)std::min(pConn->inBodySize, (bodySize_t)MAX_COMPRESS_TYPE_NUM);
+				evbuffer_copyout(pInBuf, arrType, num);
+				if (m_compressThreshold > 0)
+					pConn->compressType = Compressor::selectType(arrType, num);
+				evbuffer_drain(pInBuf, pConn->inBodySize);
+			}
+			//ΪȣЭݵ󣬰ѶȽΪ0ʾͻȡ
+			else if (DATA_TYPE_STREAM_CREDIT == head.dataType)
+			{
+				if (evbuffer_get_length(pInBuf) < prefixSize + pConn->inBodySize)
+					break;
+				evbuffer_drain(pInBuf, prefixSize);
+				if (pConn->inBodySize >= sizeof(callId_t) + sizeof(credit_t))
+				{
+					unsigned char arr[sizeof(callId_t) + sizeof(credit_t)];
+					evbuffer_copyout(pInBuf, arr, sizeof(arr));
+					callId_t callId;
+					credit_t credit;
+					google::protobuf::io::CodedInputStream::ReadLittleEndian32FromArray(arr, &callId);
+					google::protobuf::io::CodedInputStream::ReadLittleEndian32FromArray(arr + sizeof(callId), &credit);
+					//ѽʱҲֱӶ
+					auto itStream = pConn->mapStream.find(callId);
+					if (itStream != pConn->mapStream.end())
+					{
+						if (0 == credit)
+							itStream->second->cancel();
+						else
+							itStream->second->grant(credit);
+					}
+				}
+				evbuffer_drain(pInBuf, pConn->inBodySize);
+			}
+			//Ϊʽ֡ʾͻʽõϢЭݵ󣬽ENDʾͻд
+			else if (DATA_TYPE_STREAM == head.dataType)
+			{
+				if (evbuffer_get_length(pInBuf) < prefixSize + pConn->inBodySize)
+					break;
+				evbuffer_drain(pInBuf, prefixSize);
+				//һֱӴevbufferڴ鷴лpullup
+				ProtocolBodyStream bodyStream;
+				if (ProtocolCodec::parseFromEvbuffer(pInBuf, 0, pConn->inBodySize, &bodyStream))
+				{
+					//ѽʱҲϢֱӶ
+					auto itStream = pConn->mapStream.find(bodyStream.callid());
+					if (itStream != pConn->mapStream.end())
+					{
+						if (STREAM_MESSAGE == bodyStream.frame())
+							itStream->second->push(bodyStream.mutable_content());
+						else if (STREAM_END == bodyStream.frame())
+							itStream->second->endInput();
+					}
+				}
+				evbuffer_drain(pInBuf, pConn->inBodySize);
 			}
 			//Ϊͣһ󣩣ȡЭbody
 			else
 			{
-				evbuffer_drain(pInBuf, HEAD_SIZE);
+				evbuffer_drain(pInBuf, prefixSize);
 				pConn->inState = PROTOCOL_BODY;
 			}
 		}
@@ -256,42 +505,88 @@ void IOWorker::handleRead(Conn *pConn)
 			//ȡevbuffer
 			if (evbuffer_get_length(pInBuf) < pConn->inBodySize)
 				break;
+			//;ﵽڣһδɷȥͣȡѶȡevbufferУTCPѹؿͻ
+			if (NULL != pConn->pStalledTask || (m_connWindow > 0 && pConn->todoCount >= m_connWindow))
+			{
+				pConn->bReadPaused = true;
+				bufferevent_disable(pBufEv, EV_READ);
+				break;
+			}
 
 			//ҵ
 			BusinessTask *pTask = new BusinessTask();
 			pTask->pWorker = this;
 			pTask->conn_fd = pConn->fd;
+			pTask->compressType = pConn->compressType;
+			pTask->version = pConn->version;
 			//evbufferƶevbuffer
 			pTask->pBuf = evbuffer_new();
 			if (NULL != pTask->pBuf)
 			{
-				//ҵWorker
-				BusinessWorker *pSelectedWorker = schedule();
-				if (NULL != pSelectedWorker)
+				//Эbodyevbufferƶҵevbufferڴֻƽָ롢˺ٴevbufferƳ
+				evbuffer_remove_buffer(pInBuf, pTask->pBuf, pConn->inBodySize);
+				pConn->inState = PROTOCOL_HEAD;
+				//ڱ߳̽Эbodyҷ񣬷ŵİϵ˳һ
+				if (ProtocolCodec::decodeRequestView(pTask->pBuf, pTask->view))
+					pTask->pService = resolveService(pConn, pTask->view);
+				//ִеķֱڱ̴߳ӦŽͬһevbufferҵWorker
+				//ʽõдͶȡȴ̶߳ȡȺϢִ
+				if (NULL != pTask->pService && 0 == pTask->view.streamWindow && 0 == pTask->view.clientStreamWindow
+					&& pTask->view.methodIndex < pTask->pService->vecInline.size()
+					&& pTask->pService->vecInline[pTask->view.methodIndex])
 				{
-					evbuffer_remove_buffer(pInBuf, pTask->pBuf, pConn->inBodySize);
-					//ҵָѡеҵWorkerеĶ
-					if (pSelectedWorker->m_queue.put(pTask))
+					m_pTaskArena->arena.Reset();
+					TASK_STATE state = BusinessWorker::handleTask(pTask, m_pTaskArena, m_pBusinessWorkerPool);
+					//첽ɣӦҵWorkerһwriteлص߳
+					if (TASK_STATE_PENDING == state)
 					{
 						++(pConn->todoCount);
-						evbuffer_drain(pInBuf, pConn->inBodySize);
-						pConn->inState = PROTOCOL_HEAD;
 						continue;
 					}
-					//·֧ʾδɹҵɷҵWorkerڴ桢ͷԴ
+					if (TASK_STATE_DONE == state)
+						writeFrame(pConn, pTask->pBuf, pTask->view.callId);
+					else
+						sendCredit(pConn, 1);
+					if (NULL != pTask->pBuf)
+						evbuffer_free(pTask->pBuf);
 					SAFE_DELETE(pTask)
+					continue;
 				}
-				else
+				if (NULL != pTask->pService)
 				{
-					evbuffer_free(pTask->pBuf);
-					SAFE_DELETE(pTask)
+					//ʽɷǰʵͨRpcControllerȡ
+					if (pTask->view.streamWindow > 0 || pTask->view.clientStreamWindow > 0)
+						pTask->pStream = new ServerStream(pTask, pTask->view.streamWindow, std::min(pTask->view.clientStreamWindow, (uint32_t)CLIENT_STREAM_MAX_WINDOW));
+					//ɷҵ߳дȡǼϢ
+					ServerStream *pStream = pTask->pStream;
+					callId_t callId = pTask->view.callId;
+					//ҵɷҵWorkerأɿеҵWorker
+					if (m_pBusinessWorkerPool->dispatch(pTask))
+					{
+						++(pConn->todoCount);
+						openStream(pConn, callId, pStream);
+						continue;
+					}
+					//ҵWorkerĶж󲻶ϲͣȡҵWorkerпλʱ
+					pConn->pStalledTask = pTask;
+					m_listStalledConn.push_back(pConn->fd);
+					pConn->bReadPaused = true;
+					bufferevent_disable(pBufEv, EV_READ);
+					if (NULL != m_pRetryEv && 0 == evtimer_pending(m_pRetryEv, NULL))
+						evtimer_add(m_pRetryEv, &m_retryInterval);
+					break;
 				}
-			}
-			else
+				//Чڴ桢ͷԴ󲻻Ӧ黹
+				evbuffer_free(pTask->pBuf);
 				SAFE_DELETE(pTask)
-			
+				sendCredit(pConn, 1);
+				continue;
+			}
+			SAFE_DELETE(pTask)
+
 			evbuffer_drain(pInBuf, pConn->inBodySize);
 			pConn->inState = PROTOCOL_HEAD;
+			sendCredit(pConn, 1);
 		}
 		else
 			break;
@@ -314,46 +609,206 @@ void IOWorker::handleEvent(Conn *pConn)
 		return;
 
 	pConn->bValid = false;
+	//ɷȥûбҪ;󣬲ֹͷ
+	if (NULL != pConn->pStalledTask)
+	{
+		evbuffer_free(pConn->pStalledTask->pBuf);
+		SAFE_DELETE(pConn->pStalledTask->pStream)
+		SAFE_DELETE(pConn->pStalledTask)
+	}
+	//ѵȴȵд룬÷ʵ־ɸԵҵдʱ
+	for (auto it = pConn->mapStream.begin(); it != pConn->mapStream.end(); ++it)
+		it->second->cancel();
+	pConn->mapStream.clear();
+	//δĴӦ޷ʹ
+	for (auto it = pConn->listFragmented.begin(); it != pConn->listFragmented.end(); ++it)
+		evbuffer_free(it->pBuf);
+	pConn->listFragmented.clear();
 	checkToFreeConn(pConn);
 }
 
-BusinessWorker *IOWorker::schedule()
+void writeCallback(bufferevent *pBufEv, void *pArg)
 {
-	BusinessWorker *pSelectedWorker = NULL;
-	unsigned int minBusyLevel;
+	if (NULL == pBufEv || NULL == pArg)
+		return;
+	IOWorker *pWorker = ((Conn *)pArg)->pWorker;
+	if (NULL != pWorker)
+		pWorker->handleWritable((Conn *)pArg);
+}
 
-	auto it = m_pVecBusinessWorker->begin();
-	for ( ; it != m_pVecBusinessWorker->end(); ++it)
+void IOWorker::handleWritable(Conn *pConn)
+{
+	if (NULL == pConn || !pConn->bValid)
+		return;
+	sendFragments(pConn);
+}
+
+void retryCallback(evutil_socket_t fd, short events, void *pArg)
+{
+	if (NULL == pArg)
+		return;
+
+	((IOWorker *)pArg)->retryStalled();
+}
+
+void IOWorker::retryStalled()
+{
+	while (!m_listStalledConn.empty())
 	{
-		BusinessWorker *pWorker = *it;
-		if (NULL != pWorker)
+		//ͷŻɷȥʱֱӸҲӰ
+		auto itFind = m_mapConn.find(m_listStalledConn.front());
+		Conn *pConn = (itFind == m_mapConn.end()) ? NULL : itFind->second;
+		if (NULL != pConn && NULL != pConn->pStalledTask)
 		{
-			pSelectedWorker = pWorker;
-			//ȡҵWorkerķæ̶ȣԽæҵWorkerԽױѡ
-			minBusyLevel = pSelectedWorker->getBusyLevel();
-			break;
+			ServerStream *pStream = pConn->pStalledTask->pStream;
+			callId_t callId = pConn->pStalledTask->view.callId;
+			//ȻҲ
+			if (!m_pBusinessWorkerPool->dispatch(pConn->pStalledTask))
+				break;
+			pConn->pStalledTask = NULL;
+			++(pConn->todoCount);
+			openStream(pConn, callId, pStream);
+		}
+		m_listStalledConn.pop_front();
+		//evbufferѶȡ󣬿ٴͣ¼бĩβ
+		if (NULL != pConn)
+			resumeRead(pConn);
+	}
+	if (!m_listStalledConn.empty() && NULL != m_pRetryEv && 0 == evtimer_pending(m_pRetryEv, NULL))
+		evtimer_add(m_pRetryEv, &m_retryInterval);
+}
+
+void IOWorker::resumeRead(Conn *pConn)
+{
+	if (!pConn->bReadPaused || !pConn->bValid || NULL != pConn->pStalledTask || NULL == pConn->pBufEv)
+		return;
+	//;󽵵ڵһ²ŻָڴڱԵؿɶ¼
+	if (m_connWindow > 0 && pConn->todoCount > m_connWindow / 2)
+		return;
+
+	pConn->bReadPaused = false;
+	bufferevent_enable(pConn->pBufEv, EV_READ);
+	//evbufferе󲻻ٴɶ¼ֱӴ
+	handleRead(pConn);
+}
+
+void IOWorker::openStream(Conn *pConn, callId_t callId, ServerStream *pStream)
+{
+	if (NULL == pStream)
+		return;
+	pConn->mapStream[callId] = pStream;
+	evbuffer *pOutBuf = (NULL == pConn->pBufEv) ? NULL : bufferevent_get_output(pConn->pBufEv);
+	if (NULL == pOutBuf)
+		return;
+	//ʽã߿ͻѿʼ
+	if (pStream->isWritable())
+		ProtocolCodec::encodeStreamFrame(pOutBuf, callId, STREAM_BEGIN, NULL, NULL, pConn->version);
+	//ͻʽãͻ˳ʼȣͻ˴˺ſʼϢ
+	if (pStream->getReadWindow() > 0)
+		ProtocolCodec::encodeStreamCredit(pOutBuf, callId, pStream->getReadWindow(), pConn->version);
+}
+
+void IOWorker::sendCredit(Conn *pConn, credit_t credit)
+{
+	if (!pConn->bCredit || 0 == credit || NULL == pConn->pBufEv)
+		return;
+	evbuffer *pOutBuf = bufferevent_get_output(pConn->pBufEv);
+	if (NULL == pOutBuf)
+		return;
+
+	//Эhead + 4ֽڵĶ
+	unsigned char arr[HEAD_MAX_SIZE + sizeof(credit_t)];
+	size_t headSize = ProtocolCodec::encodeHead(arr, pConn->version, DATA_TYPE_CREDIT, COMPRESS_NONE, sizeof(credit_t));
+	google::protobuf::io::CodedOutputStream::WriteLittleEndian32ToArray(credit, arr + headSize);
+	evbuffer_add(pOutBuf, arr, headSize + sizeof(credit_t));
+}
+
+void IOWorker::sendVersion(Conn *pConn)
+{
+	if (NULL == pConn->pBufEv)
+		return;
+	evbuffer *pOutBuf = bufferevent_get_output(pConn->pBufEv);
+	if (NULL == pOutBuf)
+		return;
+
+	//Эhead + 1ֽڵİ汾ţѾѡİ汾룬ͻ˰ÿЭݵĵ1ְֽ汾
+	unsigned char arr[HEAD_MAX_SIZE + 1];
+	size_t headSize = ProtocolCodec::encodeHead(arr, pConn->version, DATA_TYPE_VERSION, COMPRESS_NONE, 1);
+	arr[headSize] = pConn->version;
+	evbuffer_add(pOutBuf, arr, headSize + 1);
+}
+
+void IOWorker::writeFrame(Conn *pConn, evbuffer *pBuf, callId_t callId)
+{
+	if (NULL == pConn->pBufEv)
+		return;
+	evbuffer *pOutBuf = bufferevent_get_output(pConn->pBufEv);
+	if (NULL == pOutBuf)
+		return;
+
+	//ͬһãһЭڷƬͣƬһ
+	for (auto it = pConn->listFragmented.begin(); it != pConn->listFragmented.end(); ++it)
+	{
+		if (it->callId == callId)
+		{
+			evbuffer_add_buffer(it->pBuf, pBuf);
+			return;
 		}
 	}
-	if (NULL == pSelectedWorker || minBusyLevel <= 0)
-		return pSelectedWorker;
+	//СЭֱӷevbufferѷķƬ֮󣬲ȴӦ
+	if (!pConn->bFragment || 0 == m_fragmentSize || evbuffer_get_length(pBuf) <= m_fragmentSize)
+	{
+		evbuffer_add_buffer(pOutBuf, pBuf);
+		return;
+	}
 
-	for (++it; it != m_pVecBusinessWorker->end(); ++it)
+	FragmentedFrame frame;
+	frame.pBuf = evbuffer_new();
+	if (NULL == frame.pBuf)
 	{
-		BusinessWorker *pWorker = *it;
-		if (NULL != pWorker)
+		evbuffer_add_buffer(pOutBuf, pBuf);
+		return;
+	}
+	frame.fragmentId = ++(pConn->fragmentSeq);
+	frame.callId = callId;
+	evbuffer_add_buffer(frame.pBuf, pBuf);
+	pConn->listFragmented.push_back(frame);
+	sendFragments(pConn);
+}
+
+void IOWorker::sendFragments(Conn *pConn)
+{
+	if (NULL == pConn->pBufEv)
+		return;
+	evbuffer *pOutBuf = bufferevent_get_output(pConn->pBufEv);
+	if (NULL == pOutBuf)
+		return;
+
+	//evbufferеݲһƬʱٷ룬併ˮλɿдص
+	while (!pConn->listFragmented.empty() && evbuffer_get_length(pOutBuf) < m_fragmentSize)
+	{
+		FragmentedFrame &frame = pConn->listFragmented.front();
+		size_t leftSize = evbuffer_get_length(frame.pBuf);
+		size_t chunkSize = std::min(leftSize, (size_t)m_fragmentSize);
+		bool bLast = (chunkSize == leftSize);
+
+		//Эhead + Ƭid + ǣ֮ǷƬ
+		unsigned char arr[HEAD_MAX_SIZE + FRAGMENT_HEAD_SIZE];
+		size_t headSize = ProtocolCodec::encodeHead(arr, pConn->version, DATA_TYPE_FRAGMENT, COMPRESS_NONE, (bodySize_t)(FRAGMENT_HEAD_SIZE + chunkSize));
+		google::protobuf::io::CodedOutputStream::WriteLittleEndian32ToArray(frame.fragmentId, arr + headSize);
+		arr[headSize + sizeof(frame.fragmentId)] = bLast ? 1 : 0;
+		evbuffer_add(pOutBuf, arr, headSize + FRAGMENT_HEAD_SIZE);
+		evbuffer_remove_buffer(frame.pBuf, pOutBuf, chunkSize);
+
+		if (bLast)
 		{
-			unsigned int busyLevel = pWorker->getBusyLevel();
-			if (busyLevel < minBusyLevel)
-			{
-				pSelectedWorker = pWorker;
-				minBusyLevel = busyLevel;
-				//ҵWorkerȫУѡҵWorker
-				if (minBusyLevel <= 0)
-					break;
-			}
+			evbuffer_free(frame.pBuf);
+			pConn->listFragmented.pop_front();
 		}
+		//ӦͣһӦռ
+		else if (pConn->listFragmented.size() > 1)
+			pConn->listFragmented.splice(pConn->listFragmented.end(), pConn->listFragmented, pConn->listFragmented.begin());
 	}
-	return pSelectedWorker;
 }
 
 bool IOWorker::checkToFreeConn(Conn *pConn)
@@ -382,12 +837,40 @@ bool IOWorker::checkToFreeConn(Conn *pConn)
 	return false;
 }
 
+const RegisteredService *IOWorker::resolveService(Conn *pConn, const RequestView &view)
+{
+	if (NULL == pConn || NULL == m_pMapRegisteredService)
+		return NULL;
+
+	//ֻţֱϰ󶨵ķ
+	if (view.serviceName.empty())
+	{
+		if (view.serviceId >= pConn->vecBoundService.size())
+			return NULL;
+		return pConn->vecBoundService[view.serviceId];
+	}
+
+	//ͨҷ
+	auto itFind = m_pMapRegisteredService->find(view.serviceName);
+	if (itFind == m_pMapRegisteredService->end())
+		return NULL;
+	const RegisteredService *pRegisteredService = &itFind->second;
+	//ͬʱţ򽫷Ű󶨵÷񣬴˺ϵֻ
+	if (view.serviceId > 0 && view.serviceId <= MAX_SERVICE_ID)
+	{
+		if (view.serviceId >= pConn->vecBoundService.size())
+			pConn->vecBoundService.resize(view.serviceId + 1, NULL);
+		pConn->vecBoundService[view.serviceId] = pRegisteredService;
+	}
+	return pRegisteredService;
+}
+
 unsigned int IOWorker::getBusyLevel()
 {
 	return m_connNum;
 }
 
-evutil_socket_t IOWorker::getNotify_fd()
+void IOWorker::notify()
 {
-	return m_notify_fd;
+	m_notifier.notify();
 }
\ No newline at end of file
@@ -2,7 +2,7 @@
 #define _IOWORKER_H_
 
 #include "RpcServerGlobal.h"
-#include "BusinessWorker.h"
+#include "BusinessWorkerPool.h"
 
 /************************************************************************
   ܣlibevent ɶص˺
@@ -25,6 +25,27 @@ void readCallback(struct bufferevent *pBufEv, void *pArg);
 ************************************************************************/
 void eventCallback(struct bufferevent *pBufEv, short events, void *pArg);
 
+/************************************************************************
+  ܣlibevent buffereventˮλص˺ֻڷƬ͵
+  libevent bufferevent_data_cb
+ֵ
+************************************************************************/
+void writeCallback(struct bufferevent *pBufEv, void *pArg);
+
+/************************************************************************
+  ܣSO_REUSEPORTģʽ£IOWorkerԼevconnlistener acceptӺص˺
+  libevent evconnlistener_cb
+ֵ
+************************************************************************/
+void acceptCallback(evconnlistener *pListener, evutil_socket_t fd, struct sockaddr *pAddr, int socklen, void *pArg);
+
+/************************************************************************
+  ܣɷĶʱ¼ںص˺
+  libevent event_callback_fn
+ֵ
+************************************************************************/
+void retryCallback(evutil_socket_t fd, short events, void *pArg);
+
 //IOWorkerһ̣߳¼ѭ߳
 class IOWorker
 {
@@ -32,13 +53,12 @@ public:
 	/************************************************************************
 	  ܣ췽
 	  
-		fds룬IOWorkerӦsocketpair
 		acceptQueueMaxSize룬accept󳤶
-		writeQueueMaxSize룬write󳤶
-		pVecBusinessWorker룬ҵWorkerָ
+		writeQueueMaxSize룬write󳤶ȣȡΪ2
+		pBusinessWorkerPool룬ҵWorkerָ
 	ֵ
 	************************************************************************/
-	IOWorker(evutil_socket_t *fds, unsigned int acceptQueueMaxSize, unsigned int completeQueueMaxSize, const vector<BusinessWorker *> *pVecBusinessWorker);
+	IOWorker(unsigned int acceptQueueMaxSize, unsigned int completeQueueMaxSize, BusinessWorkerPool *pBusinessWorkerPool);
 	
 	/************************************************************************
 	  ܣ
@@ -48,11 +68,68 @@ public:
 	~IOWorker();
 
 	/************************************************************************
-	  ܣIOWorker
+	  ܣIOWorkerԼļ׽֣SO_REUSEPORTģʽstart()֮ǰ
+	  
+		listen_fd룬Ѱ󶨼ַ׽IOWorkerر
+		backlog룬׽ֵbacklog
+	ֵ
+	************************************************************************/
+	void setListenFd(evutil_socket_t listen_fd, int backlog);
+
+	/************************************************************************
+	  ܣעķ񣬱start()֮ǰ
+	  
+		pMapRegisteredService룬עķָ
+	ֵ
+	************************************************************************/
+	void setRegisteredServices(const map<string, RegisteredService> *pMapRegisteredService);
+
+	/************************************************************************
+	  ܣÿӵ;󴰿ڣstart()֮ǰ
+	  
+		connWindow룬ѶȡδظޣΪ0ʾƣҲͻ
+	ֵ
+	************************************************************************/
+	void setConnWindow(unsigned int connWindow);
+
+	/************************************************************************
+	  ܣӦѹֵstart()֮ǰ
+	  
+		compressThreshold룬ӦЭbodyСڴ˳ʱѹΪ0ʾѹ
+	ֵ
+	************************************************************************/
+	void setCompressThreshold(unsigned int compressThreshold);
+
+	/************************************************************************
+	  ܣȡӦѹ̵ֵ߳
+	  
+	ֵѹֵΪ0ʾѹ
+	************************************************************************/
+	unsigned int getCompressThreshold();
+
+	/************************************************************************
+	  ܣӦķƬСstart()֮ǰ
+	  
+		fragmentSize룬˳ȵӦƬϷƬͣΪ0ʾƬ
+	ֵ
+	************************************************************************/
+	void setFragmentSize(unsigned int fragmentSize);
+
+	/************************************************************************
+	  ܣIOWorkerȴ߳ɳʼ󷵻
+	  
+	ֵ
+		trueɹ
+		falseʧܣ޷Լļ׽ϴevconnlistener
+	************************************************************************/
+	bool start();
+
+	/************************************************************************
+	  ܣ֪֪ͨͨǺϲģÿζacceptСwriteкͽ
 	  
 	ֵ
 	************************************************************************/
-	void start();
+	void handleNotified();
 
 	/************************************************************************
 	  ܣaccept̷߳Ľӹ֪ͨ
@@ -61,6 +138,14 @@ public:
 	************************************************************************/
 	void handleAccept();
 
+	/************************************************************************
+	  ܣӹһ
+	  
+		fd룬
+	ֵ
+	************************************************************************/
+	void acceptConn(evutil_socket_t fd);
+
 	/************************************************************************
 	  ܣҵWorkerķӦ֪ͨ
 	  
@@ -91,6 +176,21 @@ public:
 	************************************************************************/
 	void handleEvent(Conn *pConn);
 
+	/************************************************************************
+	  ܣӵˮλͷƬ
+	  
+		pConn룬ָ
+	ֵ
+	************************************************************************/
+	void handleWritable(Conn *pConn);
+
+	/************************************************************************
+	  ܣɷҵWorkerĶжͣϵ󣬰ͣȺ˳
+	  
+	ֵ
+	************************************************************************/
+	void retryStalled();
+
 	/************************************************************************
 	  ܣȡIOWorkerķæ̶ȣԵǰIOWorkerӹܵʾæ̶
 	  
@@ -99,16 +199,16 @@ public:
 	unsigned int getBusyLevel();
 
 	/************************************************************************
-	  ܣȡIOWorkersocketpairд
+	  ܣ֪ͨIOWorkerµӻӦݴ̵߳
 	  
-	ֵIOWorkersocketpairд
+	ֵ
 	************************************************************************/
-	evutil_socket_t getNotify_fd();
+	void notify();
 
 	//accept
 	SyncQueue<evutil_socket_t> m_acceptQueue;
-	//write
-	SyncQueue<BusinessTask *> m_writeQueue;
+	//writeУΪҵWorkerΪIOWorker
+	RingQueue<BusinessTask *> m_writeQueue;
 
 private:
 	/************************************************************************
@@ -116,14 +216,15 @@ private:
 	  
 	ֵ
 	************************************************************************/
-	void threadMain(evutil_socket_t notified_fd);
+	void threadMain();
 
 	/************************************************************************
-	  ܣҵWorkerеһҵWorker󣨲PING
-	  
-	ֵѡеҵWorkerָ룬ΪNULLʾʧ
+	  ܣҵWorkerɵӦݷӵevbufferҵ
+	  
+		pTask룬ҵָ
+	ֵ
 	************************************************************************/
-	BusinessWorker *schedule();
+	void writeTask(BusinessTask *pTask);
 
 	/************************************************************************
 	  ܣͷ
@@ -135,18 +236,123 @@ private:
 	************************************************************************/
 	bool checkToFreeConn(Conn *pConn);
 
+	/************************************************************************
+	  ܣõķ񣬲еķŰ
+		1ͷţҷ񣬲Ű󶨵÷
+		2ֻţѰ󶨵ķҷ
+		3ֻɸʽҷ
+	  
+		pConn룬ָ
+		view룬Эbodyͼ
+	ֵָ룬ΪNULLʾҲ
+	************************************************************************/
+	const RegisteredService *resolveService(Conn *pConn, const RequestView &view);
+
+	/************************************************************************
+	  ܣʽɷȥ󣬵ǼԽտͻ˹黹ȺͷϢ
+		ʽͻ˷BEGIN֡ͻʽͻʼ
+	  
+		pConn룬ָ
+		callId룬id
+		pStream룬ָ룬ΪNULLʾʽãʲô
+	ֵ
+	************************************************************************/
+	void openStream(Conn *pConn, callId_t callId, ServerStream *pStream);
+
+	/************************************************************************
+	  ܣ֧صĿͻ˷Ͷ
+	  
+		pConn룬ָ
+		credit룬黹Ķ
+	ֵ
+	************************************************************************/
+	void sendCredit(Conn *pConn, credit_t credit);
+
+	/************************************************************************
+	  ܣͻ˻ظ汾ЭѡЭ汾
+	  
+		pConn룬ָ룬Э汾Ϊѡİ汾
+	ֵ
+	************************************************************************/
+	void sendVersion(Conn *pConn);
+
+	/************************************************************************
+	  ܣЭݣhead + bodyӵevbuffer
+		1ͬһЭڷƬʱ󣬱֡˳
+		2ƬСҿͻƬʱƬͶУ
+		3ЭֱӷevbufferصȴӦꡣ
+	  
+		pConn룬ָ
+		pBuf룬ЭݣڴߺΪ
+		callId룬id
+	ֵ
+	************************************************************************/
+	void writeFrame(Conn *pConn, evbuffer *pBuf, callId_t callId);
+
+	/************************************************************************
+	  ܣevbufferеݲһƬʱӷƬеĴӦгһƬ
+	  
+		pConn룬ָ
+	ֵ
+	************************************************************************/
+	void sendFragments(Conn *pConn);
+
+	/************************************************************************
+	  ܣ;󽵵ڵһ£ûɷȥʱָȡͣ
+	  
+		pConn룬ָ
+	ֵ
+	************************************************************************/
+	void resumeRead(Conn *pConn);
+
+	/************************************************************************
+	  ܣ̱߳ʼstart()еȴ߳
+	  
+		bOk룬ʼǷɹ
+	ֵ
+	************************************************************************/
+	void reportStarted(bool bOk);
+
 	//߳
 	boost::thread m_thd;
-	//socketpair
-	evutil_socket_t m_notified_fd;
-	//socketpairд
-	evutil_socket_t m_notify_fd;
+	//ʼ
+	boost::mutex m_startMutex;
+	//̳߳ʼʱstart()ϱ
+	boost::condition_variable m_startCond;
+	//߳Ƿɳʼ
+	bool m_bStartDone;
+	//̳߳ʼǷɹ
+	bool m_bStartOk;
+	//֪ͨڽaccept̡߳ҵWorker֪ͨ
+	Notifier m_notifier;
+	//Ƿյ֪ͨ
+	std::atomic<bool> m_bEndNotified;
+	//SO_REUSEPORTģʽIOWorkerԼļ׽evconnlistenerΪ-1
+	evutil_socket_t m_listen_fd;
+	//׽ֵbacklog
+	int m_listenBacklog;
 	//ҵWorkerָ
-	const vector<BusinessWorker *> *m_pVecBusinessWorker;
+	BusinessWorkerPool *m_pBusinessWorkerPool;
+	//עķָ
+	const map<string, RegisteredService> *m_pMapRegisteredService;
+	//ִзʱõArena첽ʱᱻɴҵWorkerػȡArena
+	TaskArena *m_pTaskArena;
 	//ӣmap<, ָ>
 	map<evutil_socket_t, Conn *> m_mapConn;
 	//ǰ
 	unsigned int m_connNum;
+	//ÿӵ;󴰿ڣΪ0ʾ
+	unsigned int m_connWindow;
+	//ӦѹֵΪ0ʾѹstart()֮޸
+	unsigned int m_compressThreshold;
+	//ӦķƬСΪ0ʾƬ
+	unsigned int m_fragmentSize;
+	//ɷȥͣȺ˳
+	list<evutil_socket_t> m_listStalledConn;
+	//ɷĶʱ¼
+	event *m_pRetryEv;
+	//ɷļ
+	timeval m_retryInterval;
 	//event_baseָ
 	event_base *m_pEvBase;
 	//IOWorkerǷѾʼ
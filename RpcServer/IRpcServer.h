@@ -12,6 +12,7 @@
 #endif
 
 #include <string>
+#include <vector>
 #include <google/protobuf/service.h>
 
 //RpcServerӿ
@@ -30,11 +31,23 @@ public:
 		IOWorkerWriteQueueMaxSize룬IOWorkerͶе󳤶
 		businessWorkerNum룬ҵWorkerWorker
 		businessWorkerQueueMaxSize룬ҵWorkerҵе󳤶
+		listenBacklog룬׽ֵbacklogĬֵΪ128
+		bReusePort룬ǷÿIOWorkerSO_REUSEPORTaccept
+			trueںڸIOWorkerļ׽ַּӣʹaccepṭֻ֧߳SO_REUSEPORTƽ̨Ч
+			falseaccept߳ͳһacceptٵȸIOWorkerĬֵ
+		connWindow룬ÿӵ;󴰿ڣĬֵΪ1024Ϊ0ʾ
+			֧صĿͻ;ﵽʱͣͣѶȡδظﵽʱͣȡ
+		compressThreshold룬ӦѹֵλΪֽڣĬֵΪ0ʾѹ
+			ӦЭbodyСڴ˳ȣҿͻ֧˫ѹ㷨ʱҵWorkerѹ
+		fragmentSize룬ӦķƬСλΪֽڣĬֵΪ65536Ϊ0ʾƬ
+			ͻƬʱ˳ȵӦѹгɷƬõӦ淢ͣСڴӦ֮
 	ֵIRpcServerָ
 	************************************************************************/
 	static IRpcServer *createRpcServer(const std::string &ip, int port, 
 		unsigned int IOWorkerNum, unsigned int IOWorkerAcceptQueueMaxSize, unsigned int IOWorkerCompleteQueueMaxSize, 
-		unsigned int businessWorkerNum, unsigned int businessWorkerQueueMaxSize);
+		unsigned int businessWorkerNum, unsigned int businessWorkerQueueMaxSize, 
+		int listenBacklog = 128, bool bReusePort = false, unsigned int connWindow = 1024, unsigned int compressThreshold = 0, 
+		unsigned int fragmentSize = 65536);
 
 	/************************************************************************
 	  ܣRpcServerʵ
@@ -46,11 +59,24 @@ public:
 
 	/************************************************************************
 	  ܣע
+		ķʵʱdoneڷǰãҲȷأ̵֮߳ã
+		done֮ǰΡκRpcControllerһֱЧӦdoneúŷ
 	  
 		pServiceָ
+		bInlineǷ÷зIOWorkerִ߳УĬΪfalse
+			ִеķҵWorkerʡȥο̵߳ĶкͻѣֻʺϺʱ̡ķ
 	ֵ
 	************************************************************************/
-	virtual void registerService(google::protobuf::Service *pService) = 0;
+	virtual void registerService(google::protobuf::Service *pService, bool bInline = false) = 0;
+
+	/************************************************************************
+	  ܣע񣬲ָIOWorkerִ߳еķ
+	  
+		pServiceָ
+		vecInlineMethodִеķеķҵWorkerִ
+	ֵ
+	************************************************************************/
+	virtual void registerService(google::protobuf::Service *pService, const std::vector<std::string> &vecInlineMethod) = 0;
 
 	/************************************************************************
 	  ܣRpcServer
@@ -4,9 +4,11 @@ IRpcServer::~IRpcServer() {}
 
 IRpcServer *IRpcServer::createRpcServer(const string &ip, int port, 
 	unsigned int IOWorkerNum, unsigned int IOWorkerAcceptQueueMaxSize, unsigned int IOWorkerCompleteQueueMaxSize, 
-	unsigned int businessWorkerNum, unsigned int businessWorkerQueueMaxSize)
+	unsigned int businessWorkerNum, unsigned int businessWorkerQueueMaxSize, 
+	int listenBacklog, bool bReusePort, unsigned int connWindow, unsigned int compressThreshold, unsigned int fragmentSize)
 {
-	return new RpcServer(ip, port, IOWorkerNum, IOWorkerAcceptQueueMaxSize, IOWorkerCompleteQueueMaxSize, businessWorkerNum, businessWorkerQueueMaxSize);
+	return new RpcServer(ip, port, IOWorkerNum, IOWorkerAcceptQueueMaxSize, IOWorkerCompleteQueueMaxSize, businessWorkerNum, businessWorkerQueueMaxSize, 
+		listenBacklog, bReusePort, connWindow, compressThreshold, fragmentSize);
 }
 
 void IRpcServer::releaseRpcServer(IRpcServer *pIRpcServer)
@@ -16,10 +18,17 @@ void IRpcServer::releaseRpcServer(IRpcServer *pIRpcServer)
 
 RpcServer::RpcServer(const string &ip, int port, 
 	unsigned int IOWorkerNum, unsigned int IOWorkerAcceptQueueMaxSize, unsigned int IOWorkerCompleteQueueMaxSize, 
-	unsigned int businessWorkerNum, unsigned int businessWorkerQueueMaxSize)
+	unsigned int businessWorkerNum, unsigned int businessWorkerQueueMaxSize, 
+	int listenBacklog, bool bReusePort, unsigned int connWindow, unsigned int compressThreshold, unsigned int fragmentSize)
 {
 	m_ip = ip;
 	m_port = port;
+	m_listenBacklog = listenBacklog;
+	m_bReusePort = bReusePort;
+#ifndef __linux__
+	//ں˰SO_REUSEPORTַֻLinuxϿãƽ̨˻صaccept߳ģʽ
+	m_bReusePort = false;
+#endif
 	m_pEvBase = NULL;
 	m_bStarted = false;
 	m_bEnded = false;
@@ -29,26 +38,17 @@ RpcServer::RpcServer(const string &ip, int port,
 	WSAStartup(MAKEWORD(2, 2), &wsaData);
 #endif
 
-	//socketpairⲿ֪ͨserver
-	evutil_socket_t notif_fds[2];
-	evutil_socketpair(AF_INET, SOCK_STREAM, 0, notif_fds);
-	m_notified_fd = notif_fds[0];
-	m_notify_fd = notif_fds[1];
-
 	//ҵWorker
-	for (unsigned int i = 0; i < businessWorkerNum; ++i)
-		m_vecBusinessWorker.push_back(new BusinessWorker(businessWorkerQueueMaxSize));
+	m_pBusinessWorkerPool = new BusinessWorkerPool(businessWorkerNum, businessWorkerQueueMaxSize);
 
 	//IOWorker
 	for (unsigned int i = 0; i < IOWorkerNum; ++i)
 	{
-		evutil_socket_t fds[2];
-		if (evutil_socketpair(AF_INET, SOCK_STREAM, 0, fds) < 0)
-			continue;
-		//socketpair2óɷ
-		evutil_make_socket_nonblocking(fds[0]);
-		evutil_make_socket_nonblocking(fds[1]);
-		m_mapIOWorker[fds[1]] = new IOWorker(fds, IOWorkerAcceptQueueMaxSize, IOWorkerCompleteQueueMaxSize, &m_vecBusinessWorker);
+		IOWorker *pWorker = new IOWorker(IOWorkerAcceptQueueMaxSize, IOWorkerCompleteQueueMaxSize, m_pBusinessWorkerPool);
+		pWorker->setConnWindow(connWindow);
+		pWorker->setCompressThreshold(compressThreshold);
+		pWorker->setFragmentSize(fragmentSize);
+		m_vecIOWorker.push_back(pWorker);
 	}
 }
 
@@ -57,26 +57,50 @@ RpcServer::~RpcServer()
 	end();
 }
 
-void RpcServer::registerService(google::protobuf::Service *pService)
+void RpcServer::registerService(google::protobuf::Service *pService, bool bInline)
 {
-	if (NULL == pService)
+	RegisteredService *pRegisteredService = addService(pService);
+	if (NULL == pRegisteredService)
 		return;
+	pRegisteredService->vecInline.assign(pRegisteredService->vecMethod.size(), bInline);
+}
+
+void RpcServer::registerService(google::protobuf::Service *pService, const vector<string> &vecInlineMethod)
+{
+	RegisteredService *pRegisteredService = addService(pService);
+	if (NULL == pRegisteredService)
+		return;
+	//ִеķ
+	for (size_t i = 0; i < pRegisteredService->vecMethod.size(); ++i)
+	{
+		if (find(vecInlineMethod.begin(), vecInlineMethod.end(), pRegisteredService->vecMethod[i]->name()) != vecInlineMethod.end())
+			pRegisteredService->vecInline[i] = true;
+	}
+}
+
+RegisteredService *RpcServer::addService(google::protobuf::Service *pService)
+{
+	if (NULL == pService)
+		return NULL;
 	//ȡָ
 	const google::protobuf::ServiceDescriptor *pServiceDescriptor = pService->GetDescriptor();
 	if (NULL == pServiceDescriptor)
-		return;
+		return NULL;
 
-	pair<google::protobuf::Service *, vector<const google::protobuf::MethodDescriptor *> > &v = m_mapRegisteredService[pServiceDescriptor->full_name()];
+	RegisteredService &v = m_mapRegisteredService[pServiceDescriptor->full_name()];
 	//ŷָ
-	v.first = pService;
-	//ŷӦķָ
+	v.pService = pService;
+	//ŷӦķָ룬ظעʱ֮ǰ
+	v.vecMethod.clear();
 	for (int i = 0; i < pServiceDescriptor->method_count(); ++i)
 	{
 		const google::protobuf::MethodDescriptor *pMethodDescriptor = pServiceDescriptor->method(i);
 		if (NULL == pMethodDescriptor)
 			continue;
-		v.second.emplace_back(pMethodDescriptor);
+		v.vecMethod.emplace_back(pMethodDescriptor);
 	}
+	v.vecInline.assign(v.vecMethod.size(), false);
+	return &v;
 }
 
 void RpcServer::start()
@@ -99,38 +123,72 @@ void RpcServer::start()
 	if (0 == evutil_inet_pton(AF_INET, m_ip.c_str(), &(serverAddr.sin_addr)))
 		return;
 	serverAddr.sin_port = htons(m_port);
-	//libevent listenacceptaccept󽫻صacceptCallback()
-	evconnlistener *pListener = evconnlistener_new_bind(pEvBase, acceptCallback, this, LEV_OPT_CLOSE_ON_FREE, 128, (sockaddr *)(&serverAddr), sizeof(serverAddr));
-	if (NULL == pListener)
-		return;
-	//evconnlistenerָ󶨣ôevconnlistenerԶ
-	unique_ptr<evconnlistener, function<void(evconnlistener *)> > ptrListener(pListener, evconnlistener_free);
 
-	//IOWorker
-	for (auto it = m_mapIOWorker.begin(); it != m_mapIOWorker.end(); ++it)
+	//accept̵߳evconnlistenerSO_REUSEPORTģʽΪ
+	unique_ptr<evconnlistener, function<void(evconnlistener *)> > ptrListener(NULL, evconnlistener_free);
+	if (m_bReusePort)
 	{
-		if (NULL != it->second)
-			it->second->start();
+		//ΪÿIOWorkerԵļ׽֣IOWorkerԼevent_baselistenaccept
+		vector<evutil_socket_t> vecListen_fd;
+		for (auto it = m_vecIOWorker.begin(); it != m_vecIOWorker.end(); ++it)
+		{
+			evutil_socket_t listen_fd = createReusePortSocket(serverAddr);
+			if (listen_fd < 0)
+			{
+				for (auto itFd = vecListen_fd.begin(); itFd != vecListen_fd.end(); ++itFd)
+					evutil_closesocket(*itFd);
+				return;
+			}
+			vecListen_fd.push_back(listen_fd);
+		}
+		for (size_t i = 0; i < m_vecIOWorker.size(); ++i)
+		{
+			if (NULL != m_vecIOWorker[i])
+				m_vecIOWorker[i]->setListenFd(vecListen_fd[i], m_listenBacklog);
+			else
+				evutil_closesocket(vecListen_fd[i]);
+		}
+	}
+	else
+	{
+		//libevent listenacceptaccept󽫻صserverAcceptCallback()
+		evconnlistener *pListener = evconnlistener_new_bind(pEvBase, serverAcceptCallback, this, LEV_OPT_CLOSE_ON_FREE, m_listenBacklog, (sockaddr *)(&serverAddr), sizeof(serverAddr));
+		if (NULL == pListener)
+			return;
+		//evconnlistenerָ󶨣ôevconnlistenerԶ
+		ptrListener.reset(pListener);
 	}
 
-	//ҵWorker
-	for (auto it = m_vecBusinessWorker.begin(); it != m_vecBusinessWorker.end(); ++it)
+	//IOWorkerأһIOWorkerʧܣSO_REUSEPORTģʽ¼һߣʱ
+	for (auto it = m_vecIOWorker.begin(); it != m_vecIOWorker.end(); ++it)
 	{
 		if (NULL != *it)
 		{
-			//עз֪ҵWorker
+			//עз֪IOWorkerIOWorkerڶȡʱҷ
 			(*it)->setRegisteredServices(&m_mapRegisteredService);
-			(*it)->start();
+			if (!(*it)->start())
+			{
+				cerr << "RpcServer fails to start IOWorker " << (it - m_vecIOWorker.begin()) << ", giving up starting." << endl;
+				//IOWorkerҲٷ
+				end();
+				return;
+			}
 		}
 	}
 
-	//socketpairĶϵĿɶ¼
-	event *pNotifiedEv = event_new(pEvBase, m_notified_fd, EV_READ | EV_PERSIST, serverNotifiedCallback, this);
+	//ҵWorker
+	if (NULL != m_pBusinessWorkerPool)
+		m_pBusinessWorkerPool->start();
+
+	//֪ͨϵĿɶ¼
+	if (!m_notifier.isValid())
+		return;
+	event *pNotifiedEv = event_new(pEvBase, m_notifier.getFd(), EV_READ | EV_PERSIST, serverNotifiedCallback, this);
 	if (NULL == pNotifiedEv)
 		return;
 	//¼ָ󶨣ô¼Զ
 	unique_ptr<event, function<void(event *)> > ptrNotifiedEv(pNotifiedEv, event_free);
-	//socketpairĶϵĿɶ¼Ϊδ
+	//֪ͨϵĿɶ¼Ϊδ
 	event_add(pNotifiedEv, NULL);
 
 	m_pEvBase = pEvBase;
@@ -146,24 +204,17 @@ void RpcServer::end()
 	m_bEnded = true;
 
 	//IOWorker
-	for (auto it = m_mapIOWorker.begin(); it != m_mapIOWorker.end(); ++it)
-	{
-		if (NULL != it->second)
-			SAFE_DELETE(it->second)
-			//رsocketpairд
-			evutil_closesocket(it->first);
-	}
-
-	//ҵWorker
-	for (auto it = m_vecBusinessWorker.begin(); it != m_vecBusinessWorker.end(); ++it)
+	for (auto it = m_vecIOWorker.begin(); it != m_vecIOWorker.end(); ++it)
 	{
 		if (NULL != *it)
 			SAFE_DELETE(*it)
 	}
 
+	//ҵWorker
+	SAFE_DELETE(m_pBusinessWorkerPool)
+
 	//֪ͨRpcServer¼ѭ
-	char buf[1] = { NOTIFY_SERVER_END };
-	send(m_notify_fd, buf, 1, 0);
+	m_notifier.notify();
 }
 
 void serverNotifiedCallback(evutil_socket_t fd, short events, void *pArg)
@@ -171,26 +222,20 @@ void serverNotifiedCallback(evutil_socket_t fd, short events, void *pArg)
 	if (NULL == pArg)
 		return;
 
-	//ͨsocketpairĶȡ֪ͨ
-	char buf[1];
-	recv(fd, buf, 1, 0);
-
-	if (NOTIFY_SERVER_END == buf[0])
-		((RpcServer *)pArg)->handleEnd();
+	//RpcServerֻյ֪ͨ
+	((RpcServer *)pArg)->handleEnd();
 }
 
 void RpcServer::handleEnd()
 {
-	//رsocketpairĶд
-	evutil_closesocket(m_notified_fd);
-	evutil_closesocket(m_notify_fd);
+	m_notifier.consume();
 
 	//˳¼ѭ
 	if (NULL != m_pEvBase)
 		event_base_loopexit(m_pEvBase, NULL);
 }
 
-void acceptCallback(evconnlistener *pListener, evutil_socket_t fd, struct sockaddr *pAddr, int socklen, void *pArg)
+void serverAcceptCallback(evconnlistener *pListener, evutil_socket_t fd, struct sockaddr *pAddr, int socklen, void *pArg)
 {
 	if (NULL != pArg)
 		((RpcServer *)pArg)->handleAccept(fd);
@@ -205,13 +250,10 @@ void RpcServer::handleAccept(evutil_socket_t fd)
 	IOWorker *pSelectedWorker = schedule();
 	if (NULL != pSelectedWorker)
 	{
-		//ȡsocketpairд
-		evutil_socket_t selectedNotify_fd = pSelectedWorker->getNotify_fd();
 		//ѡIOWorkeraccept
 		pSelectedWorker->m_acceptQueue.put(fd);
 		//֪ͨѡеIOWorker
-		char buf[1] = { NOTIFY_IOWORKER_ACCEPT };
-		send(selectedNotify_fd, buf, 1, 0);
+		pSelectedWorker->notify();
 	}
 }
 
@@ -220,10 +262,10 @@ IOWorker *RpcServer::schedule()
 	IOWorker *pSelectedWorker = NULL;
 	unsigned int minBusyLevel;
 
-	auto it = m_mapIOWorker.begin();
-	for ( ; it != m_mapIOWorker.end(); ++it)
+	auto it = m_vecIOWorker.begin();
+	for ( ; it != m_vecIOWorker.end(); ++it)
 	{
-		IOWorker *pWorker = it->second;
+		IOWorker *pWorker = *it;
 		if (NULL != pWorker)
 		{
 			pSelectedWorker = pWorker;
@@ -235,9 +277,9 @@ IOWorker *RpcServer::schedule()
 	if (NULL == pSelectedWorker || minBusyLevel <= 0)
 		return pSelectedWorker;
 
-	for (++it; it != m_mapIOWorker.end(); ++it)
+	for (++it; it != m_vecIOWorker.end(); ++it)
 	{
-		IOWorker *pWorker = it->second;
+		IOWorker *pWorker = *it;
 		if (NULL != pWorker)
 		{
 			unsigned int busyLevel = pWorker->getBusyLevel();
@@ -252,4 +294,23 @@ IOWorker *RpcServer::schedule()
 		}
 	}
 	return pSelectedWorker;
+}
+
+evutil_socket_t RpcServer::createReusePortSocket(const sockaddr_in &serverAddr)
+{
+	evutil_socket_t fd = socket(AF_INET, SOCK_STREAM, 0);
+	if (fd < 0)
+		return -1;
+	//׽óɷevconnlistenerIOWorker¼ѭaccept
+	evutil_make_socket_nonblocking(fd);
+	evutil_make_socket_closeonexec(fd);
+	evutil_make_listen_socket_reuseable(fd);
+	//׽ְͬһַںַ֮
+	if (0 != evutil_make_listen_socket_reuseable_port(fd)
+		|| 0 != ::bind(fd, (const sockaddr *)(&serverAddr), sizeof(serverAddr)))
+	{
+		evutil_closesocket(fd);
+		return -1;
+	}
+	return fd;
 }
\ No newline at end of file
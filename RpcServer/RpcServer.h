@@ -4,6 +4,7 @@
 #include "RpcServerGlobal.h"
 #include "IOWorker.h"
 #include "BusinessWorker.h"
+#include "BusinessWorkerPool.h"
 #include "IRpcServer.h"
 
 /************************************************************************
@@ -11,6 +12,7 @@
 1accept߳acceptӣ
 2accept̵߳IOWorkerеIOWorkerӹӣÿIOWorkerɽӹܶӣ
 3IOWorkerҵWorkerеҵWorker󣬵õӦӦIOWorkerؿͻˡ
+SO_REUSEPORTģʽ12ΪÿIOWorkerԼͬһַں˷ַӣIOWorkerֱacceptӹӡ
 ************************************************************************/
 
 /************************************************************************
@@ -25,7 +27,7 @@ void serverNotifiedCallback(evutil_socket_t fd, short events, void *pArg);
   libevent evconnlistener_cb
 ֵ
 ************************************************************************/
-void acceptCallback(evconnlistener *pListener, evutil_socket_t fd, struct sockaddr *pAddr, int socklen, void *pArg);
+void serverAcceptCallback(evconnlistener *pListener, evutil_socket_t fd, struct sockaddr *pAddr, int socklen, void *pArg);
 
 //
 class RpcServer : public IRpcServer
@@ -41,11 +43,17 @@ public:
 		IOWorkerWriteQueueMaxSize룬IOWorkerͶе󳤶
 		businessWorkerNum룬ҵWorkerWorker
 		businessWorkerQueueMaxSize룬ҵWorkerҵе󳤶
+		listenBacklog룬׽ֵbacklog
+		bReusePort룬ǷÿIOWorkerSO_REUSEPORTaccept
+		connWindow룬ÿӵ;󴰿ڣΪ0ʾ
+		compressThreshold룬ӦѹֵΪ0ʾѹ
+		fragmentSize룬ӦķƬСΪ0ʾƬ
 	ֵ
 	************************************************************************/
 	RpcServer(const string &ip, int port, 
 		unsigned int IOWorkerNum, unsigned int IOWorkerAcceptQueueMaxSize, unsigned int IOWorkerCompleteQueueMaxSize, 
-		unsigned int businessWorkerNum, unsigned int businessWorkerQueueMaxSize);
+		unsigned int businessWorkerNum, unsigned int businessWorkerQueueMaxSize, 
+		int listenBacklog, bool bReusePort, unsigned int connWindow, unsigned int compressThreshold, unsigned int fragmentSize);
 
 	/************************************************************************
 	  ܣ
@@ -58,9 +66,20 @@ public:
 	  ܣע
 	  
 		pServiceָ
+		bInlineǷ÷зIOWorkerִ߳УĬΪfalse
+			ִеķҵWorkerʡȥο̵߳ĶкͻѣֻʺϺʱ̡ķ
 	ֵ
 	************************************************************************/
-	virtual void registerService(google::protobuf::Service *pService);
+	virtual void registerService(google::protobuf::Service *pService, bool bInline = false);
+
+	/************************************************************************
+	  ܣע񣬲ָIOWorkerִ߳еķ
+	  
+		pServiceָ
+		vecInlineMethodִеķеķҵWorkerִ
+	ֵ
+	************************************************************************/
+	virtual void registerService(google::protobuf::Service *pService, const vector<string> &vecInlineMethod);
 
 	/************************************************************************
 	  ܣRpcServer
@@ -92,6 +111,14 @@ public:
 	void handleAccept(evutil_socket_t fd);
 
 private:
+	/************************************************************************
+	  ܣӷ䷽ָ룬зĬϲִ
+	  
+		pServiceָ
+	ֵӵķָ룬ΪNULLʾʧ
+	************************************************************************/
+	RegisteredService *addService(google::protobuf::Service *pService);
+
 	/************************************************************************
 	  ܣIOWorkerеһIOWorkerӹ
 	  
@@ -99,22 +126,32 @@ private:
 	************************************************************************/
 	IOWorker *schedule();
 
+	/************************************************************************
+	  ܣSO_REUSEPORTѰ󶨷ַ׽֣δlisten
+	  
+		serverAddr룬ַ
+	ֵ׽С0ʾʧ
+	************************************************************************/
+	evutil_socket_t createReusePortSocket(const sockaddr_in &serverAddr);
+
 	//ipַ
 	string m_ip;
 	//Ķ˿ں
 	int m_port;
-	//ⲿעзmap<, pair<ָ, vector<ָ> > >
-	map<string, pair<google::protobuf::Service *, vector<const google::protobuf::MethodDescriptor *> > > m_mapRegisteredService;
-	//IOWorkerأmap<IOWorkerӦsocketpairд, IOWorkerָ>
-	map<evutil_socket_t, IOWorker *> m_mapIOWorker;
-	//ҵWorkerأvector<ҵWorkerָ>
-	vector<BusinessWorker *> m_vecBusinessWorker;
+	//׽ֵbacklog
+	int m_listenBacklog;
+	//ǷÿIOWorkerSO_REUSEPORTaccept
+	bool m_bReusePort;
+	//ⲿעзmap<, >
+	map<string, RegisteredService> m_mapRegisteredService;
+	//IOWorkerأvector<IOWorkerָ>
+	vector<IOWorker *> m_vecIOWorker;
+	//ҵWorkerָ
+	BusinessWorkerPool *m_pBusinessWorkerPool;
 	//event_baseָ
 	event_base *m_pEvBase;
-	//socketpairĶڽserver֪ͨ
-	evutil_socket_t m_notified_fd;
-	//socketpairд֪ͨserver
-	evutil_socket_t m_notify_fd;
+	//֪֪ͨͨserver
+	Notifier m_notifier;
 	//RpcServerǷѾʼ
 	bool m_bStarted;
 	//RpcServerǷѾʼ
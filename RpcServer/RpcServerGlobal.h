@@ -4,44 +4,115 @@
 #include <iostream>
 #include <string>
 #include <vector>
+#include <list>
 #include <map>
+#include <algorithm>
 #include <memory>
 #include <functional>
 #include <boost/thread/thread.hpp>
 #include <google/protobuf/descriptor.h>
 #include <google/protobuf/service.h>
+#include <google/protobuf/arena.h>
 #include <event2/util.h>
 #include <event2/event.h>
 #include <event2/listener.h>
 #include <event2/buffer.h>
 #include <event2/bufferevent.h>
 #include "SyncQueue.h"
+#include "RingQueue.h"
+#include "Notifier.h"
 #include "Global.h"
+#include "ProtocolCodec.h"
 #ifdef WIN32
 #include <winsock2.h>
 #endif
 
 using namespace std;
 
-//RpcServer͵֪ͨ
-enum NOTIFY_SERVER_TYPE
+//ȡҵʱÿ
+#define TASK_BATCH_SIZE 64
+//ҵWorkerArenaʼڴСMessageܴСʱڴ
+#define ARENA_INITIAL_BLOCK_SIZE (64 * 1024)
+//ҵWorkerArenaʼڴ󣬺ڴС
+#define ARENA_MAX_BLOCK_SIZE (1024 * 1024)
+//ҵWorkerౣĿArena
+#define ARENA_POOL_MAX_IDLE 256
+//ҵWorkerĶжʱɷͣϵļλΪ΢
+#define DISPATCH_RETRY_USEC 1000
+//ͻʽͻ˵ĳʼޣΪһͻ໺δȡϢ
+#define CLIENT_STREAM_MAX_WINDOW 1024
+
+//ҵĴ
+enum TASK_STATE
+{
+	//ɣӦѱ뵽ҵevbuffer
+	TASK_STATE_DONE = 0, 
+	//ʧܣҵevbufferѱͷ
+	TASK_STATE_FAILED = 1, 
+	//δɣdoneʱӦIOWorker
+	TASK_STATE_PENDING = 2
+};
+
+//עķ
+struct RegisteredService
 {
-	//֪ͨRpcServer¼ѭ
-	NOTIFY_SERVER_END = 0
+	//ָ
+	google::protobuf::Service *pService;
+	//Ӧķָ룬±꼴±
+	vector<const google::protobuf::MethodDescriptor *> vecMethod;
+	//ǷIOWorkerִ߳У±꼴±
+	vector<bool> vecInline;
+
+	RegisteredService()
+	{
+		pService = NULL;
+	}
 };
 
-//IOWorker͵֪ͨ
-enum NOTIFY_IOWORKER_TYPE
+//ҵõArenaʼڴṩReset()Ա̬´ٷ䡢ͷŶڴ
+//ֻһ߳ʹ
+struct TaskArena
 {
-	//ӹӣaccept߳acceptӣȻ֪ͨĳIOWorkerӹ
-	NOTIFY_IOWORKER_ACCEPT = 0, 
-	//ݣҵWorkerӦݣȻ֪ͨӦIOWorkerӦ
-	NOTIFY_IOWORKER_WRITE = 1, 
-	//֪ͨIOWorkerŽ
-	NOTIFY_IOWORKER_END = 2
+	//ʼڴ
+	vector<char> vecBlock;
+	//ArenavecBlock֮
+	google::protobuf::Arena arena;
+
+	TaskArena() : vecBlock(ARENA_INITIAL_BLOCK_SIZE), arena(makeOptions(vecBlock))
+	{
+	}
+
+	static google::protobuf::ArenaOptions makeOptions(vector<char> &vecBlock)
+	{
+		google::protobuf::ArenaOptions options;
+		options.initial_block = &vecBlock[0];
+		options.initial_block_size = vecBlock.size();
+		options.max_block_size = ARENA_MAX_BLOCK_SIZE;
+		return options;
+	}
 };
 
 class IOWorker;
+class ServerStream;
+struct BusinessTask;
+//ƬеĴӦ
+struct FragmentedFrame
+{
+	//Ƭid
+	fragmentId_t fragmentId;
+	//idͬһ֮Эͣ֡˳
+	callId_t callId;
+	//δЭ
+	evbuffer *pBuf;
+
+	FragmentedFrame()
+	{
+		fragmentId = 0;
+		callId = 0;
+		pBuf = NULL;
+	}
+};
+
 //
 struct Conn
 {
@@ -49,6 +120,8 @@ struct Conn
 	PROTOCOL_PART inState;
 	//ǰϵݵbody
 	bodySize_t inBodySize;
+	//˷ʱʹõЭ汾յͻ˵İ汾Э̺ȷ
+	unsigned char version;
 
 	//
 	evutil_socket_t fd;
@@ -60,15 +133,40 @@ struct Conn
 	unsigned int todoCount;
 	//ǷЧ
 	bool bValid;
+	//ͻǷ֧أ֧ʱ䷢Ͷ
+	bool bCredit;
+	//Ƿͣȡ;ﵽڻɷȥʱͣTCPѹؿͻ
+	bool bReadPaused;
+	//ҵWorkerĶжʱɷȥɷɹǰͣȡ
+	BusinessTask *pStalledTask;
+	//ͻЭ̳Ӧѹ㷨ΪCOMPRESS_NONEʾѹ
+	unsigned char compressType;
+	//ͻڱϰ󶨵ķ±ΪţֻIOWorker
+	vector<const RegisteredService *> vecBoundService;
+	//Ͻеķmap<id, ָ>ڰѿͻ˹黹ȽֻIOWorker
+	map<callId_t, ServerStream *> mapStream;
+	//ͻǷƬʱŷƬʹӦ
+	bool bFragment;
+	//һķƬid
+	fragmentId_t fragmentSeq;
+	//ƬеĴӦ͵˳
+	list<FragmentedFrame> listFragmented;
 
 	Conn()
 	{
 		inState = PROTOCOL_HEAD;
 		inBodySize = 0;
+		version = PROTOCOL_V1;
 		pBufEv = NULL;
 		pWorker = NULL;
 		todoCount = 0;
 		bValid = true;
+		bCredit = false;
+		bReadPaused = false;
+		pStalledTask = NULL;
+		compressType = COMPRESS_NONE;
+		bFragment = false;
+		fragmentSeq = 0;
 	}
 };
 
@@ -79,13 +177,42 @@ struct BusinessTask
 	IOWorker *pWorker;
 	//ҵ
 	evutil_socket_t conn_fd;
-	//ҵӵʱevbuffer
+	//ҵӵʱevbufferҵWorkerʱЭbodyɺӦЭݣhead + body
 	evbuffer *pBuf;
+	//IOWorkerЭbodyͼ
+	RequestView view;
+	//IOWorkerŻҵķ
+	const RegisteredService *pService;
+	//Ӧѹ㷨ȡӣΪCOMPRESS_NONEʾѹ
+	unsigned char compressType;
+	//ӦЭ汾ȡ
+	unsigned char version;
+	//ʽõɱҵӵУIOWorkerдҵӦENDERROR֡٣ͨʱΪNULL
+	ServerStream *pStream;
+	//ǷеһMESSAGE֡ȣҵĽϵ;
+	bool bStreamMessage;
 
 	BusinessTask()
 	{
 		pWorker = NULL;
 		pBuf = NULL;
+		pService = NULL;
+		compressType = COMPRESS_NONE;
+		version = PROTOCOL_V1;
+		pStream = NULL;
+		bStreamMessage = false;
+	}
+};
+
+//ʵֵRpcControllerʽʱͨҵServerStream::fromController()
+struct TaskController : public RpcController
+{
+	//ͨʱΪNULL
+	ServerStream *pStream;
+
+	TaskController()
+	{
+		pStream = NULL;
 	}
 };
 
@@ -0,0 +1,161 @@
+#include "ServerStream.h"
+#include "BusinessWorker.h"
+#include "ProtocolCodec.h"
+
+ServerStream *ServerStream::fromController(google::protobuf::RpcController *controller)
+{
+	TaskController *pController = dynamic_cast<TaskController *>(controller);
+	return (NULL == pController) ? NULL : pController->pStream;
+}
+
+ServerStream::ServerStream(BusinessTask *pTask, uint32_t window, uint32_t readWindow)
+{
+	m_pTask = pTask;
+	m_bWritable = (window > 0);
+	m_credit = window;
+	m_bCanceled = false;
+	m_readWindow = readWindow;
+	m_consumed = 0;
+	//ǿͻʽʱûϢɶ
+	m_bInputEnded = (0 == readWindow);
+}
+
+bool ServerStream::isWritable() const
+{
+	return m_bWritable;
+}
+
+uint32_t ServerStream::getReadWindow() const
+{
+	return m_readWindow;
+}
+
+BusinessTask *ServerStream::newFrameTask()
+{
+	BusinessTask *pTask = new BusinessTask();
+	pTask->pWorker = m_pTask->pWorker;
+	pTask->conn_fd = m_pTask->conn_fd;
+	pTask->compressType = m_pTask->compressType;
+	pTask->version = m_pTask->version;
+	pTask->bStreamMessage = true;
+	pTask->view.callId = m_pTask->view.callId;
+	pTask->pBuf = evbuffer_new();
+	if (NULL == pTask->pBuf)
+		SAFE_DELETE(pTask)
+	return pTask;
+}
+
+bool ServerStream::write(const google::protobuf::Message &msg)
+{
+	if (NULL == m_pTask || !m_bWritable)
+		return false;
+	{
+		boost::unique_lock<boost::mutex> lock(m_mutex);
+		while (0 == m_credit && !m_bCanceled)
+			m_cond.wait(lock);
+		if (m_bCanceled)
+			return false;
+		--m_credit;
+	}
+
+	//ÿϢһҵʽõҵͬһwriteлصIOWorker˳򲻱
+	BusinessTask *pTask = newFrameTask();
+	if (NULL == pTask || !ProtocolCodec::encodeStreamFrame(pTask->pBuf, m_pTask->view.callId, STREAM_MESSAGE, &msg, NULL, m_pTask->version))
+	{
+		if (NULL != pTask)
+			evbuffer_free(pTask->pBuf);
+		SAFE_DELETE(pTask)
+		//Ϣûз˻ض
+		boost::lock_guard<boost::mutex> lock(m_mutex);
+		++m_credit;
+		return false;
+	}
+	BusinessWorker::compressTask(pTask);
+	BusinessWorker::completeTask(pTask);
+	return true;
+}
+
+bool ServerStream::read(google::protobuf::Message *pMsg)
+{
+	std::string strContent;
+	uint32_t credit = 0;
+	{
+		boost::unique_lock<boost::mutex> lock(m_mutex);
+		while (m_queMessage.empty() && !m_bInputEnded && !m_bCanceled)
+			m_cond.wait(lock);
+		if (m_queMessage.empty() || m_bCanceled)
+			return false;
+		strContent.swap(m_queMessage.front());
+		m_queMessage.pop_front();
+
+		//ȡԼһ봰ڵϢ黹ȣͻ˲ÿϢһζȣͻдʱٹ黹
+		if (++m_consumed >= (m_readWindow + 1) / 2 && !m_bInputEnded)
+		{
+			credit = m_consumed;
+			m_consumed = 0;
+		}
+	}
+	//Ҳһҵ񣬾writeлصIOWorker
+	if (credit > 0)
+	{
+		BusinessTask *pTask = newFrameTask();
+		if (NULL != pTask && ProtocolCodec::encodeStreamCredit(pTask->pBuf, m_pTask->view.callId, credit, m_pTask->version))
+			BusinessWorker::completeTask(pTask);
+		else if (NULL != pTask)
+		{
+			evbuffer_free(pTask->pBuf);
+			SAFE_DELETE(pTask)
+		}
+	}
+
+	return NULL != pMsg && pMsg->ParseFromString(strContent);
+}
+
+void ServerStream::push(std::string *pContent)
+{
+	boost::lock_guard<boost::mutex> lock(m_mutex);
+	if (m_bInputEnded || m_bCanceled)
+		return;
+	//δȡϢᳬڣ˵ͻ˲ضȣȡʵ漴
+	if (m_queMessage.size() >= m_readWindow)
+	{
+		m_bCanceled = true;
+		m_cond.notify_all();
+		return;
+	}
+	m_queMessage.push_back(std::string());
+	m_queMessage.back().swap(*pContent);
+	//ȡֻ߳ûϢʱȴ
+	if (1 == m_queMessage.size())
+		m_cond.notify_all();
+}
+
+void ServerStream::endInput()
+{
+	boost::lock_guard<boost::mutex> lock(m_mutex);
+	m_bInputEnded = true;
+	m_cond.notify_all();
+}
+
+bool ServerStream::isCanceled()
+{
+	boost::lock_guard<boost::mutex> lock(m_mutex);
+	return m_bCanceled;
+}
+
+void ServerStream::grant(uint32_t credit)
+{
+	boost::lock_guard<boost::mutex> lock(m_mutex);
+	bool bWake = (0 == m_credit);
+	m_credit += credit;
+	if (bWake)
+		m_cond.notify_all();
+}
+
+void ServerStream::cancel()
+{
+	boost::lock_guard<boost::mutex> lock(m_mutex);
+	m_bCanceled = true;
+	//д̺߳Ͷȡ߳̿ͬʱڵȴ
+	m_cond.notify_all();
+}
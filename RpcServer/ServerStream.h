@@ -0,0 +1,163 @@
+#ifndef _SERVERSTREAM_H_
+#define _SERVERSTREAM_H_
+
+#ifdef WIN32
+#ifdef RPCSERVER_EXPORTS
+#define RPCSERVER_DLL_EXPORTS __declspec(dllexport)
+#else
+#define RPCSERVER_DLL_EXPORTS __declspec(dllimport)
+#endif
+#else
+#define RPCSERVER_DLL_EXPORTS
+#endif
+
+#include <cstdint>
+#include <string>
+#include <deque>
+#include <google/protobuf/service.h>
+#include <google/protobuf/message.h>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
+
+struct BusinessTask;
+//ʵͨѽֳɶϢͻˣǷŽһ޴ĳΣȡͻ˷Ϣ
+//1ͻIRpcChannel::startStream()startClientStream()ĵòʵfromController()ȡ
+//2ʽУÿϢ1ͻĶȣʱwrite()ֱͻϢ黹ȣ
+//   Ŀͻ˷Ϊռõڴ棻
+//3ͻʽУread()ȡͻ˷ϢȡԼһ봰ں黹ȣͻ˶ʱͣͣ
+//   ˶ȡķʵΪռõڴ棻ʵֶdoneΪͨӦظͻˣ
+//4write()read()ʵӦ첽ɵķһԼ߳дȡҪռҵWorker
+//5ϢдdonedoneǰRpcController::SetFailed()˴ʱʧܽ
+//   βΪʱ֡ͣͻ˰һϢ˲ʹķʵҲʽã
+//   doneúٷ
+//6ͬһʱֻһ߳д롢һ̶߳ȡͬһ
+class RPCSERVER_DLL_EXPORTS ServerStream
+{
+public:
+	/************************************************************************
+	  ܣȡõķ
+	  
+		controller룬ʵֵRpcControllerָ
+	ֵָ룬ΪNULLʾʽ
+	************************************************************************/
+	static ServerStream *fromController(google::protobuf::RpcController *controller);
+
+	/************************************************************************
+	  ܣͻ˷һϢʱȴ
+	  
+		msg룬ϢһǷ͵Message
+	ֵ
+		trueϢѽIOWorker
+		falseǷʽãͻȡѳʱѶϿʵӦֹͣд벢done
+	************************************************************************/
+	bool write(const google::protobuf::Message &msg);
+
+	/************************************************************************
+	  ܣȡͻ˷һϢûѵϢʱȴ
+	  
+		pMsgϢһǷ͵Message
+	ֵ
+		trueȡɹ
+		falseͻдϢǿͻʽáѱȡϢлʧʱҲfalse
+	************************************************************************/
+	bool read(google::protobuf::Message *pMsg);
+
+	/************************************************************************
+	  ܣǷѱȡͻȡóʱӶϿ̵߳
+	  
+	ֵ
+		trueȡ
+		falseδȡ
+	************************************************************************/
+	bool isCanceled();
+
+	/************************************************************************
+	  ܣ췽IOWorkerɷʽõҵǰ
+	  
+		pTask룬ʽõҵָ룬ӵ
+		window룬ͻ˳ʼϢȣΪ0ʾǷʽ
+		readWindow룬ͻ˵ĳʼϢȣ໺δȡϢΪ0ʾǿͻʽ
+	ֵ
+	************************************************************************/
+	ServerStream(BusinessTask *pTask, uint32_t window, uint32_t readWindow);
+
+	/************************************************************************
+	  ܣǷǷʽ
+	  
+	ֵ
+		true
+		false
+	************************************************************************/
+	bool isWritable() const;
+
+	/************************************************************************
+	  ܣȡͻ˵ĳʼϢ
+	  
+	ֵΪ0ʾǿͻʽ
+	************************************************************************/
+	uint32_t getReadWindow() const;
+
+	/************************************************************************
+	  ܣյͻ˷һϢIOWorker̵߳ãͻ˲ضȡʱȡ
+	  
+		pContentлϢݱУ
+	ֵ
+	************************************************************************/
+	void push(std::string *pContent);
+
+	/************************************************************************
+	  ܣͻдϢIOWorker̵߳
+	  
+	ֵ
+	************************************************************************/
+	void endInput();
+
+	/************************************************************************
+	  ܣӿͻ˹黹ĶȣIOWorker̵߳
+	  
+		credit룬
+	ֵ
+	************************************************************************/
+	void grant(uint32_t credit);
+
+	/************************************************************************
+	  ܣȡд룬IOWorker̵߳
+	  
+	ֵ
+	************************************************************************/
+	void cancel();
+
+private:
+	ServerStream(const ServerStream &);
+	ServerStream &operator=(const ServerStream &);
+
+	/************************************************************************
+	  ܣӵҵĽϵ;
+	  
+	ֵҵָ룬evbufferѴΪNULLʾʧ
+	************************************************************************/
+	BusinessTask *newFrameTask();
+
+	//ʽõҵIOWorkerӺ͵idڹMESSAGE֡ȵҵ
+	BusinessTask *m_pTask;
+	//ȡϢкȡǵ
+	boost::mutex m_mutex;
+	//ʱд̡߳ûϢʱȡ߳ϵȴ
+	boost::condition_variable m_cond;
+	//ǷǷʽ
+	bool m_bWritable;
+	//ʣϢ
+	uint32_t m_credit;
+	//Ƿȡ
+	bool m_bCanceled;
+	//ͻ˷δȡϢ
+	std::deque<std::string> m_queMessage;
+	//ͻ˵ĳʼϢ
+	uint32_t m_readWindow;
+	//ϴι黹ȺȡϢ
+	uint32_t m_consumed;
+	//ͻǷдϢ
+	bool m_bInputEnded;
+};
+
+#endif
@@ -1,602 +1,561 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: Test.proto
 
-#define INTERNAL_SUPPRESS_PROTOBUF_FIELD_DEPRECATION
 #include "Test.pb.h"
 
 #include <algorithm>
 
-#include <google/protobuf/stubs/common.h>
-#include <google/protobuf/stubs/once.h>
 #include <google/protobuf/io/coded_stream.h>
-#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
 #include <google/protobuf/descriptor.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/reflection_ops.h>
 #include <google/protobuf/wire_format.h>
 // @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
 
-namespace testNamespace {
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
-namespace {
-
-const ::google::protobuf::Descriptor* NumRequest_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  NumRequest_reflection_ = NULL;
-const ::google::protobuf::Descriptor* NumResponse_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  NumResponse_reflection_ = NULL;
-const ::google::protobuf::ServiceDescriptor* NumService_descriptor_ = NULL;
-
-}  // namespace
-
-
-void protobuf_AssignDesc_Test_2eproto() {
-  protobuf_AddDesc_Test_2eproto();
-  const ::google::protobuf::FileDescriptor* file =
-    ::google::protobuf::DescriptorPool::generated_pool()->FindFileByName(
-      "Test.proto");
-  GOOGLE_CHECK(file != NULL);
-  NumRequest_descriptor_ = file->message_type(0);
-  static const int NumRequest_offsets_[2] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(NumRequest, input1_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(NumRequest, input2_),
+namespace testNamespace {
+PROTOBUF_CONSTEXPR NumRequest::NumRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.input1_)*/0
+  , /*decltype(_impl_.input2_)*/0} {}
+struct NumRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR NumRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~NumRequestDefaultTypeInternal() {}
+  union {
+    NumRequest _instance;
   };
-  NumRequest_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      NumRequest_descriptor_,
-      NumRequest::default_instance_,
-      NumRequest_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(NumRequest, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(NumRequest, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(NumRequest));
-  NumResponse_descriptor_ = file->message_type(1);
-  static const int NumResponse_offsets_[1] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(NumResponse, output_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 NumRequestDefaultTypeInternal _NumRequest_default_instance_;
+PROTOBUF_CONSTEXPR NumResponse::NumResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.output_)*/0} {}
+struct NumResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR NumResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~NumResponseDefaultTypeInternal() {}
+  union {
+    NumResponse _instance;
   };
-  NumResponse_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      NumResponse_descriptor_,
-      NumResponse::default_instance_,
-      NumResponse_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(NumResponse, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(NumResponse, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(NumResponse));
-  NumService_descriptor_ = file->service(0);
-}
-
-namespace {
-
-GOOGLE_PROTOBUF_DECLARE_ONCE(protobuf_AssignDescriptors_once_);
-inline void protobuf_AssignDescriptorsOnce() {
-  ::google::protobuf::GoogleOnceInit(&protobuf_AssignDescriptors_once_,
-                 &protobuf_AssignDesc_Test_2eproto);
-}
-
-void protobuf_RegisterTypes(const ::std::string&) {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    NumRequest_descriptor_, &NumRequest::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    NumResponse_descriptor_, &NumResponse::default_instance());
-}
-
-}  // namespace
-
-void protobuf_ShutdownFile_Test_2eproto() {
-  delete NumRequest::default_instance_;
-  delete NumRequest_reflection_;
-  delete NumResponse::default_instance_;
-  delete NumResponse_reflection_;
-}
-
-void protobuf_AddDesc_Test_2eproto() {
-  static bool already_here = false;
-  if (already_here) return;
-  already_here = true;
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
-    "\n\nTest.proto\022\rtestNamespace\",\n\nNumReques"
-    "t\022\016\n\006input1\030\001 \001(\005\022\016\n\006input2\030\002 \001(\005\"\035\n\013Num"
-    "Response\022\016\n\006output\030\001 \001(\0052\212\001\n\nNumService\022"
-    "<\n\003add\022\031.testNamespace.NumRequest\032\032.test"
-    "Namespace.NumResponse\022>\n\005minus\022\031.testNam"
-    "espace.NumRequest\032\032.testNamespace.NumRes"
-    "ponseB\003\200\001\001", 250);
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
-    "Test.proto", &protobuf_RegisterTypes);
-  NumRequest::default_instance_ = new NumRequest();
-  NumResponse::default_instance_ = new NumResponse();
-  NumRequest::default_instance_->InitAsDefaultInstance();
-  NumResponse::default_instance_->InitAsDefaultInstance();
-  ::google::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_Test_2eproto);
-}
-
-// Force AddDescriptors() to be called at static initialization time.
-struct StaticDescriptorInitializer_Test_2eproto {
-  StaticDescriptorInitializer_Test_2eproto() {
-    protobuf_AddDesc_Test_2eproto();
-  }
-} static_descriptor_initializer_Test_2eproto_;
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 NumResponseDefaultTypeInternal _NumResponse_default_instance_;
+}  // namespace testNamespace
+static ::_pb::Metadata file_level_metadata_Test_2eproto[2];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_Test_2eproto = nullptr;
+static const ::_pb::ServiceDescriptor* file_level_service_descriptors_Test_2eproto[1];
+
+const uint32_t TableStruct_Test_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::testNamespace::NumRequest, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::testNamespace::NumRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::testNamespace::NumRequest, _impl_.input1_),
+  PROTOBUF_FIELD_OFFSET(::testNamespace::NumRequest, _impl_.input2_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::testNamespace::NumResponse, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::testNamespace::NumResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::testNamespace::NumResponse, _impl_.output_),
+  0,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 8, -1, sizeof(::testNamespace::NumRequest)},
+  { 10, 17, -1, sizeof(::testNamespace::NumResponse)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::testNamespace::_NumRequest_default_instance_._instance,
+  &::testNamespace::_NumResponse_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_Test_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\nTest.proto\022\rtestNamespace\",\n\nNumReques"
+  "t\022\016\n\006input1\030\001 \001(\005\022\016\n\006input2\030\002 \001(\005\"\035\n\013Num"
+  "Response\022\016\n\006output\030\001 \001(\0052\210\002\n\nNumService\022"
+  "<\n\003add\022\031.testNamespace.NumRequest\032\032.test"
+  "Namespace.NumResponse\022>\n\005minus\022\031.testNam"
+  "espace.NumRequest\032\032.testNamespace.NumRes"
+  "ponse\022>\n\005range\022\031.testNamespace.NumReques"
+  "t\032\032.testNamespace.NumResponse\022<\n\003sum\022\031.t"
+  "estNamespace.NumRequest\032\032.testNamespace."
+  "NumResponseB\006\200\001\001\370\001\001"
+  ;
+static ::_pbi::once_flag descriptor_table_Test_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_Test_2eproto = {
+    false, false, 379, descriptor_table_protodef_Test_2eproto,
+    "Test.proto",
+    &descriptor_table_Test_2eproto_once, nullptr, 0, 2,
+    schemas, file_default_instances, TableStruct_Test_2eproto::offsets,
+    file_level_metadata_Test_2eproto, file_level_enum_descriptors_Test_2eproto,
+    file_level_service_descriptors_Test_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_Test_2eproto_getter() {
+  return &descriptor_table_Test_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_Test_2eproto(&descriptor_table_Test_2eproto);
+namespace testNamespace {
 
 // ===================================================================
 
-#ifndef _MSC_VER
-const int NumRequest::kInput1FieldNumber;
-const int NumRequest::kInput2FieldNumber;
-#endif  // !_MSC_VER
-
-NumRequest::NumRequest()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
+class NumRequest::_Internal {
+ public:
+  using HasBits = decltype(std::declval<NumRequest>()._impl_._has_bits_);
+  static void set_has_input1(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_input2(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
 
-void NumRequest::InitAsDefaultInstance() {
+NumRequest::NumRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:testNamespace.NumRequest)
 }
-
 NumRequest::NumRequest(const NumRequest& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void NumRequest::SharedCtor() {
-  _cached_size_ = 0;
-  input1_ = 0;
-  input2_ = 0;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  NumRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.input1_){}
+    , decltype(_impl_.input2_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.input1_, &from._impl_.input1_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.input2_) -
+    reinterpret_cast<char*>(&_impl_.input1_)) + sizeof(_impl_.input2_));
+  // @@protoc_insertion_point(copy_constructor:testNamespace.NumRequest)
+}
+
+inline void NumRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.input1_){0}
+    , decltype(_impl_.input2_){0}
+  };
 }
 
 NumRequest::~NumRequest() {
+  // @@protoc_insertion_point(destructor:testNamespace.NumRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void NumRequest::SharedDtor() {
-  if (this != default_instance_) {
-  }
+inline void NumRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
 void NumRequest::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* NumRequest::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return NumRequest_descriptor_;
-}
-
-const NumRequest& NumRequest::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_Test_2eproto();
-  return *default_instance_;
-}
-
-NumRequest* NumRequest::default_instance_ = NULL;
-
-NumRequest* NumRequest::New() const {
-  return new NumRequest;
+  _impl_._cached_size_.Set(size);
 }
 
 void NumRequest::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    input1_ = 0;
-    input2_ = 0;
+// @@protoc_insertion_point(message_clear_start:testNamespace.NumRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.input1_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.input2_) -
+        reinterpret_cast<char*>(&_impl_.input1_)) + sizeof(_impl_.input2_));
   }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-bool NumRequest::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* NumRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // optional int32 input1 = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &input1_)));
-          set_has_input1();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(16)) goto parse_input2;
-        break;
-      }
-
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_input1(&has_bits);
+          _impl_.input1_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional int32 input2 = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_input2:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &input2_)));
-          set_has_input2();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_input2(&has_bits);
+          _impl_.input2_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-  return true;
-#undef DO_
-}
-
-void NumRequest::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* NumRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:testNamespace.NumRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // optional int32 input1 = 1;
-  if (has_input1()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(1, this->input1(), output);
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_input1(), target);
   }
 
   // optional int32 input2 = 2;
-  if (has_input2()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(2, this->input2(), output);
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_input2(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
-  }
-}
-
-::google::protobuf::uint8* NumRequest::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // optional int32 input1 = 1;
-  if (has_input1()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(1, this->input1(), target);
-  }
-
-  // optional int32 input2 = 2;
-  if (has_input2()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(2, this->input2(), target);
-  }
-
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:testNamespace.NumRequest)
   return target;
 }
 
-int NumRequest::ByteSize() const {
-  int total_size = 0;
+size_t NumRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:testNamespace.NumRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
     // optional int32 input1 = 1;
-    if (has_input1()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->input1());
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_input1());
     }
 
     // optional int32 input2 = 2;
-    if (has_input2()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->input2());
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_input2());
     }
 
   }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
-
-void NumRequest::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const NumRequest* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const NumRequest*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void NumRequest::MergeFrom(const NumRequest& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_input1()) {
-      set_input1(from.input1());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData NumRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    NumRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*NumRequest::GetClassData() const { return &_class_data_; }
+
+
+void NumRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<NumRequest*>(&to_msg);
+  auto& from = static_cast<const NumRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:testNamespace.NumRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.input1_ = from._impl_.input1_;
     }
-    if (from.has_input2()) {
-      set_input2(from.input2());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.input2_ = from._impl_.input2_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void NumRequest::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void NumRequest::CopyFrom(const NumRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:testNamespace.NumRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool NumRequest::IsInitialized() const {
-
   return true;
 }
 
-void NumRequest::Swap(NumRequest* other) {
-  if (other != this) {
-    std::swap(input1_, other->input1_);
-    std::swap(input2_, other->input2_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void NumRequest::InternalSwap(NumRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(NumRequest, _impl_.input2_)
+      + sizeof(NumRequest::_impl_.input2_)
+      - PROTOBUF_FIELD_OFFSET(NumRequest, _impl_.input1_)>(
+          reinterpret_cast<char*>(&_impl_.input1_),
+          reinterpret_cast<char*>(&other->_impl_.input1_));
 }
 
-::google::protobuf::Metadata NumRequest::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = NumRequest_descriptor_;
-  metadata.reflection = NumRequest_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata NumRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_Test_2eproto_getter, &descriptor_table_Test_2eproto_once,
+      file_level_metadata_Test_2eproto[0]);
 }
 
-
 // ===================================================================
 
-#ifndef _MSC_VER
-const int NumResponse::kOutputFieldNumber;
-#endif  // !_MSC_VER
-
-NumResponse::NumResponse()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
+class NumResponse::_Internal {
+ public:
+  using HasBits = decltype(std::declval<NumResponse>()._impl_._has_bits_);
+  static void set_has_output(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
 
-void NumResponse::InitAsDefaultInstance() {
+NumResponse::NumResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:testNamespace.NumResponse)
 }
-
 NumResponse::NumResponse(const NumResponse& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void NumResponse::SharedCtor() {
-  _cached_size_ = 0;
-  output_ = 0;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  NumResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.output_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.output_ = from._impl_.output_;
+  // @@protoc_insertion_point(copy_constructor:testNamespace.NumResponse)
+}
+
+inline void NumResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.output_){0}
+  };
 }
 
 NumResponse::~NumResponse() {
+  // @@protoc_insertion_point(destructor:testNamespace.NumResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void NumResponse::SharedDtor() {
-  if (this != default_instance_) {
-  }
+inline void NumResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
 void NumResponse::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* NumResponse::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return NumResponse_descriptor_;
-}
-
-const NumResponse& NumResponse::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_Test_2eproto();
-  return *default_instance_;
-}
-
-NumResponse* NumResponse::default_instance_ = NULL;
-
-NumResponse* NumResponse::New() const {
-  return new NumResponse;
+  _impl_._cached_size_.Set(size);
 }
 
 void NumResponse::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    output_ = 0;
-  }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool NumResponse::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+// @@protoc_insertion_point(message_clear_start:testNamespace.NumResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.output_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* NumResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // optional int32 output = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &output_)));
-          set_has_output();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_output(&has_bits);
+          _impl_.output_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-  return true;
-#undef DO_
-}
-
-void NumResponse::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* NumResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:testNamespace.NumResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // optional int32 output = 1;
-  if (has_output()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(1, this->output(), output);
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_output(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:testNamespace.NumResponse)
+  return target;
 }
 
-::google::protobuf::uint8* NumResponse::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
+size_t NumResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:testNamespace.NumResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // optional int32 output = 1;
-  if (has_output()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(1, this->output(), target);
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_output());
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
-  }
-  return target;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-int NumResponse::ByteSize() const {
-  int total_size = 0;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData NumResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    NumResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*NumResponse::GetClassData() const { return &_class_data_; }
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // optional int32 output = 1;
-    if (has_output()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->output());
-    }
 
-  }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
-
-void NumResponse::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const NumResponse* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const NumResponse*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
-}
+void NumResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<NumResponse*>(&to_msg);
+  auto& from = static_cast<const NumResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:testNamespace.NumResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void NumResponse::MergeFrom(const NumResponse& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_output()) {
-      set_output(from.output());
-    }
+  if (from._internal_has_output()) {
+    _this->_internal_set_output(from._internal_output());
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void NumResponse::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void NumResponse::CopyFrom(const NumResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:testNamespace.NumResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool NumResponse::IsInitialized() const {
-
   return true;
 }
 
-void NumResponse::Swap(NumResponse* other) {
-  if (other != this) {
-    std::swap(output_, other->output_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void NumResponse::InternalSwap(NumResponse* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.output_, other->_impl_.output_);
 }
 
-::google::protobuf::Metadata NumResponse::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = NumResponse_descriptor_;
-  metadata.reflection = NumResponse_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata NumResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_Test_2eproto_getter, &descriptor_table_Test_2eproto_once,
+      file_level_metadata_Test_2eproto[1]);
 }
 
-
 // ===================================================================
 
 NumService::~NumService() {}
 
-const ::google::protobuf::ServiceDescriptor* NumService::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return NumService_descriptor_;
+const ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor* NumService::descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_Test_2eproto);
+  return file_level_service_descriptors_Test_2eproto[0];
 }
 
-const ::google::protobuf::ServiceDescriptor* NumService::GetDescriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return NumService_descriptor_;
+const ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor* NumService::GetDescriptor() {
+  return descriptor();
 }
 
-void NumService::add(::google::protobuf::RpcController* controller,
+void NumService::add(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
                          const ::testNamespace::NumRequest*,
                          ::testNamespace::NumResponse*,
                          ::google::protobuf::Closure* done) {
@@ -604,7 +563,7 @@ void NumService::add(::google::protobuf::RpcController* controller,
   done->Run();
 }
 
-void NumService::minus(::google::protobuf::RpcController* controller,
+void NumService::minus(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
                          const ::testNamespace::NumRequest*,
                          ::testNamespace::NumResponse*,
                          ::google::protobuf::Closure* done) {
@@ -612,23 +571,59 @@ void NumService::minus(::google::protobuf::RpcController* controller,
   done->Run();
 }
 
-void NumService::CallMethod(const ::google::protobuf::MethodDescriptor* method,
-                             ::google::protobuf::RpcController* controller,
-                             const ::google::protobuf::Message* request,
-                             ::google::protobuf::Message* response,
+void NumService::range(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                         const ::testNamespace::NumRequest*,
+                         ::testNamespace::NumResponse*,
+                         ::google::protobuf::Closure* done) {
+  controller->SetFailed("Method range() not implemented.");
+  done->Run();
+}
+
+void NumService::sum(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                         const ::testNamespace::NumRequest*,
+                         ::testNamespace::NumResponse*,
+                         ::google::protobuf::Closure* done) {
+  controller->SetFailed("Method sum() not implemented.");
+  done->Run();
+}
+
+void NumService::CallMethod(const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method,
+                             ::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                             const ::PROTOBUF_NAMESPACE_ID::Message* request,
+                             ::PROTOBUF_NAMESPACE_ID::Message* response,
                              ::google::protobuf::Closure* done) {
-  GOOGLE_DCHECK_EQ(method->service(), NumService_descriptor_);
+  GOOGLE_DCHECK_EQ(method->service(), file_level_service_descriptors_Test_2eproto[0]);
   switch(method->index()) {
     case 0:
       add(controller,
-             ::google::protobuf::down_cast<const ::testNamespace::NumRequest*>(request),
-             ::google::protobuf::down_cast< ::testNamespace::NumResponse*>(response),
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<const ::testNamespace::NumRequest*>(
+                 request),
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<::testNamespace::NumResponse*>(
+                 response),
              done);
       break;
     case 1:
       minus(controller,
-             ::google::protobuf::down_cast<const ::testNamespace::NumRequest*>(request),
-             ::google::protobuf::down_cast< ::testNamespace::NumResponse*>(response),
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<const ::testNamespace::NumRequest*>(
+                 request),
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<::testNamespace::NumResponse*>(
+                 response),
+             done);
+      break;
+    case 2:
+      range(controller,
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<const ::testNamespace::NumRequest*>(
+                 request),
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<::testNamespace::NumResponse*>(
+                 response),
+             done);
+      break;
+    case 3:
+      sum(controller,
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<const ::testNamespace::NumRequest*>(
+                 request),
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<::testNamespace::NumResponse*>(
+                 response),
              done);
       break;
     default:
@@ -637,62 +632,96 @@ void NumService::CallMethod(const ::google::protobuf::MethodDescriptor* method,
   }
 }
 
-const ::google::protobuf::Message& NumService::GetRequestPrototype(
-    const ::google::protobuf::MethodDescriptor* method) const {
+const ::PROTOBUF_NAMESPACE_ID::Message& NumService::GetRequestPrototype(
+    const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method) const {
   GOOGLE_DCHECK_EQ(method->service(), descriptor());
   switch(method->index()) {
     case 0:
       return ::testNamespace::NumRequest::default_instance();
     case 1:
       return ::testNamespace::NumRequest::default_instance();
+    case 2:
+      return ::testNamespace::NumRequest::default_instance();
+    case 3:
+      return ::testNamespace::NumRequest::default_instance();
     default:
       GOOGLE_LOG(FATAL) << "Bad method index; this should never happen.";
-      return *reinterpret_cast< ::google::protobuf::Message*>(NULL);
+      return *::PROTOBUF_NAMESPACE_ID::MessageFactory::generated_factory()
+          ->GetPrototype(method->input_type());
   }
 }
 
-const ::google::protobuf::Message& NumService::GetResponsePrototype(
-    const ::google::protobuf::MethodDescriptor* method) const {
+const ::PROTOBUF_NAMESPACE_ID::Message& NumService::GetResponsePrototype(
+    const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method) const {
   GOOGLE_DCHECK_EQ(method->service(), descriptor());
   switch(method->index()) {
     case 0:
       return ::testNamespace::NumResponse::default_instance();
     case 1:
       return ::testNamespace::NumResponse::default_instance();
+    case 2:
+      return ::testNamespace::NumResponse::default_instance();
+    case 3:
+      return ::testNamespace::NumResponse::default_instance();
     default:
       GOOGLE_LOG(FATAL) << "Bad method index; this should never happen.";
-      return *reinterpret_cast< ::google::protobuf::Message*>(NULL);
+      return *::PROTOBUF_NAMESPACE_ID::MessageFactory::generated_factory()
+          ->GetPrototype(method->output_type());
   }
 }
 
-NumService_Stub::NumService_Stub(::google::protobuf::RpcChannel* channel)
+NumService_Stub::NumService_Stub(::PROTOBUF_NAMESPACE_ID::RpcChannel* channel)
   : channel_(channel), owns_channel_(false) {}
 NumService_Stub::NumService_Stub(
-    ::google::protobuf::RpcChannel* channel,
-    ::google::protobuf::Service::ChannelOwnership ownership)
+    ::PROTOBUF_NAMESPACE_ID::RpcChannel* channel,
+    ::PROTOBUF_NAMESPACE_ID::Service::ChannelOwnership ownership)
   : channel_(channel),
-    owns_channel_(ownership == ::google::protobuf::Service::STUB_OWNS_CHANNEL) {}
+    owns_channel_(ownership == ::PROTOBUF_NAMESPACE_ID::Service::STUB_OWNS_CHANNEL) {}
 NumService_Stub::~NumService_Stub() {
   if (owns_channel_) delete channel_;
 }
 
-void NumService_Stub::add(::google::protobuf::RpcController* controller,
+void NumService_Stub::add(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
                               const ::testNamespace::NumRequest* request,
                               ::testNamespace::NumResponse* response,
                               ::google::protobuf::Closure* done) {
   channel_->CallMethod(descriptor()->method(0),
                        controller, request, response, done);
 }
-void NumService_Stub::minus(::google::protobuf::RpcController* controller,
+void NumService_Stub::minus(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
                               const ::testNamespace::NumRequest* request,
                               ::testNamespace::NumResponse* response,
                               ::google::protobuf::Closure* done) {
   channel_->CallMethod(descriptor()->method(1),
                        controller, request, response, done);
 }
+void NumService_Stub::range(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                              const ::testNamespace::NumRequest* request,
+                              ::testNamespace::NumResponse* response,
+                              ::google::protobuf::Closure* done) {
+  channel_->CallMethod(descriptor()->method(2),
+                       controller, request, response, done);
+}
+void NumService_Stub::sum(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                              const ::testNamespace::NumRequest* request,
+                              ::testNamespace::NumResponse* response,
+                              ::google::protobuf::Closure* done) {
+  channel_->CallMethod(descriptor()->method(3),
+                       controller, request, response, done);
+}
 
 // @@protoc_insertion_point(namespace_scope)
-
 }  // namespace testNamespace
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::testNamespace::NumRequest*
+Arena::CreateMaybeMessage< ::testNamespace::NumRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::testNamespace::NumRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::testNamespace::NumResponse*
+Arena::CreateMaybeMessage< ::testNamespace::NumResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::testNamespace::NumResponse >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -1,221 +1,404 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: Test.proto
 
-#ifndef PROTOBUF_Test_2eproto__INCLUDED
-#define PROTOBUF_Test_2eproto__INCLUDED
+#ifndef GOOGLE_PROTOBUF_INCLUDED_Test_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_Test_2eproto
 
+#include <limits>
 #include <string>
 
-#include <google/protobuf/stubs/common.h>
-
-#if GOOGLE_PROTOBUF_VERSION < 2005000
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please update
+#error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 2005000 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please
+#error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
 #endif
 
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
 #include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
-#include <google/protobuf/repeated_field.h>
-#include <google/protobuf/extension_set.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
 #include <google/protobuf/service.h>
 #include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
-
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_Test_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_Test_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_Test_2eproto;
 namespace testNamespace {
-
-// Internal implementation detail -- do not call these.
-void  protobuf_AddDesc_Test_2eproto();
-void protobuf_AssignDesc_Test_2eproto();
-void protobuf_ShutdownFile_Test_2eproto();
-
 class NumRequest;
+struct NumRequestDefaultTypeInternal;
+extern NumRequestDefaultTypeInternal _NumRequest_default_instance_;
 class NumResponse;
+struct NumResponseDefaultTypeInternal;
+extern NumResponseDefaultTypeInternal _NumResponse_default_instance_;
+}  // namespace testNamespace
+PROTOBUF_NAMESPACE_OPEN
+template<> ::testNamespace::NumRequest* Arena::CreateMaybeMessage<::testNamespace::NumRequest>(Arena*);
+template<> ::testNamespace::NumResponse* Arena::CreateMaybeMessage<::testNamespace::NumResponse>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace testNamespace {
 
 // ===================================================================
 
-class NumRequest : public ::google::protobuf::Message {
+class NumRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:testNamespace.NumRequest) */ {
  public:
-  NumRequest();
-  virtual ~NumRequest();
+  inline NumRequest() : NumRequest(nullptr) {}
+  ~NumRequest() override;
+  explicit PROTOBUF_CONSTEXPR NumRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   NumRequest(const NumRequest& from);
+  NumRequest(NumRequest&& from) noexcept
+    : NumRequest() {
+    *this = ::std::move(from);
+  }
 
   inline NumRequest& operator=(const NumRequest& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline NumRequest& operator=(NumRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const NumRequest& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const NumRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const NumRequest* internal_default_instance() {
+    return reinterpret_cast<const NumRequest*>(
+               &_NumRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
 
-  void Swap(NumRequest* other);
+  friend void swap(NumRequest& a, NumRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(NumRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(NumRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  NumRequest* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  NumRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<NumRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const NumRequest& from);
-  void MergeFrom(const NumRequest& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const NumRequest& from) {
+    NumRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(NumRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "testNamespace.NumRequest";
+  }
+  protected:
+  explicit NumRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kInput1FieldNumber = 1,
+    kInput2FieldNumber = 2,
+  };
   // optional int32 input1 = 1;
-  inline bool has_input1() const;
-  inline void clear_input1();
-  static const int kInput1FieldNumber = 1;
-  inline ::google::protobuf::int32 input1() const;
-  inline void set_input1(::google::protobuf::int32 value);
+  bool has_input1() const;
+  private:
+  bool _internal_has_input1() const;
+  public:
+  void clear_input1();
+  int32_t input1() const;
+  void set_input1(int32_t value);
+  private:
+  int32_t _internal_input1() const;
+  void _internal_set_input1(int32_t value);
+  public:
 
   // optional int32 input2 = 2;
-  inline bool has_input2() const;
-  inline void clear_input2();
-  static const int kInput2FieldNumber = 2;
-  inline ::google::protobuf::int32 input2() const;
-  inline void set_input2(::google::protobuf::int32 value);
+  bool has_input2() const;
+  private:
+  bool _internal_has_input2() const;
+  public:
+  void clear_input2();
+  int32_t input2() const;
+  void set_input2(int32_t value);
+  private:
+  int32_t _internal_input2() const;
+  void _internal_set_input2(int32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:testNamespace.NumRequest)
  private:
-  inline void set_has_input1();
-  inline void clear_has_input1();
-  inline void set_has_input2();
-  inline void clear_has_input2();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::int32 input1_;
-  ::google::protobuf::int32 input2_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
-
-  friend void  protobuf_AddDesc_Test_2eproto();
-  friend void protobuf_AssignDesc_Test_2eproto();
-  friend void protobuf_ShutdownFile_Test_2eproto();
-
-  void InitAsDefaultInstance();
-  static NumRequest* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int32_t input1_;
+    int32_t input2_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_Test_2eproto;
 };
 // -------------------------------------------------------------------
 
-class NumResponse : public ::google::protobuf::Message {
+class NumResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:testNamespace.NumResponse) */ {
  public:
-  NumResponse();
-  virtual ~NumResponse();
+  inline NumResponse() : NumResponse(nullptr) {}
+  ~NumResponse() override;
+  explicit PROTOBUF_CONSTEXPR NumResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   NumResponse(const NumResponse& from);
+  NumResponse(NumResponse&& from) noexcept
+    : NumResponse() {
+    *this = ::std::move(from);
+  }
 
   inline NumResponse& operator=(const NumResponse& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline NumResponse& operator=(NumResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const NumResponse& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const NumResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const NumResponse* internal_default_instance() {
+    return reinterpret_cast<const NumResponse*>(
+               &_NumResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
 
-  void Swap(NumResponse* other);
+  friend void swap(NumResponse& a, NumResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(NumResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(NumResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  NumResponse* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  NumResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<NumResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const NumResponse& from);
-  void MergeFrom(const NumResponse& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const NumResponse& from) {
+    NumResponse::MergeImpl(*this, from);
+  }
   private:
-  void SharedCtor();
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(NumResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "testNamespace.NumResponse";
+  }
+  protected:
+  explicit NumResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kOutputFieldNumber = 1,
+  };
   // optional int32 output = 1;
-  inline bool has_output() const;
-  inline void clear_output();
-  static const int kOutputFieldNumber = 1;
-  inline ::google::protobuf::int32 output() const;
-  inline void set_output(::google::protobuf::int32 value);
+  bool has_output() const;
+  private:
+  bool _internal_has_output() const;
+  public:
+  void clear_output();
+  int32_t output() const;
+  void set_output(int32_t value);
+  private:
+  int32_t _internal_output() const;
+  void _internal_set_output(int32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:testNamespace.NumResponse)
  private:
-  inline void set_has_output();
-  inline void clear_has_output();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::int32 output_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(1 + 31) / 32];
-
-  friend void  protobuf_AddDesc_Test_2eproto();
-  friend void protobuf_AssignDesc_Test_2eproto();
-  friend void protobuf_ShutdownFile_Test_2eproto();
-
-  void InitAsDefaultInstance();
-  static NumResponse* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int32_t output_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_Test_2eproto;
 };
 // ===================================================================
 
 class NumService_Stub;
 
-class NumService : public ::google::protobuf::Service {
+class NumService : public ::PROTOBUF_NAMESPACE_ID::Service {
  protected:
   // This class should be treated as an abstract interface.
   inline NumService() {};
@@ -224,29 +407,37 @@ class NumService : public ::google::protobuf::Service {
 
   typedef NumService_Stub Stub;
 
-  static const ::google::protobuf::ServiceDescriptor* descriptor();
+  static const ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor* descriptor();
 
-  virtual void add(::google::protobuf::RpcController* controller,
+  virtual void add(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
                        const ::testNamespace::NumRequest* request,
                        ::testNamespace::NumResponse* response,
                        ::google::protobuf::Closure* done);
-  virtual void minus(::google::protobuf::RpcController* controller,
+  virtual void minus(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::testNamespace::NumRequest* request,
+                       ::testNamespace::NumResponse* response,
+                       ::google::protobuf::Closure* done);
+  virtual void range(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::testNamespace::NumRequest* request,
+                       ::testNamespace::NumResponse* response,
+                       ::google::protobuf::Closure* done);
+  virtual void sum(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
                        const ::testNamespace::NumRequest* request,
                        ::testNamespace::NumResponse* response,
                        ::google::protobuf::Closure* done);
 
   // implements Service ----------------------------------------------
 
-  const ::google::protobuf::ServiceDescriptor* GetDescriptor();
-  void CallMethod(const ::google::protobuf::MethodDescriptor* method,
-                  ::google::protobuf::RpcController* controller,
-                  const ::google::protobuf::Message* request,
-                  ::google::protobuf::Message* response,
+  const ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor* GetDescriptor();
+  void CallMethod(const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method,
+                  ::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                  const ::PROTOBUF_NAMESPACE_ID::Message* request,
+                  ::PROTOBUF_NAMESPACE_ID::Message* response,
                   ::google::protobuf::Closure* done);
-  const ::google::protobuf::Message& GetRequestPrototype(
-    const ::google::protobuf::MethodDescriptor* method) const;
-  const ::google::protobuf::Message& GetResponsePrototype(
-    const ::google::protobuf::MethodDescriptor* method) const;
+  const ::PROTOBUF_NAMESPACE_ID::Message& GetRequestPrototype(
+    const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method) const;
+  const ::PROTOBUF_NAMESPACE_ID::Message& GetResponsePrototype(
+    const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method) const;
 
  private:
   GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(NumService);
@@ -254,25 +445,33 @@ class NumService : public ::google::protobuf::Service {
 
 class NumService_Stub : public NumService {
  public:
-  NumService_Stub(::google::protobuf::RpcChannel* channel);
-  NumService_Stub(::google::protobuf::RpcChannel* channel,
-                   ::google::protobuf::Service::ChannelOwnership ownership);
+  NumService_Stub(::PROTOBUF_NAMESPACE_ID::RpcChannel* channel);
+  NumService_Stub(::PROTOBUF_NAMESPACE_ID::RpcChannel* channel,
+                   ::PROTOBUF_NAMESPACE_ID::Service::ChannelOwnership ownership);
   ~NumService_Stub();
 
-  inline ::google::protobuf::RpcChannel* channel() { return channel_; }
+  inline ::PROTOBUF_NAMESPACE_ID::RpcChannel* channel() { return channel_; }
 
   // implements NumService ------------------------------------------
 
-  void add(::google::protobuf::RpcController* controller,
+  void add(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::testNamespace::NumRequest* request,
+                       ::testNamespace::NumResponse* response,
+                       ::google::protobuf::Closure* done);
+  void minus(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::testNamespace::NumRequest* request,
+                       ::testNamespace::NumResponse* response,
+                       ::google::protobuf::Closure* done);
+  void range(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
                        const ::testNamespace::NumRequest* request,
                        ::testNamespace::NumResponse* response,
                        ::google::protobuf::Closure* done);
-  void minus(::google::protobuf::RpcController* controller,
+  void sum(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
                        const ::testNamespace::NumRequest* request,
                        ::testNamespace::NumResponse* response,
                        ::google::protobuf::Closure* done);
  private:
-  ::google::protobuf::RpcChannel* channel_;
+  ::PROTOBUF_NAMESPACE_ID::RpcChannel* channel_;
   bool owns_channel_;
   GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(NumService_Stub);
 };
@@ -283,50 +482,66 @@ class NumService_Stub : public NumService {
 
 // ===================================================================
 
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
 // NumRequest
 
 // optional int32 input1 = 1;
+inline bool NumRequest::_internal_has_input1() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
 inline bool NumRequest::has_input1() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+  return _internal_has_input1();
 }
-inline void NumRequest::set_has_input1() {
-  _has_bits_[0] |= 0x00000001u;
+inline void NumRequest::clear_input1() {
+  _impl_.input1_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline void NumRequest::clear_has_input1() {
-  _has_bits_[0] &= ~0x00000001u;
+inline int32_t NumRequest::_internal_input1() const {
+  return _impl_.input1_;
 }
-inline void NumRequest::clear_input1() {
-  input1_ = 0;
-  clear_has_input1();
+inline int32_t NumRequest::input1() const {
+  // @@protoc_insertion_point(field_get:testNamespace.NumRequest.input1)
+  return _internal_input1();
 }
-inline ::google::protobuf::int32 NumRequest::input1() const {
-  return input1_;
+inline void NumRequest::_internal_set_input1(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.input1_ = value;
 }
-inline void NumRequest::set_input1(::google::protobuf::int32 value) {
-  set_has_input1();
-  input1_ = value;
+inline void NumRequest::set_input1(int32_t value) {
+  _internal_set_input1(value);
+  // @@protoc_insertion_point(field_set:testNamespace.NumRequest.input1)
 }
 
 // optional int32 input2 = 2;
+inline bool NumRequest::_internal_has_input2() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
 inline bool NumRequest::has_input2() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+  return _internal_has_input2();
 }
-inline void NumRequest::set_has_input2() {
-  _has_bits_[0] |= 0x00000002u;
+inline void NumRequest::clear_input2() {
+  _impl_.input2_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline void NumRequest::clear_has_input2() {
-  _has_bits_[0] &= ~0x00000002u;
+inline int32_t NumRequest::_internal_input2() const {
+  return _impl_.input2_;
 }
-inline void NumRequest::clear_input2() {
-  input2_ = 0;
-  clear_has_input2();
+inline int32_t NumRequest::input2() const {
+  // @@protoc_insertion_point(field_get:testNamespace.NumRequest.input2)
+  return _internal_input2();
 }
-inline ::google::protobuf::int32 NumRequest::input2() const {
-  return input2_;
+inline void NumRequest::_internal_set_input2(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.input2_ = value;
 }
-inline void NumRequest::set_input2(::google::protobuf::int32 value) {
-  set_has_input2();
-  input2_ = value;
+inline void NumRequest::set_input2(int32_t value) {
+  _internal_set_input2(value);
+  // @@protoc_insertion_point(field_set:testNamespace.NumRequest.input2)
 }
 
 // -------------------------------------------------------------------
@@ -334,41 +549,44 @@ inline void NumRequest::set_input2(::google::protobuf::int32 value) {
 // NumResponse
 
 // optional int32 output = 1;
+inline bool NumResponse::_internal_has_output() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
 inline bool NumResponse::has_output() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+  return _internal_has_output();
 }
-inline void NumResponse::set_has_output() {
-  _has_bits_[0] |= 0x00000001u;
+inline void NumResponse::clear_output() {
+  _impl_.output_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline void NumResponse::clear_has_output() {
-  _has_bits_[0] &= ~0x00000001u;
+inline int32_t NumResponse::_internal_output() const {
+  return _impl_.output_;
 }
-inline void NumResponse::clear_output() {
-  output_ = 0;
-  clear_has_output();
+inline int32_t NumResponse::output() const {
+  // @@protoc_insertion_point(field_get:testNamespace.NumResponse.output)
+  return _internal_output();
 }
-inline ::google::protobuf::int32 NumResponse::output() const {
-  return output_;
+inline void NumResponse::_internal_set_output(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.output_ = value;
 }
-inline void NumResponse::set_output(::google::protobuf::int32 value) {
-  set_has_output();
-  output_ = value;
+inline void NumResponse::set_output(int32_t value) {
+  _internal_set_output(value);
+  // @@protoc_insertion_point(field_set:testNamespace.NumResponse.output)
 }
 
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
 }  // namespace testNamespace
 
-#ifndef SWIG
-namespace google {
-namespace protobuf {
-
-
-}  // namespace google
-}  // namespace protobuf
-#endif  // SWIG
-
 // @@protoc_insertion_point(global_scope)
 
-#endif  // PROTOBUF_Test_2eproto__INCLUDED
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_Test_2eproto
@@ -4,6 +4,9 @@
 #include "Test.pb.h"
 #include "IRpcClient.h"
 #include "IRpcChannel.h"
+#include "RpcCoroutine.h"
+#include "RpcFuture.h"
+#include "ClientStream.h"
 
 //첽õĻص
 void callback(testNamespace::NumResponse *pResp, google::protobuf::RpcController *pController)
@@ -20,6 +23,24 @@ void callback(testNamespace::NumResponse *pResp, google::protobuf::RpcController
 	std::cout << "async call result: 3 + 4 = " << pResp->output() << std::endl;
 }
 
+#ifdef RPC_HAS_COROUTINE
+//Э̵ãC++20ʱãco_awaitڼ䲻ռ̣߳ҲҪClosure
+RpcTask coroutineCall(IRpcChannel *pIChannel)
+{
+	testNamespace::NumRequest req;
+	req.set_input1(5);
+	req.set_input2(6);
+	testNamespace::NumResponse resp;
+	RpcController controller;
+
+	//δִָЭIOWorker߳лָʱʱΪ1000
+	if (co_await rpcCall(pIChannel, testNamespace::NumService::descriptor()->FindMethodByName("add"), &controller, &req, &resp, NULL, 1000))
+		std::cout << "coroutine call result: 5 + 6 = " << resp.output() << std::endl;
+	else
+		std::cout << "coroutine call error: " << controller.ErrorText() << std::endl;
+}
+#endif
+
 int main()
 {
 	//RpcClientʵ
@@ -49,6 +70,67 @@ int main()
 	//doneصϢԽ첽
 	controller.Reset();
 	numServiceStub.add(&controller, &req, &resp, google::protobuf::NewCallback(callback, &resp, (google::protobuf::RpcController *)(&controller)));
+
+#ifdef RPC_HAS_COROUTINE
+	coroutineCall(pIChannel);
+#endif
+
+	//futureзãֻ߳ȫʱһ
+	const unsigned int futureNum = 4;
+	testNamespace::NumRequest arrReq[futureNum];
+	testNamespace::NumResponse arrResp[futureNum];
+	RpcController arrController[futureNum];
+	RpcFuture arrFuture[futureNum];
+	RpcFuture *arrPFuture[futureNum];
+	for (unsigned int i = 0; i < futureNum; ++i)
+	{
+		arrReq[i].set_input1(i);
+		arrReq[i].set_input2(i);
+		arrPFuture[i] = &arrFuture[i];
+		numServiceStub.add(&arrController[i], &arrReq[i], &arrResp[i], arrFuture[i].start());
+	}
+	RpcFuture::waitAll(arrPFuture, futureNum);
+	for (unsigned int i = 0; i < futureNum; ++i)
+	{
+		if (arrController[i].Failed())
+			std::cout << "future call error: " << arrController[i].ErrorText() << std::endl;
+		else
+			std::cout << "future call result: " << i << " + " << i << " = " << arrResp[i].output() << std::endl;
+	}
+
+	//ʽãϢ󼴿ɶȡΪ4ȿͻ4Ϣ
+	//첽ÿʹcontrollerrespʽʹԼ
+	testNamespace::NumRequest streamReq;
+	streamReq.set_input1(0);
+	streamReq.set_input2(10);
+	testNamespace::NumResponse streamMsg;
+	RpcController streamController;
+	ClientStream stream;
+	pIChannel->startStream(testNamespace::NumService::descriptor()->FindMethodByName("range"), &streamController, &streamReq, &stream, 4);
+	while (stream.read(&streamMsg))
+		std::cout << "stream call message: " << streamMsg.output() << std::endl;
+	if (streamController.Failed())
+		std::cout << "stream call error: " << streamController.ErrorText() << std::endl;
+	else
+		std::cout << "stream call finished." << std::endl;
+
+	//ͻʽãдϢȡ黹ȣдȴظܺ
+	testNamespace::NumResponse sumResp;
+	RpcController sumController;
+	ClientStream sumStream;
+	pIChannel->startClientStream(testNamespace::NumService::descriptor()->FindMethodByName("sum"), &sumController, &sumResp, &sumStream, 4);
+	for (int i = 0; i < 10; ++i)
+	{
+		streamReq.set_input1(i);
+		streamReq.set_input2(i);
+		if (!sumStream.write(streamReq))
+			break;
+	}
+	sumStream.finish();
+	if (sumController.Failed())
+		std::cout << "client stream call error: " << sumController.ErrorText() << std::endl;
+	else
+		std::cout << "client stream call result: " << sumResp.output() << std::endl;
 	
 	//RpcChannelʵ
 	//IRpcChannel::releaseRpcChannel(pIChannel);
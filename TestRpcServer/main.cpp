@@ -2,6 +2,7 @@
 #include "Test.pb.h"
 #include "IRpcServer.h"
 #include "RpcController.h"
+#include "ServerStream.h"
 
 //ʵ
 class NumServiceImpl : public testNamespace::NumService
@@ -13,6 +14,8 @@ public:
 		::google::protobuf::Closure* done)
 	{
 		response->set_output(request->input1() + request->input2());
+		//ͬɣǰdone
+		done->Run();
 	}
 
 	virtual void minus(::google::protobuf::RpcController* controller,
@@ -20,7 +23,68 @@ public:
 		::testNamespace::NumResponse* response,
 		::google::protobuf::Closure* done)
 	{
-		response->set_output(request->input1() - request->input2());
+		//첽ɣأ߳ɺٵdoneڼ䲻ռҵWorker
+		int input1 = request->input1();
+		int input2 = request->input2();
+		boost::thread([=]() {
+			response->set_output(input1 - input2);
+			done->Run();
+		}).detach();
+	}
+
+	virtual void range(::google::protobuf::RpcController* controller,
+		const ::testNamespace::NumRequest* request,
+		::testNamespace::NumResponse* response,
+		::google::protobuf::Closure* done)
+	{
+		//IRpcChannel::startStream()ĵòͨʧܷأϢӦͻ
+		ServerStream *pStream = ServerStream::fromController(controller);
+		if (NULL == pStream)
+		{
+			controller->SetFailed("range must be called as a stream");
+			done->Run();
+			return;
+		}
+		//дڿͻ˶ʱԼ߳д룬ռҵWorker
+		int input1 = request->input1();
+		int input2 = request->input2();
+		boost::thread([=]() {
+			testNamespace::NumResponse msg;
+			for (int i = input1; i < input2; ++i)
+			{
+				msg.set_output(i);
+				//ͻȡѶϿ
+				if (!pStream->write(msg))
+					break;
+			}
+			//֮ٷ
+			done->Run();
+		}).detach();
+	}
+
+	virtual void sum(::google::protobuf::RpcController* controller,
+		const ::testNamespace::NumRequest* request,
+		::testNamespace::NumResponse* response,
+		::google::protobuf::Closure* done)
+	{
+		//IRpcChannel::startClientStream()ĵòܶȡϢ
+		ServerStream *pStream = ServerStream::fromController(controller);
+		if (NULL == pStream || 0 == pStream->getReadWindow())
+		{
+			controller->SetFailed("sum must be called as a client stream");
+			done->Run();
+			return;
+		}
+		//ĶȡûϢʱԼ߳жȡռҵWorker
+		boost::thread([=]() {
+			testNamespace::NumRequest msg;
+			int total = 0;
+			while (pStream->read(&msg))
+				total += msg.input1() + msg.input2();
+			//ͻдϢظܺͣȡʱظҲٷ
+			response->set_output(total);
+			done->Run();
+		}).detach();
 	}
 };
 
@@ -39,8 +103,8 @@ int main()
 	IRpcServer *pIServer = IRpcServer::createRpcServer("127.0.0.1", 8888, 3, 50, 50, 3, 50);
 	//ʵʵ
 	NumServiceImpl numService;
-	//ע
-	pIServer->registerService(&numService);
+	//עaddʱ̣IOWorkerִ߳
+	pIServer->registerService(&numService, std::vector<std::string>(1, "add"));
 
 	//RpcServerʵԣʵʿвҪôΪserverֹͣ
 	//boost::thread thd(releaseServer, pIServer);